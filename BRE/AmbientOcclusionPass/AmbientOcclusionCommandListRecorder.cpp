@@ -175,7 +175,8 @@ AmbientOcclusionCommandListRecorder::Init(const D3D12_CPU_DESCRIPTOR_HANDLE& amb
 }
 
 std::uint32_t
-AmbientOcclusionCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept
+AmbientOcclusionCommandListRecorder::RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                                               const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
@@ -183,10 +184,6 @@ AmbientOcclusionCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffe
 
     ID3D12GraphicsCommandList& commandList = mCommandListPerFrame.ResetCommandListWithNextCommandAllocator(sPSO);
 
-    // Update frame constants
-    UploadBuffer& uploadFrameCBuffer(mFrameUploadCBufferPerFrame.GetNextFrameCBuffer());
-    uploadFrameCBuffer.CopyData(0U, &frameCBuffer, sizeof(frameCBuffer));
-
     commandList.RSSetViewports(1U, &ApplicationSettings::sScreenViewport);
     commandList.RSSetScissorRects(1U, &ApplicationSettings::sScissorRect);
     commandList.OMSetRenderTargets(1U,
@@ -198,12 +195,10 @@ AmbientOcclusionCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffe
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
 
     commandList.SetGraphicsRootSignature(sRootSignature);
-    const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuVAddress(
-        uploadFrameCBuffer.GetResource().GetGPUVirtualAddress());
     const D3D12_GPU_VIRTUAL_ADDRESS ambientOcclusionCBufferGpuVAddress(
         mAmbientOcclusionUploadCBuffer->GetResource().GetGPUVirtualAddress());
-    commandList.SetGraphicsRootConstantBufferView(0U, frameCBufferGpuVAddress);
-    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuVAddress);
+    commandList.SetGraphicsRootConstantBufferView(0U, frameCBufferGpuAddress);
+    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuAddress);
     commandList.SetGraphicsRootConstantBufferView(2U, ambientOcclusionCBufferGpuVAddress);
     commandList.SetGraphicsRootDescriptorTable(3U, mNormalRoughnessBufferShaderResourceView);
     commandList.SetGraphicsRootDescriptorTable(4U, mPixelShaderResourceViewsBegin);
@@ -213,7 +208,7 @@ AmbientOcclusionCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffe
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
@@ -244,12 +239,11 @@ AmbientOcclusionCommandListRecorder::CreateSampleKernelBuffer(const std::vector<
     const std::size_t sampleKernelBufferElemSize{ sizeof(XMFLOAT4) };
     mSampleKernelUploadBuffer = &UploadBufferManager::CreateUploadBuffer(sampleKernelBufferElemSize,
                                                                          sampleKernelSize);
-    const std::uint8_t* sampleKernelPtr = reinterpret_cast<const std::uint8_t*>(sampleKernel.data());
-    for (std::uint32_t i = 0UL; i < sampleKernelSize; ++i) {
-        mSampleKernelUploadBuffer->CopyData(i,
-                                            sampleKernelPtr + sampleKernelBufferElemSize * i,
-                                            sampleKernelBufferElemSize);
-    }
+    mSampleKernelUploadBuffer->CopyDataBatch(0U,
+                                             sampleKernel.data(),
+                                             sampleKernelBufferElemSize,
+                                             sampleKernelBufferElemSize,
+                                             sampleKernelSize);
 }
 
 ID3D12Resource*
@@ -274,7 +268,8 @@ AmbientOcclusionCommandListRecorder::CreateAndGetNoiseTexture(const std::vector<
                                                              D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
                                                              nullptr,
                                                              L"Noise Buffer",
-                                                             ResourceManager::ResourceStateTrackingType::FULL_TRACKING);
+                                                             ResourceManager::ResourceStateTrackingType::FULL_TRACKING,
+                                                             MemoryBudget::Category::TEXTURES);
 
     // In order to copy CPU memory data into our default buffer, we need to create
     // an intermediate upload heap. 
@@ -301,7 +296,8 @@ AmbientOcclusionCommandListRecorder::CreateAndGetNoiseTexture(const std::vector<
                                                                          D3D12_RESOURCE_STATE_GENERIC_READ,
                                                                          nullptr,
                                                                          nullptr,
-                                                                         ResourceManager::ResourceStateTrackingType::NO_TRACKING);
+                                                                         ResourceManager::ResourceStateTrackingType::NO_TRACKING,
+                                                                         MemoryBudget::Category::STAGING_BUFFERS);
 
     return noiseTexture;
 }
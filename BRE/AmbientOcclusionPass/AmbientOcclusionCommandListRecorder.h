@@ -3,13 +3,11 @@
 #include <DirectXMath.h>
 #include <vector>
 
+#include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandListPerFrame.h>
-#include <ResourceManager\FrameUploadCBufferPerFrame.h>
 #include <ResourceManager\UploadBuffer.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible of command list recording for ambient occlusion pass.
 ///
@@ -48,10 +46,12 @@ public:
     ///
     /// Init() must be called first
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                            const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Validates internal data. Used most with assertions.
@@ -89,8 +89,6 @@ private:
 
     CommandListPerFrame mCommandListPerFrame;
 
-    FrameUploadCBufferPerFrame mFrameUploadCBufferPerFrame;
-
     UploadBuffer* mSampleKernelUploadBuffer{ nullptr };
 
     D3D12_CPU_DESCRIPTOR_HANDLE mAmbientAccessibilityBufferRenderTargetView{ 0UL };
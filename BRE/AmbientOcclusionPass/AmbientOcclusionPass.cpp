@@ -7,28 +7,24 @@
 #include <DescriptorManager\RenderTargetDescriptorManager.h>
 #include <DXUtils\D3DFactory.h>
 #include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\TransientResourceManager.h>
 #include <ResourceStateManager\ResourceStateManager.h>
 #include <Utils\DebugUtils.h>
 
 namespace BRE {
 namespace {
 ///
-/// @brief Creates resource, render target view and shader resource view.
-/// @param resourceInitialState Initial statea of the resource to create
+/// @brief Declares a buffer in the TransientResourceManager
 /// @param resourceName Name of the resource
-/// @param resource Output resource
-/// @param resourceRenderTargetView Output render target view to the resource
+/// @param firstPassIndex Index of the first pass that uses the buffer
+/// @param lastPassIndex Index of the last pass that uses the buffer
+/// @return The resource identifier
 ///
-void
-CreateResourceAndRenderTargetView(const D3D12_RESOURCE_STATES resourceInitialState,
-                                  const wchar_t* resourceName,
-                                  ID3D12Resource* &resource,
-                                  D3D12_CPU_DESCRIPTOR_HANDLE& resourceRenderTargetView,
-                                  D3D12_GPU_DESCRIPTOR_HANDLE& resourceShaderResourceView) noexcept
+std::uint32_t
+DeclareBuffer(const wchar_t* resourceName,
+              const std::uint32_t firstPassIndex,
+              const std::uint32_t lastPassIndex) noexcept
 {
-    BRE_ASSERT(resource == nullptr);
-
-    // Set shared buffers properties
     const D3D12_RESOURCE_DESC resourceDescriptor = D3DFactory::GetResourceDescriptor(ApplicationSettings::sWindowWidth,
                                                                                      ApplicationSettings::sWindowHeight,
                                                                                      DXGI_FORMAT_R16_UNORM,
@@ -36,22 +32,32 @@ CreateResourceAndRenderTargetView(const D3D12_RESOURCE_STATES resourceInitialSta
 
     D3D12_CLEAR_VALUE clearValue{ resourceDescriptor.Format, 0.0f, 0.0f, 0.0f, 0.0f };
 
-    const D3D12_HEAP_PROPERTIES heapProperties = D3DFactory::GetHeapProperties();
-
-    // Create buffer resource
-    resource = &ResourceManager::CreateCommittedResource(heapProperties,
-                                                         D3D12_HEAP_FLAG_NONE,
-                                                         resourceDescriptor,
-                                                         resourceInitialState,
-                                                         &clearValue,
-                                                         resourceName,
-                                                         ResourceManager::ResourceStateTrackingType::FULL_TRACKING);
+    return TransientResourceManager::DeclareResource(resourceDescriptor,
+                                                     D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                     &clearValue,
+                                                     resourceName,
+                                                     ResourceManager::ResourceStateTrackingType::FULL_TRACKING,
+                                                     MemoryBudget::Category::INTERMEDIATE_BUFFERS,
+                                                     firstPassIndex,
+                                                     lastPassIndex);
+}
 
+///
+/// @brief Creates render target view and shader resource view.
+/// @param resource Resource
+/// @param resourceRenderTargetView Output render target view to the resource
+/// @param resourceShaderResourceView Output shader resource view to the resource
+///
+void
+CreateRenderTargetAndShaderResourceViews(ID3D12Resource& resource,
+                                         D3D12_CPU_DESCRIPTOR_HANDLE& resourceRenderTargetView,
+                                         D3D12_GPU_DESCRIPTOR_HANDLE& resourceShaderResourceView) noexcept
+{
     // Create render target view	
     D3D12_RENDER_TARGET_VIEW_DESC rtvDescriptor{};
     rtvDescriptor.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
-    rtvDescriptor.Format = resourceDescriptor.Format;
-    RenderTargetDescriptorManager::CreateRenderTargetView(*resource,
+    rtvDescriptor.Format = resource.GetDesc().Format;
+    RenderTargetDescriptorManager::CreateRenderTargetView(resource,
                                                           rtvDescriptor,
                                                           &resourceRenderTargetView);
 
@@ -61,13 +67,22 @@ CreateResourceAndRenderTargetView(const D3D12_RESOURCE_STATES resourceInitialSta
     srvDescriptor.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
     srvDescriptor.Texture2D.MostDetailedMip = 0;
     srvDescriptor.Texture2D.ResourceMinLODClamp = 0.0f;
-    srvDescriptor.Format = resource->GetDesc().Format;
-    srvDescriptor.Texture2D.MipLevels = resource->GetDesc().MipLevels;
-    resourceShaderResourceView = CbvSrvUavDescriptorManager::CreateShaderResourceView(*resource,
+    srvDescriptor.Format = resource.GetDesc().Format;
+    srvDescriptor.Texture2D.MipLevels = resource.GetDesc().MipLevels;
+    resourceShaderResourceView = CbvSrvUavDescriptorManager::CreateShaderResourceView(resource,
                                                                                       srvDescriptor);
 }
 }
 
+void
+AmbientOcclusionPass::DeclareTransientResources(const std::uint32_t passIndex,
+                                                const std::uint32_t lastPassIndex) noexcept
+{
+    // The ambient accessibility buffer is only read by the blur, in this pass.
+    mAmbientAccessibilityBufferId = DeclareBuffer(L"Ambient Accessibility Buffer", passIndex, passIndex);
+    mBlurBufferId = DeclareBuffer(L"Blur Buffer", passIndex, lastPassIndex);
+}
+
 void
 AmbientOcclusionPass::Init(ID3D12Resource& normalRoughnessBuffer,
                            ID3D12Resource& depthBuffer,
@@ -79,18 +94,16 @@ AmbientOcclusionPass::Init(ID3D12Resource& normalRoughnessBuffer,
     AmbientOcclusionCommandListRecorder::InitSharedPSOAndRootSignature();
     BlurCommandListRecorder::InitSharedPSOAndRootSignature();
 
-    // Create ambient accessibility buffer and blur buffer
-    CreateResourceAndRenderTargetView(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-                                      L"Ambient Accessibility Buffer",
-                                      mAmbientAccessibilityBuffer,
-                                      mAmbientAccessibilityBufferRenderTargetView,
-                                      mAmbientAccessibilityBufferShaderResourceView);
+    // Get ambient accessibility buffer and blur buffer, and create their views
+    mAmbientAccessibilityBuffer = &TransientResourceManager::GetResource(mAmbientAccessibilityBufferId);
+    CreateRenderTargetAndShaderResourceViews(*mAmbientAccessibilityBuffer,
+                                             mAmbientAccessibilityBufferRenderTargetView,
+                                             mAmbientAccessibilityBufferShaderResourceView);
 
-    CreateResourceAndRenderTargetView(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
-                                      L"Blur Buffer",
-                                      mBlurBuffer,
-                                      mBlurBufferRenderTargetView,
-                                      mBlurBufferShaderResourceView);
+    mBlurBuffer = &TransientResourceManager::GetResource(mBlurBufferId);
+    CreateRenderTargetAndShaderResourceViews(*mBlurBuffer,
+                                             mBlurBufferRenderTargetView,
+                                             mBlurBufferShaderResourceView);
 
     // Initialize ambient occlusion recorder
     mAmbientOcclusionRecorder.Init(mAmbientAccessibilityBufferRenderTargetView,
@@ -108,17 +121,28 @@ AmbientOcclusionPass::Init(ID3D12Resource& normalRoughnessBuffer,
 }
 
 std::uint32_t
-AmbientOcclusionPass::Execute(const FrameCBuffer& frameCBuffer) noexcept
+AmbientOcclusionPass::Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                              tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
 
     std::uint32_t commandListCount = 0U;
 
     commandListCount += RecordAndPushPrePassCommandLists();
-    commandListCount += mAmbientOcclusionRecorder.RecordAndPushCommandLists(frameCBuffer);
+
+    const std::uint32_t ambientOcclusionCommandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(1U);
+    recordingTaskGroup.run([this, frameCBufferGpuAddress, ambientOcclusionCommandListSlot]() {
+        mAmbientOcclusionRecorder.RecordAndPushCommandLists(frameCBufferGpuAddress, ambientOcclusionCommandListSlot);
+    });
+    ++commandListCount;
 
     commandListCount += RecordAndPushMiddlePassCommandLists();
-    commandListCount += mBlurRecorder.RecordAndPushCommandLists();
+
+    const std::uint32_t blurCommandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(1U);
+    recordingTaskGroup.run([this, blurCommandListSlot]() {
+        mBlurRecorder.RecordAndPushCommandLists(blurCommandListSlot);
+    });
+    ++commandListCount;
 
     return commandListCount;
 }
@@ -148,27 +172,27 @@ AmbientOcclusionPass::RecordAndPushPrePassCommandLists() noexcept
 
     D3D12_RESOURCE_BARRIER barriers[4U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*mAmbientAccessibilityBuffer) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mAmbientAccessibilityBuffer,
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mAmbientAccessibilityBuffer,
+                                                         D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mBlurBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mBlurBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mBlurBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mNormalRoughnessBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mNormalRoughnessBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mNormalRoughnessBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mDepthBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mDepthBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mDepthBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
@@ -198,15 +222,15 @@ AmbientOcclusionPass::RecordAndPushMiddlePassCommandLists() noexcept
 
     D3D12_RESOURCE_BARRIER barriers[2U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*mAmbientAccessibilityBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mAmbientAccessibilityBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mAmbientAccessibilityBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mBlurBuffer) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mBlurBuffer,
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mBlurBuffer,
+                                                         D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
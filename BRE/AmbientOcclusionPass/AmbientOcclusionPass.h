@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tbb/task_group.h>
+
 #include <CommandManager\CommandListPerFrame.h>
 #include <AmbientOcclusionPass\AmbientOcclusionCommandListRecorder.h>
 #include <AmbientOcclusionPass\BlurCommandListRecorder.h>
@@ -17,8 +19,20 @@ public:
     AmbientOcclusionPass(AmbientOcclusionPass&&) = delete;
     AmbientOcclusionPass& operator=(AmbientOcclusionPass&&) = delete;
 
+    ///
+    /// @brief Declares the ambient accessibility and blur buffers in the TransientResourceManager
+    /// @param passIndex Index of this pass in the frame
+    /// @param lastPassIndex Index of the last pass that reads the ambient accessibility buffer
+    /// returned by GetAmbientAccessibilityBuffer()
+    ///
+    void DeclareTransientResources(const std::uint32_t passIndex,
+                                   const std::uint32_t lastPassIndex) noexcept;
+
     ///
     /// @brief Initializes the pass
+    ///
+    /// DeclareTransientResources() must be called first, and then TransientResourceManager::CreateResources().
+    ///
     /// @param normalRoughnessBuffer Geometry buffer that contains normals and roughness factors.
     /// @param depthBuffer Depth buffer
     /// @param normalRoughnessBufferShaderResourceView Shader resource view to
@@ -34,12 +48,17 @@ public:
     /// @brief Executes the pass
     ///
     /// Init() must be called first. This method can record and
-    /// push command lists to the CommandListExecutor.
+    /// push command lists to the CommandListExecutor. Barrier command lists are
+    /// recorded by the calling thread, in pass order, and the other command lists
+    /// are recorded by tasks run in @p recordingTaskGroup.
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param recordingTaskGroup Task group where recording tasks are run. The caller must wait for it
+    /// before waiting for the execution of the recorded command lists.
     /// @return The number of recorded command lists.
     ///
-    std::uint32_t Execute(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                          tbb::task_group& recordingTaskGroup) noexcept;
 
     ///
     /// @brief Get the ambient accessibility buffer. This is necessary for other passes.
@@ -85,10 +104,12 @@ private:
     CommandListPerFrame mPrePassCommandListPerFrame;
     CommandListPerFrame mMiddlePassCommandListPerFrame;
 
+    std::uint32_t mAmbientAccessibilityBufferId{ 0U };
     ID3D12Resource* mAmbientAccessibilityBuffer{ nullptr };
     D3D12_GPU_DESCRIPTOR_HANDLE mAmbientAccessibilityBufferShaderResourceView{ 0UL };
     D3D12_CPU_DESCRIPTOR_HANDLE mAmbientAccessibilityBufferRenderTargetView{ 0UL };
 
+    std::uint32_t mBlurBufferId{ 0U };
     ID3D12Resource* mBlurBuffer{ nullptr };
     D3D12_GPU_DESCRIPTOR_HANDLE mBlurBufferShaderResourceView{ 0UL };
     D3D12_CPU_DESCRIPTOR_HANDLE mBlurBufferRenderTargetView{ 0UL };
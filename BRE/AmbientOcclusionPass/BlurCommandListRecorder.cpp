@@ -67,7 +67,7 @@ BlurCommandListRecorder::Init(const D3D12_GPU_DESCRIPTOR_HANDLE& ambientAccessib
 }
 
 std::uint32_t
-BlurCommandListRecorder::RecordAndPushCommandLists() noexcept
+BlurCommandListRecorder::RecordAndPushCommandLists(const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
@@ -96,7 +96,7 @@ BlurCommandListRecorder::RecordAndPushCommandLists() noexcept
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
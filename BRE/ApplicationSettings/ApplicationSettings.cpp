@@ -7,6 +7,8 @@
 namespace BRE {
 bool ApplicationSettings::sIsFullscreenWindow{ true };
 std::uint32_t ApplicationSettings::sCpuProcessorCount{ 4U }; // This should be changed according your processor
+std::uint64_t ApplicationSettings::sCommandListExecutorThreadAffinityMask{ 0UL };
+std::uint64_t ApplicationSettings::sRenderManagerThreadAffinityMask{ 0UL };
 std::uint32_t ApplicationSettings::sWindowWidth{ 1920U };
 std::uint32_t ApplicationSettings::sWindowHeight{ 1080U };
 
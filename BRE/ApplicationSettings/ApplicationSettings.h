@@ -27,6 +27,12 @@ public:
 
     static bool sIsFullscreenWindow;
     static std::uint32_t sCpuProcessorCount;
+
+    // Affinity masks of the dedicated CommandListExecutor and RenderManager threads.
+    // Zero means the thread is not pinned to any core.
+    static std::uint64_t sCommandListExecutorThreadAffinityMask;
+    static std::uint64_t sRenderManagerThreadAffinityMask;
+
     static const std::uint32_t sSwapChainBufferCount{ 4U };
     static const std::uint32_t sQueuedFrameCount{ sSwapChainBufferCount - 1U };
     static std::uint32_t sWindowWidth;
@@ -1,24 +1,35 @@
 #include "CommandListExecutor.h"
 
+#include <chrono>
 #include <memory>
 
+#include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandQueueManager.h>
 #include <CommandManager\FenceManager.h>
 
 namespace BRE {
+namespace {
+///
+/// @brief Get elapsed time since a time point
+/// @param beginTime Initial time point
+/// @return Elapsed time in microseconds
+///
+std::uint64_t
+GetElapsedTimeInMicroseconds(const std::chrono::steady_clock::time_point& beginTime) noexcept
+{
+    const std::chrono::steady_clock::duration elapsedTime = std::chrono::steady_clock::now() - beginTime;
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count());
+}
+}
+
 CommandListExecutor* CommandListExecutor::sExecutor{ nullptr };
 
 void
-CommandListExecutor::Create(const std::uint32_t maxNumCommandLists) noexcept
+CommandListExecutor::Create(const BatchingPolicy& batchingPolicy) noexcept
 {
     BRE_ASSERT(sExecutor == nullptr);
 
-    tbb::empty_task* parent{ new (tbb::task::allocate_root()) tbb::empty_task };
-
-    // 1 reference for the parent + 1 reference for the child
-    parent->set_ref_count(2);
-
-    sExecutor = new (parent->allocate_child()) CommandListExecutor(maxNumCommandLists);
+    sExecutor = new CommandListExecutor(batchingPolicy);
 }
 
 CommandListExecutor&
@@ -29,89 +40,272 @@ CommandListExecutor::Get() noexcept
     return *sExecutor;
 }
 
-CommandListExecutor::CommandListExecutor(const std::uint32_t maxNumberOfCommandListsToExecute)
-    : mMaxNumberOfCommandListsToExecute(maxNumberOfCommandListsToExecute)
+CommandListExecutor::CommandListExecutor(const BatchingPolicy& batchingPolicy)
+    : mBatchingPolicy(batchingPolicy)
 {
-    BRE_ASSERT(maxNumberOfCommandListsToExecute > 0U);
+    BRE_ASSERT(batchingPolicy.mMaxBatchSize > 0U);
+
+    for (std::uint32_t i = 0U; i < sCommandListSlotCount; ++i) {
+        mCommandListBySlot[i] = nullptr;
+    }
 
-    D3D12_COMMAND_QUEUE_DESC commandQueueDescriptor = {};
-    commandQueueDescriptor.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
-    commandQueueDescriptor.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
-    mCommandQueue = &CommandQueueManager::CreateCommandQueue(commandQueueDescriptor);
-    BRE_ASSERT(mCommandQueue != nullptr);
+    const D3D12_COMMAND_LIST_TYPE commandListTypeByQueueType[] =
+    {
+        D3D12_COMMAND_LIST_TYPE_DIRECT,
+        D3D12_COMMAND_LIST_TYPE_COMPUTE,
+        D3D12_COMMAND_LIST_TYPE_COPY,
+    };
+    static_assert(_countof(commandListTypeByQueueType) == static_cast<std::uint32_t>(CommandQueueType::COUNT),
+                  "There must be a command list type per queue type");
 
-    mFence = &FenceManager::CreateFence(0U, D3D12_FENCE_FLAG_NONE);
+    for (std::uint32_t i = 0U; i < _countof(commandListTypeByQueueType); ++i) {
+        D3D12_COMMAND_QUEUE_DESC commandQueueDescriptor = {};
+        commandQueueDescriptor.Type = commandListTypeByQueueType[i];
+        commandQueueDescriptor.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+        ID3D12CommandQueue& commandQueue = CommandQueueManager::CreateCommandQueue(commandQueueDescriptor);
+        ID3D12Fence& fence = FenceManager::CreateFence(0U, D3D12_FENCE_FLAG_NONE);
 
-    parent()->spawn(*this);
+        mSubmissionQueueByType[i].reset(new D3D12SubmissionQueue(commandQueue, fence));
+        mQueueSubmitter.SetQueue(static_cast<CommandQueueType>(i), *mSubmissionQueueByType[i]);
+    }
+
+    mCommandQueue = &mSubmissionQueueByType[static_cast<std::uint32_t>(CommandQueueType::DIRECT)]->GetCommandQueue();
+
+    mThread = std::thread(&CommandListExecutor::ExecuteCommandListsLoop, this);
 }
 
-tbb::task*
-CommandListExecutor::execute()
+void
+CommandListExecutor::ExecuteCommandListsLoop() noexcept
 {
-    BRE_ASSERT(mMaxNumberOfCommandListsToExecute > 0);
+    if (ApplicationSettings::sCommandListExecutorThreadAffinityMask != 0UL) {
+        SetThreadAffinityMask(GetCurrentThread(),
+                              static_cast<DWORD_PTR>(ApplicationSettings::sCommandListExecutorThreadAffinityMask));
+    }
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            // Sleep until the command list of the next slot is pushed or we must terminate.
+            if (mTerminate == false && IsNextSlotReady() == false) {
+                const std::chrono::steady_clock::time_point beginTime = std::chrono::steady_clock::now();
+                mCommandListsAvailableCondition.wait(lock, [this]()
+                {
+                    return mTerminate || IsNextSlotReady();
+                });
+                mExecutorWaitTimeInMicroseconds += GetElapsedTimeInMicroseconds(beginTime);
+            }
 
-    ID3D12CommandList* *pendingCommandLists{ new ID3D12CommandList*[mMaxNumberOfCommandListsToExecute] };
-    while (mTerminate == false) {
-        // Pop at most mMaxNumberOfCommandListsToExecute from command list queue
-        while (mPendingCommandListCount < mMaxNumberOfCommandListsToExecute &&
-               mCommandListsToExecute.try_pop(pendingCommandLists[mPendingCommandListCount])) {
-            ++mPendingCommandListCount;
+            if (mTerminate) {
+                break;
+            }
+
+            const BatchingPolicy batchingPolicy(mBatchingPolicy);
+            BRE_ASSERT(batchingPolicy.mMaxBatchSize > 0U);
+            TakeReadyCommandLists(batchingPolicy.mMaxBatchSize);
+
+            // While the batch is not full, wait for more ready command lists according
+            // the batching policy. We stop waiting as soon as a thread waits for execution.
+            const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+                std::chrono::microseconds(batchingPolicy.mMaxWaitTimeInMicroseconds);
+            while (mPendingCommandLists.size() < batchingPolicy.mMaxBatchSize &&
+                   mTerminate == false &&
+                   mWaitingThreadCount == 0U) {
+                const auto isBatchWaitFinished = [this]()
+                {
+                    return mTerminate || mWaitingThreadCount > 0U || IsNextSlotReady();
+                };
+
+                if (batchingPolicy.mMaxWaitTimeInMicroseconds != 0U) {
+                    if (mCommandListsAvailableCondition.wait_until(lock, deadline, isBatchWaitFinished) == false) {
+                        break;
+                    }
+                } else if (batchingPolicy.mFlushOnFrameEnd) {
+                    mCommandListsAvailableCondition.wait(lock, isBatchWaitFinished);
+                } else {
+                    break;
+                }
+
+                TakeReadyCommandLists(batchingPolicy.mMaxBatchSize);
+            }
+
+            // Dependencies must be taken after the command lists, as they can
+            // be added just before the dependent command lists are pushed.
+            mPendingDependencies.swap(mPushedCommandListDependencies);
         }
 
         // Execute pending command lists (if any)
-        if (mPendingCommandListCount != 0U) {
-            mCommandQueue->ExecuteCommandLists(mPendingCommandListCount, pendingCommandLists);
-            mExecutedCommandListCount += mPendingCommandListCount;
-            mPendingCommandListCount = 0U;
-        } else {
-            Sleep(0U);
+        const std::uint32_t pendingCommandListCount = static_cast<std::uint32_t>(mPendingCommandLists.size());
+        if (pendingCommandListCount != 0U) {
+            mQueueSubmitter.Submit(CommandQueueType::DIRECT,
+                                   pendingCommandListCount,
+                                   mPendingCommandLists.data(),
+                                   mPendingDependencies.data(),
+                                   static_cast<std::uint32_t>(mPendingDependencies.size()));
+            mPendingDependencies.clear();
+
+            std::uint64_t totalDwellTime = 0UL;
+            std::uint64_t maxDwellTime = 0UL;
+            for (const std::chrono::steady_clock::time_point& pushTime : mPendingCommandListPushTimes) {
+                const std::uint64_t dwellTime = GetElapsedTimeInMicroseconds(pushTime);
+                totalDwellTime += dwellTime;
+                maxDwellTime = dwellTime > maxDwellTime ? dwellTime : maxDwellTime;
+            }
+
+            mMutex.lock();
+            mExecutedCommandListCount += pendingCommandListCount;
+            ++mBatchStatistics.mExecuteCallCount;
+            mBatchStatistics.mExecutedCommandListCount += pendingCommandListCount;
+            if (pendingCommandListCount > mBatchStatistics.mMaxCommandListCountPerCall) {
+                mBatchStatistics.mMaxCommandListCountPerCall = pendingCommandListCount;
+            }
+            mBatchStatistics.mTotalDwellTimeInMicroseconds += totalDwellTime;
+            if (maxDwellTime > mBatchStatistics.mMaxDwellTimeInMicroseconds) {
+                mBatchStatistics.mMaxDwellTimeInMicroseconds = maxDwellTime;
+            }
+            mMutex.unlock();
+            mCommandListsExecutedCondition.notify_all();
+
+            mPendingCommandLists.clear();
+            mPendingCommandListPushTimes.clear();
         }
     }
+}
 
-    delete[] pendingCommandLists;
+void
+CommandListExecutor::TakeReadyCommandLists(const std::uint32_t maxCommandListCount) noexcept
+{
+    while (mPendingCommandLists.size() < maxCommandListCount && IsNextSlotReady()) {
+        const std::uint32_t slotIndex = mNextSlotToExecute % sCommandListSlotCount;
+        mPendingCommandLists.push_back(mCommandListBySlot[slotIndex]);
+        mPendingCommandListPushTimes.push_back(mPushTimeBySlot[slotIndex]);
+        mCommandListBySlot[slotIndex] = nullptr;
+        ++mNextSlotToExecute;
+    }
+}
 
-    return nullptr;
+void
+CommandListExecutor::ResetExecutedCommandListCount() noexcept
+{
+    mMutex.lock();
+    mExecutedCommandListCount = 0U;
+    mBatchStatistics = BatchStatistics();
+    mMutex.unlock();
+}
+
+CommandListExecutor::BatchStatistics
+CommandListExecutor::GetBatchStatistics() noexcept
+{
+    mMutex.lock();
+    const BatchStatistics batchStatistics(mBatchStatistics);
+    mMutex.unlock();
+
+    return batchStatistics;
 }
 
 void
-CommandListExecutor::SignalFenceAndWaitForCompletion(ID3D12Fence& fence,
-                                                     const std::uint64_t valueToSignal,
-                                                     const std::uint64_t valueToWaitFor) noexcept
+CommandListExecutor::SetBatchingPolicy(const BatchingPolicy& batchingPolicy) noexcept
 {
-    const std::uint64_t completedFenceValue = fence.GetCompletedValue();
-    BRE_CHECK_HR(mCommandQueue->Signal(&fence, valueToSignal));
+    BRE_ASSERT(batchingPolicy.mMaxBatchSize > 0U);
+
+    mMutex.lock();
+    mBatchingPolicy = batchingPolicy;
+    mMutex.unlock();
+    mCommandListsAvailableCondition.notify_one();
+}
 
-    // Wait until the GPU has completed commands up to this fence point.
-    if (completedFenceValue < valueToWaitFor) {
-        const HANDLE eventHandle{ CreateEventEx(nullptr, nullptr, false, EVENT_ALL_ACCESS) };
-        BRE_ASSERT(eventHandle);
+std::uint32_t
+CommandListExecutor::GetExecutedCommandListCount() noexcept
+{
+    mMutex.lock();
+    const std::uint32_t executedCommandListCount = mExecutedCommandListCount;
+    mMutex.unlock();
 
-        // Fire event when GPU hits current fence.  
-        BRE_CHECK_HR(fence.SetEventOnCompletion(valueToWaitFor, eventHandle));
+    return executedCommandListCount;
+}
 
-        // Wait until the GPU hits current fence event is fired.
-        WaitForSingleObject(eventHandle, INFINITE);
-        CloseHandle(eventHandle);
+void
+CommandListExecutor::WaitForExecutedCommandListCount(const std::uint32_t commandListCount) noexcept
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (mExecutedCommandListCount >= commandListCount) {
+        return;
     }
+
+    // Batches that are not full must be executed while we wait.
+    ++mWaitingThreadCount;
+    mCommandListsAvailableCondition.notify_one();
+
+    const std::chrono::steady_clock::time_point beginTime = std::chrono::steady_clock::now();
+    mCommandListsExecutedCondition.wait(lock, [this, commandListCount]()
+    {
+        return mExecutedCommandListCount >= commandListCount;
+    });
+    mCallerWaitTimeInMicroseconds += GetElapsedTimeInMicroseconds(beginTime);
+
+    --mWaitingThreadCount;
+}
+
+std::uint32_t
+CommandListExecutor::ReserveCommandListSlots(const std::uint32_t slotCount) noexcept
+{
+    BRE_ASSERT(slotCount > 0U);
+
+    const std::uint32_t firstSlot = mNextSlotToReserve.fetch_add(slotCount);
+    BRE_ASSERT(firstSlot + slotCount - mNextSlotToExecute <= sCommandListSlotCount);
+
+    return firstSlot;
 }
 
 void
-CommandListExecutor::ExecuteCommandListAndWaitForCompletion(ID3D12CommandList& commandList) noexcept
+CommandListExecutor::PushCommandList(ID3D12CommandList& commandList,
+                                     const std::uint32_t slot) noexcept
 {
-    BRE_ASSERT(mCommandQueue != nullptr);
-    BRE_ASSERT(mFence != nullptr);
+    BRE_ASSERT(slot - mNextSlotToExecute < sCommandListSlotCount);
+    BRE_ASSERT(mCommandListBySlot[slot % sCommandListSlotCount] == nullptr);
+
+    mPushTimeBySlot[slot % sCommandListSlotCount] = std::chrono::steady_clock::now();
+    mCommandListBySlot[slot % sCommandListSlotCount] = &commandList;
+
+    // Lock before notify so the executor cannot miss the wake up
+    // between its empty() check and its wait.
+    mMutex.lock();
+    mMutex.unlock();
+    mCommandListsAvailableCondition.notify_one();
+}
 
+SubmissionFence
+CommandListExecutor::ExecuteCommandListAndWaitForCompletion(ID3D12CommandList& commandList,
+                                                            const CommandQueueType queueType) noexcept
+{
     ID3D12CommandList* commandLists[1U]{ &commandList };
-    mCommandQueue->ExecuteCommandLists(_countof(commandLists), commandLists);
+    const SubmissionFence submissionFence = mQueueSubmitter.Submit(queueType,
+                                                                   _countof(commandLists),
+                                                                   commandLists,
+                                                                   nullptr,
+                                                                   0U);
+    mQueueSubmitter.WaitForCompletion(submissionFence);
 
-    const std::uint64_t valueToSignal = mFence->GetCompletedValue() + 1UL;
-    SignalFenceAndWaitForCompletion(*mFence, valueToSignal, valueToSignal);
+    return submissionFence;
+}
+
+void
+CommandListExecutor::AddPushedCommandListDependency(const SubmissionFence& submissionFence) noexcept
+{
+    mMutex.lock();
+    mPushedCommandListDependencies.push_back(submissionFence);
+    mMutex.unlock();
 }
 
 void
 CommandListExecutor::Terminate() noexcept
 {
+    mMutex.lock();
     mTerminate = true;
-    parent()->wait_for_all();
+    mMutex.unlock();
+    mCommandListsAvailableCondition.notify_one();
+
+    BRE_ASSERT(mThread.joinable());
+    mThread.join();
 }
 }
\ No newline at end of file
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <d3d12.h>
-#include <tbb/concurrent_queue.h>
-#include <tbb/task.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
+#include <CommandListExecutor\CommandQueueSubmitter.h>
 #include <Utils\DebugUtils.h>
 
 namespace BRE {
@@ -13,23 +18,62 @@ namespace BRE {
 /// @brief Class responsible to execute command lists.
 ///
 /// To check for new command lists and execute them.
+/// Command lists are executed in slot order. Each command list occupies a slot
+/// that is reserved with ReserveCommandListSlots() (or implicitly when it is pushed with
+/// PushCommandList(commandList)), so command lists can be recorded and pushed in any order
+/// but they are always submitted in the order in which their slots were reserved.
+/// Pushed command lists are executed in the DIRECT queue. It also manages COMPUTE and COPY
+/// queues, where command lists can be submitted with ExecuteCommandLists(), and submissions
+/// of different queues are ordered with fences (see CommandQueueSubmitter).
+/// It runs on its own thread (not on a TBB worker), so the whole TBB pool is available
+/// to record command lists.
 /// Steps:
-/// - Use CommandListExecutor::Create() to create and spawn an instance.
-/// - When you spawn it, execute() method is automatically called. You should fill the queue with
-///   command lists. You can use CommandListExecutor::GetCommandListQueue() to get it.
-/// - When you want to terminate this task, you should call CommandListExecutor::Terminate() 
-class CommandListExecutor : public tbb::task {
+/// - Use CommandListExecutor::Create() to create an instance and start its thread.
+/// - You should push command lists through CommandListExecutor::PushCommandList().
+/// - When you want to terminate the thread, you should call CommandListExecutor::Terminate() 
+///
+class CommandListExecutor {
 public:
+    ///
+    /// @brief Policy to group ready command lists in ID3D12CommandQueue::ExecuteCommandLists() calls
+    ///
+    struct BatchingPolicy {
+        // The maximum number of command lists to execute by 
+        // ID3D12CommandQueue::ExecuteCommandLists(). It must be greater than zero.
+        std::uint32_t mMaxBatchSize{ 3U };
+
+        // When a batch is not full, time to wait for more ready command lists
+        // before it is executed. Zero means that it is executed immediately.
+        std::uint32_t mMaxWaitTimeInMicroseconds{ 0U };
+
+        // If it is true, then batches that are not full are only executed when
+        // the frame ends (a thread waits in WaitForExecutedCommandListCount()) or
+        // when mMaxWaitTimeInMicroseconds expires (if it is not zero).
+        bool mFlushOnFrameEnd{ false };
+    };
+
+    ///
+    /// @brief Counters of ID3D12CommandQueue::ExecuteCommandLists() calls
+    ///
+    struct BatchStatistics {
+        std::uint32_t mExecuteCallCount{ 0U };
+        std::uint32_t mExecutedCommandListCount{ 0U };
+        std::uint32_t mMaxCommandListCountPerCall{ 0U };
+
+        // Dwell time is the time since a command list is pushed until it is executed.
+        std::uint64_t mTotalDwellTimeInMicroseconds{ 0UL };
+        std::uint64_t mMaxDwellTimeInMicroseconds{ 0UL };
+    };
+
     ///
     /// @brief Create an instance of CommandListExecutor. 
     ///
-    /// This method must be called once.
+    /// This method must be called once. The executor thread is pinned according
+    /// ApplicationSettings::sCommandListExecutorThreadAffinityMask.
     ///
-    /// @param maxNumberOfCommandListsToExecute The maximum number of command lists to
-    /// execute by ID3D12CommandQueue::ExecuteCommandLists(). This parameter must be
-    /// greater than zero.
+    /// @param batchingPolicy Policy to group command lists in ID3D12CommandQueue::ExecuteCommandLists() calls
     ///
-    static void Create(const std::uint32_t maxNumberOfCommandListsToExecute) noexcept;
+    static void Create(const BatchingPolicy& batchingPolicy) noexcept;
 
     ///
     /// @brief Get CommandListExecutor. 
@@ -51,32 +95,109 @@ public:
     /// A thread safe way to know if CommandListExecutor finished processing and executing all the command lists.
     /// If you are going to execute N command lists, then you should:
     /// - Call ResetExecutedCommandListCount()
-    /// - Fill queue through GetCommandListQueue()
-    /// - Check if GetExecutedCommandListCount() is equal to N, to be sure all was executed properly (sent to GPU)
+    /// - Push command lists through PushCommandList()
+    /// - Call WaitForExecutedCommandListCount() with N, to be sure all was executed properly (sent to GPU)
+    /// Batch statistics are reset too, so they commonly contain the statistics of a single frame.
     ///
-    __forceinline void ResetExecutedCommandListCount() noexcept
-    {
-        mExecutedCommandListCount = 0U;
-    }
+    void ResetExecutedCommandListCount() noexcept;
+
+    ///
+    /// @brief Get the batch statistics since the last ResetExecutedCommandListCount()
+    /// @return Batch statistics
+    ///
+    BatchStatistics GetBatchStatistics() noexcept;
+
+    ///
+    /// @brief Set the batching policy.
+    ///
+    /// It is applied to the next batch.
+    ///
+    /// @param batchingPolicy Policy to group command lists in ID3D12CommandQueue::ExecuteCommandLists() calls
+    ///
+    void SetBatchingPolicy(const BatchingPolicy& batchingPolicy) noexcept;
 
     ///
     /// @brief Get the number of executed command lists.
     ///
     /// @return The number of executed command lists
     ///
-    __forceinline std::uint32_t GetExecutedCommandListCount() const noexcept
-    {
-        return mExecutedCommandListCount;
-    }
+    std::uint32_t GetExecutedCommandListCount() noexcept;
+
+    ///
+    /// @brief Blocks the calling thread until the number of executed command lists reaches a value.
+    ///
+    /// The calling thread sleeps until CommandListExecutor notifies that new command lists were executed,
+    /// instead of spinning over GetExecutedCommandListCount(). While a thread waits, batches that are not 
+    /// full are executed without waiting, so this is the frame end for BatchingPolicy::mFlushOnFrameEnd.
+    ///
+    /// @param commandListCount The number of executed command lists to wait for.
+    ///
+    void WaitForExecutedCommandListCount(const std::uint32_t commandListCount) noexcept;
+
+    ///
+    /// @brief Reserve contiguous command list slots
+    ///
+    /// Command lists are submitted in slot order. Reserve slots in the order you want
+    /// command lists to be executed, record them at any pace (for example, in parallel),
+    /// and push each of them with PushCommandList(commandList, slot).
+    /// Every reserved slot must be pushed, or the following command lists will never be executed.
+    ///
+    /// @param slotCount The number of slots to reserve. It must be greater than zero.
+    /// @return The first reserved slot. Reserved slots are [first slot, first slot + @p slotCount)
+    ///
+    std::uint32_t ReserveCommandListSlots(const std::uint32_t slotCount) noexcept;
+
+    ///
+    /// @brief Push a command list to be executed in a reserved slot
+    ///
+    /// It wakes up CommandListExecutor if it was waiting for this slot.
+    ///
+    /// @param commandList The command list to add
+    /// @param slot The slot reserved with ReserveCommandListSlots()
+    ///
+    void PushCommandList(ID3D12CommandList& commandList,
+                         const std::uint32_t slot) noexcept;
 
     ///
     /// @brief Push a command list to be executed
     ///
+    /// It reserves the next slot, so the command list is executed after
+    /// all the command lists whose slots were already reserved.
+    ///
     /// @param commandList The command list to add
     ///
     __forceinline void PushCommandList(ID3D12CommandList& commandList) noexcept
     {
-        mCommandListsToExecute.push(&commandList);
+        PushCommandList(commandList, ReserveCommandListSlots(1U));
+    }
+
+    ///
+    /// @brief Get the accumulated time CommandListExecutor waited for command lists to execute.
+    ///
+    /// @return Time in microseconds
+    ///
+    __forceinline std::uint64_t GetExecutorWaitTimeInMicroseconds() const noexcept
+    {
+        return mExecutorWaitTimeInMicroseconds;
+    }
+
+    ///
+    /// @brief Get the accumulated time threads waited inside WaitForExecutedCommandListCount().
+    ///
+    /// @return Time in microseconds
+    ///
+    __forceinline std::uint64_t GetCallerWaitTimeInMicroseconds() const noexcept
+    {
+        return mCallerWaitTimeInMicroseconds;
+    }
+
+    ///
+    /// @brief Reset the wait time counters
+    ///
+    __forceinline void ResetWaitTimeCounters() noexcept
+    {
+        mExecutorWaitTimeInMicroseconds = 0UL;
+        mCallerWaitTimeInMicroseconds = 0UL;
     }
 
     ///
@@ -91,48 +212,151 @@ public:
     }
 
     ///
-    /// @brief Signal a fence and wait until fence completes.
+    /// @brief Submit command lists to a command queue right now.
+    ///
+    /// Unlike PushCommandList(), command lists are not ordered by slots. It is thread safe.
     ///
-    /// @param fence The fence to be updated
-    /// @param valueToSignal The value used to update @p fence
-    /// @param valueToWaitFor The value that @p fence must reach before we 
-    /// return from this method. Commonly, this will be equal to @p valueToSignal.
+    /// @param queueType Queue type. If there is no queue of this type, then DIRECT is used.
+    /// @param commandListCount The number of command lists
+    /// @param commandLists Command lists to execute. Their type must match the selected queue type.
+    /// @param dependencies Submissions that must complete in the GPU before the command lists are executed
+    /// @param dependencyCount The number of dependencies
+    /// @return Fence of this submission
     ///
-    void SignalFenceAndWaitForCompletion(ID3D12Fence& fence,
-                                         const std::uint64_t valueToSignal,
-                                         const std::uint64_t valueToWaitFor) noexcept;
+    __forceinline SubmissionFence ExecuteCommandLists(const CommandQueueType queueType,
+                                                      const std::uint32_t commandListCount,
+                                                      ID3D12CommandList* const* commandLists,
+                                                      const SubmissionFence* dependencies,
+                                                      const std::uint32_t dependencyCount) noexcept
+    {
+        return mQueueSubmitter.Submit(queueType, commandListCount, commandLists, dependencies, dependencyCount);
+    }
+
+    ///
+    /// @brief Make the next pushed command lists wait for a submission.
+    ///
+    /// The DIRECT queue waits (in the GPU) for @p submissionFence before it executes the next 
+    /// batch of pushed command lists. Call it before you push the command lists that depend on it.
+    ///
+    /// @param submissionFence Fence returned by ExecuteCommandLists()
+    ///
+    void AddPushedCommandListDependency(const SubmissionFence& submissionFence) noexcept;
+
+    ///
+    /// @brief Checks if a submission completed in the GPU
+    /// @param submissionFence Fence returned by ExecuteCommandLists()
+    /// @return True if it completed. Otherwise, false.
+    ///
+    __forceinline bool IsComplete(const SubmissionFence& submissionFence) noexcept
+    {
+        return mQueueSubmitter.IsComplete(submissionFence);
+    }
+
+    ///
+    /// @brief Blocks the calling thread until a submission completes in the GPU
+    /// @param submissionFence Fence returned by ExecuteCommandLists()
+    ///
+    __forceinline void WaitForCompletion(const SubmissionFence& submissionFence) noexcept
+    {
+        mQueueSubmitter.WaitForCompletion(submissionFence);
+    }
 
     ///
     /// @brief Executes a command list and wait until it completes
     ///
     /// @param commandList The command list to be executed
-    void ExecuteCommandListAndWaitForCompletion(ID3D12CommandList& commandList) noexcept;
+    /// @param queueType Queue type. Its type must match the type of @p commandList.
+    /// @return Fence of the submission, already completed
+    ///
+    SubmissionFence ExecuteCommandListAndWaitForCompletion(ID3D12CommandList& commandList,
+                                                           const CommandQueueType queueType = CommandQueueType::DIRECT) noexcept;
 
     ///
     /// @brief Terminates the generated CommandListExecutor.
     ///
+    /// It waits until the executor thread finishes.
+    ///
     void Terminate() noexcept;
 
 private:
     ///
     /// @brief CommandListExecutor constructor
-    /// @param maxNumCommandLists Maximum number of command lists to execute at once
+    /// @param batchingPolicy Policy to group command lists in ID3D12CommandQueue::ExecuteCommandLists() calls
+    ///
+    explicit CommandListExecutor(const BatchingPolicy& batchingPolicy);
+
+    ///
+    /// @brief Executes pushed command lists until Terminate() is called.
+    ///
+    /// This method runs in the executor thread.
+    ///
+    void ExecuteCommandListsLoop() noexcept;
+
+    ///
+    /// @brief Takes command lists from the contiguous range of ready slots
+    /// @param maxCommandListCount Maximum number of command lists to take
     ///
-    explicit CommandListExecutor(const std::uint32_t maxNumCommandLists);
+    void TakeReadyCommandLists(const std::uint32_t maxCommandListCount) noexcept;
 
-    // Called when tbb::task is spawned
-    tbb::task* execute() final override;
+    ///
+    /// @brief Checks if the command list of the next slot to execute was already pushed
+    /// @return True if it was pushed. Otherwise, false.
+    ///
+    __forceinline bool IsNextSlotReady() const noexcept
+    {
+        return mCommandListBySlot[mNextSlotToExecute % sCommandListSlotCount] != nullptr;
+    }
 
     static CommandListExecutor* sExecutor;
 
+    std::thread mThread;
+
+    // Maximum number of reserved slots that are not executed yet.
+    static const std::uint32_t sCommandListSlotCount{ 4096U };
+
     bool mTerminate{ false };
 
+    // Guards mTerminate, mExecutedCommandListCount, mBatchingPolicy, mBatchStatistics,
+    // mWaitingThreadCount, and mPushedCommandListDependencies, and it is used by the condition variables.
+    std::mutex mMutex;
+
+    BatchingPolicy mBatchingPolicy;
+    BatchStatistics mBatchStatistics;
+
+    // Number of threads waiting in WaitForExecutedCommandListCount()
+    std::uint32_t mWaitingThreadCount{ 0U };
+
+    // Submissions that the next batch of pushed command lists depends on.
+    std::vector<SubmissionFence> mPushedCommandListDependencies;
+
+    // Notified when new command lists are pushed or when we must terminate.
+    std::condition_variable mCommandListsAvailableCondition;
+
+    // Notified when command lists are executed.
+    std::condition_variable mCommandListsExecutedCondition;
+
+    std::atomic<std::uint64_t> mExecutorWaitTimeInMicroseconds{ 0UL };
+    std::atomic<std::uint64_t> mCallerWaitTimeInMicroseconds{ 0UL };
+
     std::uint32_t mExecutedCommandListCount{ 0U };
-    std::atomic<std::uint32_t> mPendingCommandListCount{ 0U };
-    std::uint32_t mMaxNumberOfCommandListsToExecute{ 1U };
 
+    // Command lists of the batch being built, and their push times.
+    // They are only used by the executor thread.
+    std::vector<ID3D12CommandList*> mPendingCommandLists;
+    std::vector<std::chrono::steady_clock::time_point> mPendingCommandListPushTimes;
+    std::vector<SubmissionFence> mPendingDependencies;
+
+    // DIRECT command queue
     ID3D12CommandQueue* mCommandQueue{ nullptr };
-    tbb::concurrent_queue<ID3D12CommandList*> mCommandListsToExecute;
-    ID3D12Fence* mFence{ nullptr };
+
+    std::unique_ptr<D3D12SubmissionQueue> mSubmissionQueueByType[static_cast<std::uint32_t>(CommandQueueType::COUNT)];
+    CommandQueueSubmitter mQueueSubmitter;
+
+    // Reorder buffer. Slot N is stored at N % sCommandListSlotCount, and it is
+    // nullptr until its command list is pushed.
+    std::atomic<ID3D12CommandList*> mCommandListBySlot[sCommandListSlotCount];
+    std::chrono::steady_clock::time_point mPushTimeBySlot[sCommandListSlotCount];
+    std::atomic<std::uint32_t> mNextSlotToReserve{ 0U };
+    std::atomic<std::uint32_t> mNextSlotToExecute{ 0U };
 };
 }
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "CommandQueueSubmitter.h"
+
+namespace BRE {
+D3D12SubmissionQueue::D3D12SubmissionQueue(ID3D12CommandQueue& commandQueue,
+                                           ID3D12Fence& fence)
+    : mCommandQueue(commandQueue)
+    , mFenceTimeline(fence)
+{}
+
+void
+D3D12SubmissionQueue::ExecuteCommandLists(const std::uint32_t commandListCount,
+                                          ID3D12CommandList* const* commandLists) noexcept
+{
+    BRE_ASSERT(commandListCount > 0U);
+    BRE_ASSERT(commandLists != nullptr);
+
+    mCommandQueue.ExecuteCommandLists(commandListCount, commandLists);
+}
+
+void
+D3D12SubmissionQueue::Signal(const std::uint64_t fenceValue) noexcept
+{
+    const std::uint64_t signaledValue = mFenceTimeline.Signal(mCommandQueue);
+    BRE_ASSERT(signaledValue == fenceValue);
+    UNREFERENCED_PARAMETER(signaledValue);
+    UNREFERENCED_PARAMETER(fenceValue);
+}
+
+void
+D3D12SubmissionQueue::Wait(SubmissionQueue& queue,
+                           const std::uint64_t fenceValue) noexcept
+{
+    // All the queues of a CommandQueueSubmitter have the same implementation
+    D3D12SubmissionQueue& d3d12Queue = static_cast<D3D12SubmissionQueue&>(queue);
+    BRE_CHECK_HR(mCommandQueue.Wait(&d3d12Queue.mFenceTimeline.GetFence(), fenceValue));
+}
+
+std::uint64_t
+D3D12SubmissionQueue::GetCompletedFenceValue() noexcept
+{
+    return mFenceTimeline.GetFence().GetCompletedValue();
+}
+
+void
+D3D12SubmissionQueue::WaitForFenceValue(const std::uint64_t fenceValue) noexcept
+{
+    mFenceTimeline.WaitForValue(fenceValue);
+}
+
+void
+CommandQueueSubmitter::SetQueue(const CommandQueueType queueType,
+                                SubmissionQueue& queue) noexcept
+{
+    BRE_ASSERT(queueType < CommandQueueType::COUNT);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    BRE_ASSERT(mQueues[static_cast<std::uint32_t>(queueType)] == nullptr);
+    mQueues[static_cast<std::uint32_t>(queueType)] = &queue;
+}
+
+CommandQueueType
+CommandQueueSubmitter::SelectQueueType(const CommandQueueType queueType) noexcept
+{
+    BRE_ASSERT(queueType < CommandQueueType::COUNT);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    BRE_ASSERT(mQueues[static_cast<std::uint32_t>(CommandQueueType::DIRECT)] != nullptr);
+
+    return mQueues[static_cast<std::uint32_t>(queueType)] != nullptr ? queueType : CommandQueueType::DIRECT;
+}
+
+SubmissionFence
+CommandQueueSubmitter::Submit(const CommandQueueType queueType,
+                              const std::uint32_t commandListCount,
+                              ID3D12CommandList* const* commandLists,
+                              const SubmissionFence* dependencies,
+                              const std::uint32_t dependencyCount) noexcept
+{
+    BRE_ASSERT(commandListCount == 0U || commandLists != nullptr);
+    BRE_ASSERT(dependencyCount == 0U || dependencies != nullptr);
+
+    const CommandQueueType selectedQueueType = SelectQueueType(queueType);
+    const std::uint32_t queueIndex = static_cast<std::uint32_t>(selectedQueueType);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    SubmissionQueue& queue = GetQueue(selectedQueueType);
+
+    // GPU waits must be enqueued before the command lists that depend on them.
+    // Submissions to the same queue are already ordered.
+    for (std::uint32_t i = 0U; i < dependencyCount; ++i) {
+        const SubmissionFence& dependency = dependencies[i];
+        const std::uint32_t dependencyQueueIndex = static_cast<std::uint32_t>(dependency.mQueueType);
+        BRE_ASSERT(dependencyQueueIndex < sQueueTypeCount);
+        BRE_ASSERT(dependency.mFenceValue <= mLastSignaledFenceValue[dependencyQueueIndex]);
+
+        if (dependencyQueueIndex == queueIndex ||
+            dependency.mFenceValue <= mWaitedFenceValue[queueIndex][dependencyQueueIndex]) {
+            continue;
+        }
+
+        queue.Wait(GetQueue(dependency.mQueueType), dependency.mFenceValue);
+        mWaitedFenceValue[queueIndex][dependencyQueueIndex] = dependency.mFenceValue;
+    }
+
+    if (commandListCount > 0U) {
+        queue.ExecuteCommandLists(commandListCount, commandLists);
+    }
+
+    SubmissionFence submissionFence;
+    submissionFence.mQueueType = selectedQueueType;
+    submissionFence.mFenceValue = ++mLastSignaledFenceValue[queueIndex];
+    queue.Signal(submissionFence.mFenceValue);
+
+    return submissionFence;
+}
+
+bool
+CommandQueueSubmitter::IsComplete(const SubmissionFence& submissionFence) noexcept
+{
+    SubmissionQueue* queue;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        queue = &GetQueue(submissionFence.mQueueType);
+    }
+
+    return queue->GetCompletedFenceValue() >= submissionFence.mFenceValue;
+}
+
+void
+CommandQueueSubmitter::WaitForCompletion(const SubmissionFence& submissionFence) noexcept
+{
+    SubmissionQueue* queue;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        queue = &GetQueue(submissionFence.mQueueType);
+    }
+
+    queue->WaitForFenceValue(submissionFence.mFenceValue);
+}
+
+SubmissionFence
+CommandQueueSubmitter::GetLastSubmissionFence(const CommandQueueType queueType) noexcept
+{
+    const CommandQueueType selectedQueueType = SelectQueueType(queueType);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    SubmissionFence submissionFence;
+    submissionFence.mQueueType = selectedQueueType;
+    submissionFence.mFenceValue = mLastSignaledFenceValue[static_cast<std::uint32_t>(selectedQueueType)];
+
+    return submissionFence;
+}
+
+SubmissionQueue&
+CommandQueueSubmitter::GetQueue(const CommandQueueType queueType) noexcept
+{
+    BRE_ASSERT(queueType < CommandQueueType::COUNT);
+
+    SubmissionQueue* queue = mQueues[static_cast<std::uint32_t>(queueType)];
+    BRE_ASSERT(queue != nullptr);
+
+    return *queue;
+}
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <mutex>
+
+#include <CommandManager\FenceTimeline.h>
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+///
+/// @brief Type of command queue where command lists are submitted
+///
+enum class CommandQueueType : std::uint32_t {
+    DIRECT = 0U,
+    COMPUTE,
+    COPY,
+    COUNT
+};
+
+///
+/// @brief Fence value signaled by a command queue after a submission.
+///
+/// It is used to express that a submission depends on another submission.
+///
+struct SubmissionFence {
+    CommandQueueType mQueueType{ CommandQueueType::DIRECT };
+    std::uint64_t mFenceValue{ 0UL };
+};
+
+///
+/// @brief Command queue used by CommandQueueSubmitter.
+///
+/// Each submission queue owns a fence that it signals with increasing values.
+/// D3D12SubmissionQueue implements it over ID3D12CommandQueue and ID3D12Fence,
+/// and it can be implemented by stand-in queues (for example, in unit tests).
+///
+class SubmissionQueue {
+public:
+    SubmissionQueue() = default;
+    virtual ~SubmissionQueue() = default;
+    SubmissionQueue(const SubmissionQueue&) = delete;
+    const SubmissionQueue& operator=(const SubmissionQueue&) = delete;
+    SubmissionQueue(SubmissionQueue&&) = delete;
+    SubmissionQueue& operator=(SubmissionQueue&&) = delete;
+
+    ///
+    /// @brief Execute command lists
+    /// @param commandListCount The number of command lists
+    /// @param commandLists Command lists to execute
+    ///
+    virtual void ExecuteCommandLists(const std::uint32_t commandListCount,
+                                     ID3D12CommandList* const* commandLists) noexcept = 0;
+
+    ///
+    /// @brief Signal the fence of this queue when previous work completes
+    /// @param fenceValue Value to signal
+    ///
+    virtual void Signal(const std::uint64_t fenceValue) noexcept = 0;
+
+    ///
+    /// @brief Make this queue wait (in the GPU) until the fence of another queue reaches a value
+    /// @param queue Queue whose fence we wait for
+    /// @param fenceValue Fence value to wait for
+    ///
+    virtual void Wait(SubmissionQueue& queue,
+                      const std::uint64_t fenceValue) noexcept = 0;
+
+    ///
+    /// @brief Get the completed value of the fence of this queue
+    /// @return Completed fence value
+    ///
+    virtual std::uint64_t GetCompletedFenceValue() noexcept = 0;
+
+    ///
+    /// @brief Blocks the calling thread until the fence of this queue reaches a value
+    /// @param fenceValue Fence value to wait for
+    ///
+    virtual void WaitForFenceValue(const std::uint64_t fenceValue) noexcept = 0;
+};
+
+///
+/// @brief SubmissionQueue implemented over ID3D12CommandQueue and a FenceTimeline
+///
+class D3D12SubmissionQueue : public SubmissionQueue {
+public:
+    ///
+    /// @brief D3D12SubmissionQueue constructor
+    /// @param commandQueue Command queue
+    /// @param fence Fence of the timeline. It must only be signaled by @p commandQueue
+    ///
+    D3D12SubmissionQueue(ID3D12CommandQueue& commandQueue,
+                         ID3D12Fence& fence);
+
+    void ExecuteCommandLists(const std::uint32_t commandListCount,
+                             ID3D12CommandList* const* commandLists) noexcept final override;
+
+    void Signal(const std::uint64_t fenceValue) noexcept final override;
+
+    void Wait(SubmissionQueue& queue,
+              const std::uint64_t fenceValue) noexcept final override;
+
+    std::uint64_t GetCompletedFenceValue() noexcept final override;
+
+    void WaitForFenceValue(const std::uint64_t fenceValue) noexcept final override;
+
+    __forceinline ID3D12CommandQueue& GetCommandQueue() noexcept
+    {
+        return mCommandQueue;
+    }
+
+private:
+    ID3D12CommandQueue& mCommandQueue;
+    FenceTimeline mFenceTimeline;
+};
+
+///
+/// @brief Submits command lists to typed command queues and orders them with fences.
+///
+/// It does not depend on the device, so queue selection and fence dependency ordering
+/// can be tested with stand-in SubmissionQueue implementations.
+/// Every submission signals the fence of its queue, and dependencies on other queues
+/// are expressed as GPU waits on their fences. Redundant waits (the same queue already
+/// waited for a greater or equal fence value) are skipped.
+/// All the methods are thread safe.
+///
+class CommandQueueSubmitter {
+public:
+    CommandQueueSubmitter() = default;
+    ~CommandQueueSubmitter() = default;
+    CommandQueueSubmitter(const CommandQueueSubmitter&) = delete;
+    const CommandQueueSubmitter& operator=(const CommandQueueSubmitter&) = delete;
+    CommandQueueSubmitter(CommandQueueSubmitter&&) = delete;
+    CommandQueueSubmitter& operator=(CommandQueueSubmitter&&) = delete;
+
+    ///
+    /// @brief Set the queue of a type
+    ///
+    /// The DIRECT queue must be set before any submission. It must be called once per type.
+    ///
+    /// @param queueType Queue type
+    /// @param queue Queue
+    ///
+    void SetQueue(const CommandQueueType queueType,
+                  SubmissionQueue& queue) noexcept;
+
+    ///
+    /// @brief Select the queue type where command lists of a type are submitted.
+    ///
+    /// If there is no queue of @p queueType, then DIRECT is selected,
+    /// as it can execute all types of command lists.
+    ///
+    /// @param queueType Requested queue type
+    /// @return Selected queue type
+    ///
+    CommandQueueType SelectQueueType(const CommandQueueType queueType) noexcept;
+
+    ///
+    /// @brief Submit command lists.
+    ///
+    /// The selected queue waits for all the dependencies, then it executes the command lists
+    /// and it signals its fence.
+    ///
+    /// @param queueType Requested queue type. See SelectQueueType()
+    /// @param commandListCount The number of command lists. It can be zero to only wait and signal.
+    /// @param commandLists Command lists to execute
+    /// @param dependencies Submissions that must complete before the command lists are executed
+    /// @param dependencyCount The number of dependencies
+    /// @return Fence of this submission
+    ///
+    SubmissionFence Submit(const CommandQueueType queueType,
+                           const std::uint32_t commandListCount,
+                           ID3D12CommandList* const* commandLists,
+                           const SubmissionFence* dependencies,
+                           const std::uint32_t dependencyCount) noexcept;
+
+    ///
+    /// @brief Checks if a submission completed in the GPU
+    /// @param submissionFence Fence of the submission
+    /// @return True if it completed. Otherwise, false.
+    ///
+    bool IsComplete(const SubmissionFence& submissionFence) noexcept;
+
+    ///
+    /// @brief Blocks the calling thread until a submission completes in the GPU
+    /// @param submissionFence Fence of the submission
+    ///
+    void WaitForCompletion(const SubmissionFence& submissionFence) noexcept;
+
+    ///
+    /// @brief Get the fence of the last submission to a queue
+    /// @param queueType Queue type. See SelectQueueType()
+    /// @return Submission fence. Its fence value is zero if there were no submissions.
+    ///
+    SubmissionFence GetLastSubmissionFence(const CommandQueueType queueType) noexcept;
+
+private:
+    ///
+    /// @brief Get a queue
+    ///
+    /// mMutex must be locked.
+    ///
+    /// @param queueType Queue type. It must be a selected queue type.
+    /// @return Queue
+    ///
+    SubmissionQueue& GetQueue(const CommandQueueType queueType) noexcept;
+
+    static const std::uint32_t sQueueTypeCount{ static_cast<std::uint32_t>(CommandQueueType::COUNT) };
+
+    std::mutex mMutex;
+
+    SubmissionQueue* mQueues[sQueueTypeCount]{ nullptr };
+
+    std::uint64_t mLastSignaledFenceValue[sQueueTypeCount]{ 0UL };
+
+    // The greatest fence value of queue B that queue A already waits for is
+    // stored in mWaitedFenceValue[A][B]
+    std::uint64_t mWaitedFenceValue[sQueueTypeCount][sQueueTypeCount]{ 0UL };
+};
+}
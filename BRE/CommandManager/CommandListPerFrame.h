@@ -1,8 +1,7 @@
 #pragma once
 
-#include <cstdint>
+#include <d3d12.h>
 
-#include <ApplicationSettings\ApplicationSettings.h>
 #include <Utils\DebugUtils.h>
 
 namespace BRE {
@@ -10,12 +9,13 @@ namespace BRE {
 /// @brief Provides support of command lists for different frames.
 ///
 /// We support to have different number of queued frames.
-/// This class provides a command list that can be reset with 
-/// a different command allocator per queued frame.
+/// This class provides a command list that is acquired from CommandListPool every
+/// time it is reset, so it does not own command allocators, and it can be reset
+/// several times per frame.
 ///
 class CommandListPerFrame {
 public:
-    CommandListPerFrame();
+    CommandListPerFrame() = default;
     ~CommandListPerFrame() = default;
     CommandListPerFrame(const CommandListPerFrame&) = delete;
     const CommandListPerFrame& operator=(const CommandListPerFrame&) = delete;
@@ -23,14 +23,14 @@ public:
     CommandListPerFrame& operator=(CommandListPerFrame&&) = default;
 
     ///
-    /// @brief Reset command list with the command allocator for the next frame
+    /// @brief Acquire a command list reset with a free command allocator
     /// @param pso Pipeline state object to reset the command list
-    /// @return The reset command list
+    /// @return The reset command list. It is valid until CommandListPool releases it.
     ///
     ID3D12GraphicsCommandList& ResetCommandListWithNextCommandAllocator(ID3D12PipelineState* pso) noexcept;
 
     ///
-    /// @brief Get the command list
+    /// @brief Get the last acquired command list
     /// @return The command list
     ///
     __forceinline ID3D12GraphicsCommandList& GetCommandList() noexcept
@@ -40,9 +40,7 @@ public:
     }
 
 private:
-    ID3D12CommandAllocator* mCommandAllocators[ApplicationSettings::sQueuedFrameCount]{ nullptr };
     ID3D12GraphicsCommandList* mCommandList{ nullptr };
-    std::uint32_t mCurrentFrameIndex{ 0U };
 };
 }
 
@@ -0,0 +1,114 @@
+#include "CommandListPool.h"
+
+#include <CommandManager/CommandAllocatorManager.h>
+#include <CommandManager/CommandListManager.h>
+#include <CommandManager/FenceTimeline.h>
+#include <Utils/DebugUtils.h>
+
+namespace BRE {
+std::deque<CommandListPool::TrackedCommandAllocator> CommandListPool::mReleasedCommandAllocators;
+std::vector<ID3D12CommandAllocator*> CommandListPool::mAcquiredCommandAllocators;
+std::vector<ID3D12GraphicsCommandList*> CommandListPool::mFreeCommandLists;
+std::vector<ID3D12GraphicsCommandList*> CommandListPool::mAcquiredCommandLists;
+CommandListPool::Statistics CommandListPool::mStatistics;
+std::mutex CommandListPool::mMutex;
+
+void
+CommandListPool::Clear() noexcept
+{
+    mMutex.lock();
+    mReleasedCommandAllocators.clear();
+    mAcquiredCommandAllocators.clear();
+    mFreeCommandLists.clear();
+    mAcquiredCommandLists.clear();
+    mStatistics = Statistics();
+    mMutex.unlock();
+}
+
+ID3D12GraphicsCommandList&
+CommandListPool::AcquireCommandList(ID3D12PipelineState* pso) noexcept
+{
+    ID3D12CommandAllocator* commandAllocator{ nullptr };
+    ID3D12GraphicsCommandList* commandList{ nullptr };
+
+    mMutex.lock();
+    // Released command allocators are ordered by fence value, so if the oldest one
+    // is not complete, then none of them is complete.
+    if (mReleasedCommandAllocators.empty() == false) {
+        const TrackedCommandAllocator& trackedCommandAllocator = mReleasedCommandAllocators.front();
+        BRE_ASSERT(trackedCommandAllocator.mFenceTimeline != nullptr);
+        if (trackedCommandAllocator.mFenceTimeline->IsComplete(trackedCommandAllocator.mFenceValue)) {
+            commandAllocator = trackedCommandAllocator.mCommandAllocator;
+            mReleasedCommandAllocators.pop_front();
+        }
+    }
+
+    if (mFreeCommandLists.empty() == false) {
+        commandList = mFreeCommandLists.back();
+        mFreeCommandLists.pop_back();
+    }
+    mMutex.unlock();
+
+    const bool isNewCommandAllocator = commandAllocator == nullptr;
+    if (isNewCommandAllocator) {
+        commandAllocator = &CommandAllocatorManager::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
+    } else {
+        BRE_CHECK_HR(commandAllocator->Reset());
+    }
+
+    const bool isNewCommandList = commandList == nullptr;
+    if (isNewCommandList) {
+        // Command lists are created in recording state, so we close it to reset it below.
+        commandList = &CommandListManager::CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, *commandAllocator);
+        commandList->Close();
+    }
+
+    BRE_CHECK_HR(commandList->Reset(commandAllocator, pso));
+
+    mMutex.lock();
+    mAcquiredCommandAllocators.push_back(commandAllocator);
+    mAcquiredCommandLists.push_back(commandList);
+
+    mStatistics.mCommandAllocatorCount += isNewCommandAllocator ? 1U : 0U;
+    mStatistics.mCommandListCount += isNewCommandList ? 1U : 0U;
+    const std::uint32_t acquiredCommandListCount = static_cast<std::uint32_t>(mAcquiredCommandLists.size());
+    if (acquiredCommandListCount > mStatistics.mMaxCommandListCountPerRelease) {
+        mStatistics.mMaxCommandListCountPerRelease = acquiredCommandListCount;
+    }
+    mMutex.unlock();
+
+    return *commandList;
+}
+
+void
+CommandListPool::ReleaseCommandLists(FenceTimeline& fenceTimeline,
+                                     const std::uint64_t fenceValue) noexcept
+{
+    mMutex.lock();
+    BRE_ASSERT(mReleasedCommandAllocators.empty() || mReleasedCommandAllocators.back().mFenceValue <= fenceValue);
+
+    TrackedCommandAllocator trackedCommandAllocator;
+    trackedCommandAllocator.mFenceTimeline = &fenceTimeline;
+    trackedCommandAllocator.mFenceValue = fenceValue;
+    for (ID3D12CommandAllocator* commandAllocator : mAcquiredCommandAllocators) {
+        trackedCommandAllocator.mCommandAllocator = commandAllocator;
+        mReleasedCommandAllocators.push_back(trackedCommandAllocator);
+    }
+    mAcquiredCommandAllocators.clear();
+
+    mFreeCommandLists.insert(mFreeCommandLists.end(), mAcquiredCommandLists.begin(), mAcquiredCommandLists.end());
+    mAcquiredCommandLists.clear();
+    mMutex.unlock();
+}
+
+CommandListPool::Statistics
+CommandListPool::GetStatistics() noexcept
+{
+    mMutex.lock();
+    Statistics statistics(mStatistics);
+    statistics.mPendingCommandAllocatorCount = static_cast<std::uint32_t>(mReleasedCommandAllocators.size());
+    mMutex.unlock();
+
+    return statistics;
+}
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace BRE {
+class FenceTimeline;
+
+///
+/// @brief Pool of direct command allocators and command lists shared by all the passes
+///
+/// Command allocators are not owned by recorders. Every acquired command list is reset with
+/// a free command allocator, and at the end of the frame all the acquired command allocators
+/// are tagged with the fence value of that frame. They are only recycled once that value
+/// completes, so there can be any number of command lists per frame and the number of
+/// command allocators is bounded by the number of command lists in flight.
+/// Steps:
+/// - Record command lists with AcquireCommandList() (from any thread)
+/// - Push them to the CommandListExecutor
+/// - Once they were executed, call ReleaseCommandLists() with the fence value signaled after them
+///
+class CommandListPool {
+public:
+    CommandListPool() = delete;
+    ~CommandListPool() = delete;
+    CommandListPool(const CommandListPool&) = delete;
+    const CommandListPool& operator=(const CommandListPool&) = delete;
+    CommandListPool(CommandListPool&&) = delete;
+    CommandListPool& operator=(CommandListPool&&) = delete;
+
+    ///
+    /// @brief Pool counters
+    ///
+    /// D3D12 does not expose the memory of a command allocator, so the command allocator
+    /// high-water marks are expressed in number of command allocators.
+    ///
+    struct Statistics {
+        // Created command allocators and command lists. The pool never destroys them,
+        // so they are also their high-water marks.
+        std::uint32_t mCommandAllocatorCount{ 0U };
+        std::uint32_t mCommandListCount{ 0U };
+
+        // Released command allocators that wait for their fence value.
+        std::uint32_t mPendingCommandAllocatorCount{ 0U };
+
+        // Command lists acquired between two ReleaseCommandLists() calls.
+        std::uint32_t mMaxCommandListCountPerRelease{ 0U };
+    };
+
+    ///
+    /// @brief Clear the pool
+    ///
+    /// Command allocators and command lists are released by
+    /// CommandAllocatorManager and CommandListManager
+    ///
+    static void Clear() noexcept;
+
+    ///
+    /// @brief Acquire a direct command list reset with a free command allocator
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param pso Pipeline state object to reset the command list
+    /// @return The reset command list
+    ///
+    static ID3D12GraphicsCommandList& AcquireCommandList(ID3D12PipelineState* pso) noexcept;
+
+    ///
+    /// @brief Release all the command lists acquired since the last call.
+    ///
+    /// Command lists can be acquired again immediately, as they were already executed,
+    /// but their command allocators are recycled once @p fenceValue completes.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue where the command lists were executed
+    /// @param fenceValue Fence value signaled after the command lists were executed
+    ///
+    static void ReleaseCommandLists(FenceTimeline& fenceTimeline,
+                                    const std::uint64_t fenceValue) noexcept;
+
+    ///
+    /// @brief Get the pool statistics
+    /// @return Statistics
+    ///
+    static Statistics GetStatistics() noexcept;
+
+private:
+    struct TrackedCommandAllocator {
+        ID3D12CommandAllocator* mCommandAllocator{ nullptr };
+        FenceTimeline* mFenceTimeline{ nullptr };
+        std::uint64_t mFenceValue{ 0UL };
+    };
+
+    // Released command allocators ordered by fence value
+    static std::deque<TrackedCommandAllocator> mReleasedCommandAllocators;
+    static std::vector<ID3D12CommandAllocator*> mAcquiredCommandAllocators;
+
+    static std::vector<ID3D12GraphicsCommandList*> mFreeCommandLists;
+    static std::vector<ID3D12GraphicsCommandList*> mAcquiredCommandLists;
+
+    static Statistics mStatistics;
+
+    static std::mutex mMutex;
+};
+}
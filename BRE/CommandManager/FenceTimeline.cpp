@@ -0,0 +1,83 @@
+#include "FenceTimeline.h"
+
+#include <CommandManager\WaitEventPool.h>
+
+namespace BRE {
+FenceTimeline::FenceTimeline(ID3D12Fence& fence)
+    : mFence(fence)
+    , mLastSignaledValue(fence.GetCompletedValue())
+    , mLastCompletedValue(fence.GetCompletedValue())
+{}
+
+std::uint64_t
+FenceTimeline::Signal(ID3D12CommandQueue& commandQueue) noexcept
+{
+    std::lock_guard<std::mutex> lock(mSignalMutex);
+
+    const std::uint64_t value = mLastSignaledValue + 1UL;
+    BRE_CHECK_HR(commandQueue.Signal(&mFence, value));
+    mLastSignaledValue = value;
+
+    return value;
+}
+
+bool
+FenceTimeline::IsComplete(const std::uint64_t value) noexcept
+{
+    BRE_ASSERT(value <= mLastSignaledValue);
+
+    if (value <= mLastCompletedValue) {
+        return true;
+    }
+
+    // Update the cache. Other threads could have updated it with a greater value.
+    const std::uint64_t completedValue = mFence.GetCompletedValue();
+    std::uint64_t lastCompletedValue = mLastCompletedValue;
+    while (lastCompletedValue < completedValue &&
+           mLastCompletedValue.compare_exchange_weak(lastCompletedValue, completedValue) == false) {
+    }
+
+    return value <= completedValue;
+}
+
+void
+FenceTimeline::WaitForValue(const std::uint64_t value) noexcept
+{
+    FenceTimeline* timeline = this;
+    WaitForValues(&timeline, &value, 1U);
+}
+
+void
+FenceTimeline::WaitForValues(FenceTimeline* const* timelines,
+                             const std::uint64_t* values,
+                             const std::uint32_t count) noexcept
+{
+    BRE_ASSERT(count <= MAXIMUM_WAIT_OBJECTS);
+    BRE_ASSERT(count == 0U || (timelines != nullptr && values != nullptr));
+
+    HANDLE eventHandles[MAXIMUM_WAIT_OBJECTS];
+    std::uint32_t eventCount = 0U;
+    for (std::uint32_t i = 0U; i < count; ++i) {
+        BRE_ASSERT(timelines[i] != nullptr);
+        FenceTimeline& timeline = *timelines[i];
+        if (timeline.IsComplete(values[i])) {
+            continue;
+        }
+
+        const HANDLE eventHandle = WaitEventPool::AcquireEvent();
+        BRE_CHECK_HR(timeline.mFence.SetEventOnCompletion(values[i], eventHandle));
+        eventHandles[eventCount++] = eventHandle;
+    }
+
+    if (eventCount == 0U) {
+        return;
+    }
+
+    // Events are auto-reset, so they are not signaled when they go back to the pool.
+    WaitForMultipleObjects(eventCount, eventHandles, true, INFINITE);
+
+    for (std::uint32_t i = 0U; i < eventCount; ++i) {
+        WaitEventPool::ReleaseEvent(eventHandles[i]);
+    }
+}
+}
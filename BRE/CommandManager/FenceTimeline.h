@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <d3d12.h>
+#include <mutex>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+///
+/// @brief Timeline over a fence.
+///
+/// Signal() enqueues monotonically increasing values, so every signaled value identifies
+/// the work submitted before it. It can be used for frame pacing, uploads, and deferred deletion.
+/// Waits use events from WaitEventPool, so they do not create kernel objects.
+/// All the methods are thread safe.
+///
+class FenceTimeline {
+public:
+    ///
+    /// @brief FenceTimeline constructor
+    /// @param fence Fence. Its values must only be signaled through this timeline.
+    ///
+    explicit FenceTimeline(ID3D12Fence& fence);
+
+    ~FenceTimeline() = default;
+    FenceTimeline(const FenceTimeline&) = delete;
+    const FenceTimeline& operator=(const FenceTimeline&) = delete;
+    FenceTimeline(FenceTimeline&&) = delete;
+    FenceTimeline& operator=(FenceTimeline&&) = delete;
+
+    ///
+    /// @brief Enqueue a signal of the next value of the timeline
+    /// @param commandQueue Command queue that signals the value when its previous work completes
+    /// @return Signaled value
+    ///
+    std::uint64_t Signal(ID3D12CommandQueue& commandQueue) noexcept;
+
+    ///
+    /// @brief Get the last signaled value
+    /// @return Last value returned by Signal(). Zero if Signal() was never called.
+    ///
+    __forceinline std::uint64_t GetLastSignaledValue() const noexcept
+    {
+        return mLastSignaledValue;
+    }
+
+    ///
+    /// @brief Checks if the GPU reached a value without blocking
+    /// @param value Value to check
+    /// @return True if @p value was reached. Otherwise, false.
+    ///
+    bool IsComplete(const std::uint64_t value) noexcept;
+
+    ///
+    /// @brief Blocks the calling thread until the GPU reaches a value
+    /// @param value Value to wait for
+    ///
+    void WaitForValue(const std::uint64_t value) noexcept;
+
+    ///
+    /// @brief Blocks the calling thread until the GPU reaches values of several timelines
+    ///
+    /// All the fences are waited at once with a single wait call.
+    ///
+    /// @param timelines Timelines to wait for. The same timeline can be included several times.
+    /// @param values Value to wait for per timeline
+    /// @param count The number of timelines. It must not be greater than MAXIMUM_WAIT_OBJECTS.
+    ///
+    static void WaitForValues(FenceTimeline* const* timelines,
+                              const std::uint64_t* values,
+                              const std::uint32_t count) noexcept;
+
+    __forceinline ID3D12Fence& GetFence() noexcept
+    {
+        return mFence;
+    }
+
+private:
+    ID3D12Fence& mFence;
+
+    // Serializes signals, so values are enqueued in increasing order.
+    std::mutex mSignalMutex;
+
+    std::atomic<std::uint64_t> mLastSignaledValue{ 0UL };
+
+    // Cache of the last value read with ID3D12Fence::GetCompletedValue()
+    std::atomic<std::uint64_t> mLastCompletedValue{ 0UL };
+};
+}
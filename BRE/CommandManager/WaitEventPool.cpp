@@ -0,0 +1,40 @@
+#include "WaitEventPool.h"
+
+#include <Utils/DebugUtils.h>
+
+namespace BRE {
+tbb::concurrent_queue<HANDLE> WaitEventPool::mFreeEvents;
+
+void
+WaitEventPool::Clear() noexcept
+{
+    HANDLE eventHandle;
+    while (mFreeEvents.try_pop(eventHandle)) {
+        BRE_ASSERT(eventHandle != nullptr);
+        CloseHandle(eventHandle);
+    }
+}
+
+HANDLE
+WaitEventPool::AcquireEvent() noexcept
+{
+    HANDLE eventHandle{ nullptr };
+    if (mFreeEvents.try_pop(eventHandle)) {
+        BRE_ASSERT(eventHandle != nullptr);
+        return eventHandle;
+    }
+
+    eventHandle = CreateEventEx(nullptr, nullptr, false, EVENT_ALL_ACCESS);
+    BRE_ASSERT(eventHandle != nullptr);
+
+    return eventHandle;
+}
+
+void
+WaitEventPool::ReleaseEvent(const HANDLE eventHandle) noexcept
+{
+    BRE_ASSERT(eventHandle != nullptr);
+
+    mFreeEvents.push(eventHandle);
+}
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <tbb\concurrent_queue.h>
+#include <Windows.h>
+
+namespace BRE {
+///
+/// @brief Responsible to reuse the OS events used to wait for fences
+///
+/// Creating and closing an event is a kernel object round trip, so events are
+/// created once and then they are acquired and released every time a thread waits.
+///
+class WaitEventPool {
+public:
+    WaitEventPool() = delete;
+    ~WaitEventPool() = delete;
+    WaitEventPool(const WaitEventPool&) = delete;
+    const WaitEventPool& operator=(const WaitEventPool&) = delete;
+    WaitEventPool(WaitEventPool&&) = delete;
+    WaitEventPool& operator=(WaitEventPool&&) = delete;
+
+    ///
+    /// @brief Close all events
+    ///
+    /// All acquired events must be released before.
+    ///
+    static void Clear() noexcept;
+
+    ///
+    /// @brief Acquire an event.
+    ///
+    /// It is an auto-reset event, so it is not signaled after a wait is satisfied.
+    /// It creates an event if there is not a free event in the pool.
+    ///
+    /// @return Event handle
+    ///
+    static HANDLE AcquireEvent() noexcept;
+
+    ///
+    /// @brief Release an event acquired with AcquireEvent()
+    /// @param eventHandle Event to release. It must not be signaled.
+    ///
+    static void ReleaseEvent(const HANDLE eventHandle) noexcept;
+
+private:
+    static tbb::concurrent_queue<HANDLE> mFreeEvents;
+};
+}
@@ -0,0 +1,95 @@
+#include "BindlessTextureTable.h"
+
+#include <DescriptorManager\CbvSrvUavDescriptorManager.h>
+#include <DescriptorManager\ShaderResourceViewCache.h>
+#include <DirectXManager\DirectXManager.h>
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+D3D12_GPU_DESCRIPTOR_HANDLE BindlessTextureTable::mGpuDescriptorHandleBegin{ 0UL };
+D3D12_CPU_DESCRIPTOR_HANDLE BindlessTextureTable::mCpuDescriptorHandleBegin{ 0UL };
+std::uint32_t BindlessTextureTable::mMaxTextureCount{ 0U };
+std::mutex BindlessTextureTable::mMutex;
+std::unique_ptr<ShaderResourceViewCache> BindlessTextureTable::mViewCache;
+
+void
+BindlessTextureTable::Init(const std::uint32_t maxTextureCount) noexcept
+{
+    BRE_ASSERT(maxTextureCount > 0U);
+
+    mMutex.lock();
+    BRE_ASSERT(mMaxTextureCount == 0U);
+    mGpuDescriptorHandleBegin = CbvSrvUavDescriptorManager::AllocateDescriptors(maxTextureCount,
+                                                                                mCpuDescriptorHandleBegin);
+    mMaxTextureCount = maxTextureCount;
+    mViewCache.reset(new ShaderResourceViewCache(maxTextureCount));
+    mMutex.unlock();
+}
+
+std::uint32_t
+BindlessTextureTable::AcquireTextureIndex(ID3D12Resource& texture) noexcept
+{
+    const D3D12_RESOURCE_DESC textureDescriptor = texture.GetDesc();
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDescriptor{};
+    srvDescriptor.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srvDescriptor.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    srvDescriptor.Texture2D.MostDetailedMip = 0;
+    srvDescriptor.Texture2D.ResourceMinLODClamp = 0.0f;
+    srvDescriptor.Format = textureDescriptor.Format;
+    srvDescriptor.Texture2D.MipLevels = textureDescriptor.MipLevels;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    BRE_ASSERT(mViewCache.get() != nullptr);
+
+    bool isNewView;
+    const std::uint32_t textureIndex = mViewCache->AcquireView(&texture, srvDescriptor, isNewView);
+    BRE_CHECK_MSG(textureIndex != ShaderResourceViewCache::sInvalidIndex,
+                  L"There are not enough descriptors in the bindless texture table");
+
+    if (isNewView) {
+        D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle = mCpuDescriptorHandleBegin;
+        cpuDescriptorHandle.ptr +=
+            textureIndex * static_cast<SIZE_T>(DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
+        DirectXManager::GetDevice().CreateShaderResourceView(&texture,
+                                                             &srvDescriptor,
+                                                             cpuDescriptorHandle);
+    }
+
+    return textureIndex;
+}
+
+void
+BindlessTextureTable::ReleaseTextureIndex(const std::uint32_t textureIndex) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    BRE_ASSERT(mViewCache.get() != nullptr);
+
+    mViewCache->ReleaseView(textureIndex);
+}
+
+bool
+BindlessTextureTable::RemoveTexture(ID3D12Resource& texture) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mViewCache.get() == nullptr) {
+        return false;
+    }
+
+    return mViewCache->RemoveResourceViews(&texture) > 0U;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE
+BindlessTextureTable::GetDescriptorTableBegin() noexcept
+{
+    BRE_ASSERT(mGpuDescriptorHandleBegin.ptr != 0UL);
+    return mGpuDescriptorHandleBegin;
+}
+
+std::uint32_t
+BindlessTextureTable::GetTextureCount() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mViewCache.get() != nullptr ? mViewCache->GetViewCount() : 0U;
+}
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <memory>
+#include <mutex>
+
+namespace BRE {
+class ShaderResourceViewCache;
+
+///
+/// @brief Table of shader resource views of textures, indexed by shaders.
+///
+/// The table is a range of contiguous descriptors of the CBV/SRV/UAV descriptor heap,
+/// bound once as an unbounded SRV range. Each texture gets a single descriptor in the table,
+/// and shaders sample it with its index (see AcquireTextureIndex()).
+/// Descriptors are managed by a ShaderResourceViewCache, so they are reference counted
+/// and reused once all their users release them.
+///
+class BindlessTextureTable {
+public:
+    BindlessTextureTable() = delete;
+    ~BindlessTextureTable() = delete;
+    BindlessTextureTable(const BindlessTextureTable&) = delete;
+    const BindlessTextureTable& operator=(const BindlessTextureTable&) = delete;
+    BindlessTextureTable(BindlessTextureTable&&) = delete;
+    BindlessTextureTable& operator=(BindlessTextureTable&&) = delete;
+
+    ///
+    /// @brief Initializes the table
+    ///
+    /// CbvSrvUavDescriptorManager::Init() must be called first.
+    ///
+    /// @param maxTextureCount The maximum number of textures in the table. It must be greater than zero.
+    ///
+    static void Init(const std::uint32_t maxTextureCount) noexcept;
+
+    ///
+    /// @brief Get the index of a texture in the table, and add a reference to it
+    ///
+    /// The shader resource view of the texture (all its mips) is created the first
+    /// time the texture is requested. This method is thread safe.
+    ///
+    /// @param texture 2D texture
+    /// @return The index of the texture in the table. It must be released with ReleaseTextureIndex().
+    ///
+    static std::uint32_t AcquireTextureIndex(ID3D12Resource& texture) noexcept;
+
+    ///
+    /// @brief Release a reference to a texture index
+    ///
+    /// When it is the last reference, the index is reused by textures added later,
+    /// so the GPU must not be using it anymore. This method is thread safe.
+    ///
+    /// @param textureIndex Index returned by AcquireTextureIndex()
+    ///
+    static void ReleaseTextureIndex(const std::uint32_t textureIndex) noexcept;
+
+    ///
+    /// @brief Remove a texture from the table, whatever its reference count
+    ///
+    /// It is called when the texture is destroyed. Its index is reused by textures
+    /// added later, so the GPU must not be using the texture anymore. This method is thread safe.
+    ///
+    /// @param texture 2D texture
+    /// @return True if @p texture was in the table. Otherwise, false, and nothing is done.
+    ///
+    static bool RemoveTexture(ID3D12Resource& texture) noexcept;
+
+    ///
+    /// @brief Get the GPU descriptor handle of the first descriptor of the table
+    /// @return GPU descriptor handle to bind as the unbounded SRV range
+    ///
+    static D3D12_GPU_DESCRIPTOR_HANDLE GetDescriptorTableBegin() noexcept;
+
+    ///
+    /// @brief Get the number of textures in the table
+    /// @return Number of textures
+    ///
+    static std::uint32_t GetTextureCount() noexcept;
+
+private:
+    static D3D12_GPU_DESCRIPTOR_HANDLE mGpuDescriptorHandleBegin;
+    static D3D12_CPU_DESCRIPTOR_HANDLE mCpuDescriptorHandleBegin;
+    static std::uint32_t mMaxTextureCount;
+
+    static std::mutex mMutex;
+    static std::unique_ptr<ShaderResourceViewCache> mViewCache;
+};
+}
@@ -2,50 +2,76 @@
 
 #include <memory>
 
+#include <ApplicationSettings\ApplicationSettings.h>
+#include <CommandManager\FenceTimeline.h>
 #include <DirectXManager\DirectXManager.h>
 #include <DXUtils/d3dx12.h>
+#include <ResourceManager\MemoryBudget.h>
 
 namespace BRE {
 Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> CbvSrvUavDescriptorManager::mCbvSrvUavDescriptorHeap;
-D3D12_GPU_DESCRIPTOR_HANDLE CbvSrvUavDescriptorManager::mCurrentCbvSrvUavGpuDescriptorHandle{ 0UL };
-D3D12_CPU_DESCRIPTOR_HANDLE CbvSrvUavDescriptorManager::mCurrentCbvSrvUavCpuDescriptorHandle{ 0UL };
+D3D12_GPU_DESCRIPTOR_HANDLE CbvSrvUavDescriptorManager::mCbvSrvUavGpuDescriptorHandleForHeapStart{ 0UL };
+D3D12_CPU_DESCRIPTOR_HANDLE CbvSrvUavDescriptorManager::mCbvSrvUavCpuDescriptorHandleForHeapStart{ 0UL };
+std::unique_ptr<DescriptorBlockAllocator> CbvSrvUavDescriptorManager::mDescriptorBlockAllocator;
+std::unique_ptr<TransientDescriptorRing> CbvSrvUavDescriptorManager::mTransientDescriptorRing;
+Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> CbvSrvUavDescriptorManager::mStagingDescriptorHeap;
+D3D12_CPU_DESCRIPTOR_HANDLE CbvSrvUavDescriptorManager::mStagingCpuDescriptorHandleForHeapStart{ 0UL };
+std::unique_ptr<DescriptorRangeAllocator> CbvSrvUavDescriptorManager::mStagingDescriptorRangeAllocator;
+std::mutex CbvSrvUavDescriptorManager::mStagingMutex;
+std::vector<CbvSrvUavDescriptorManager::FreedDescriptorRange> CbvSrvUavDescriptorManager::mFreedDescriptorRanges;
+std::deque<CbvSrvUavDescriptorManager::FreedDescriptorRange> CbvSrvUavDescriptorManager::mPendingDescriptorRanges;
 std::mutex CbvSrvUavDescriptorManager::mMutex;
 
 void
-CbvSrvUavDescriptorManager::Init(const std::uint32_t numDescriptorsInCbvSrvUavDescriptorHeap) noexcept
+CbvSrvUavDescriptorManager::Init(const std::uint32_t numDescriptorsInCbvSrvUavDescriptorHeap,
+                                 const std::uint32_t numTransientDescriptorsPerFrame,
+                                 const std::uint32_t numStagingDescriptors) noexcept
 {
     D3D12_DESCRIPTOR_HEAP_DESC cbvSrvUavDescriptorHeapDescriptor{};
     cbvSrvUavDescriptorHeapDescriptor.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
     cbvSrvUavDescriptorHeapDescriptor.NodeMask = 0U;
-    cbvSrvUavDescriptorHeapDescriptor.NumDescriptors = numDescriptorsInCbvSrvUavDescriptorHeap;
+    cbvSrvUavDescriptorHeapDescriptor.NumDescriptors =
+        numDescriptorsInCbvSrvUavDescriptorHeap + numTransientDescriptorsPerFrame * ApplicationSettings::sQueuedFrameCount;
     cbvSrvUavDescriptorHeapDescriptor.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
 
     mMutex.lock();
     BRE_CHECK_HR(DirectXManager::GetDevice().CreateDescriptorHeap(&cbvSrvUavDescriptorHeapDescriptor,
                                                                   IID_PPV_ARGS(mCbvSrvUavDescriptorHeap.GetAddressOf())));
+    MemoryBudget::AddDescriptorHeapAllocation(*mCbvSrvUavDescriptorHeap.Get());
+
+    mCbvSrvUavGpuDescriptorHandleForHeapStart = mCbvSrvUavDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
+    mCbvSrvUavCpuDescriptorHandleForHeapStart = mCbvSrvUavDescriptorHeap->GetCPUDescriptorHandleForHeapStart();
+
+    mDescriptorBlockAllocator.reset(new DescriptorBlockAllocator(numDescriptorsInCbvSrvUavDescriptorHeap,
+                                                                 sDescriptorBlockSize));
+    mTransientDescriptorRing.reset(new TransientDescriptorRing(numDescriptorsInCbvSrvUavDescriptorHeap,
+                                                               numTransientDescriptorsPerFrame,
+                                                               ApplicationSettings::sQueuedFrameCount));
     mMutex.unlock();
 
-    mCurrentCbvSrvUavGpuDescriptorHandle = mCbvSrvUavDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
-    mCurrentCbvSrvUavCpuDescriptorHandle = mCbvSrvUavDescriptorHeap->GetCPUDescriptorHandleForHeapStart();
+    D3D12_DESCRIPTOR_HEAP_DESC stagingDescriptorHeapDescriptor{};
+    stagingDescriptorHeapDescriptor.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+    stagingDescriptorHeapDescriptor.NodeMask = 0U;
+    stagingDescriptorHeapDescriptor.NumDescriptors = numStagingDescriptors;
+    stagingDescriptorHeapDescriptor.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+
+    mStagingMutex.lock();
+    BRE_CHECK_HR(DirectXManager::GetDevice().CreateDescriptorHeap(&stagingDescriptorHeapDescriptor,
+                                                                  IID_PPV_ARGS(mStagingDescriptorHeap.GetAddressOf())));
+    MemoryBudget::AddDescriptorHeapAllocation(*mStagingDescriptorHeap.Get());
+
+    mStagingCpuDescriptorHandleForHeapStart = mStagingDescriptorHeap->GetCPUDescriptorHandleForHeapStart();
+    mStagingDescriptorRangeAllocator.reset(new DescriptorRangeAllocator(numStagingDescriptors));
+    mStagingMutex.unlock();
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE
 CbvSrvUavDescriptorManager::CreateConstantBufferView(const D3D12_CONSTANT_BUFFER_VIEW_DESC& descriptor) noexcept
 {
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{};
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{};
+    const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle = AllocateDescriptors(1U, cpuDescriptorHandle);
 
-    mMutex.lock();
-    gpuDescriptorHandle = mCurrentCbvSrvUavGpuDescriptorHandle;
-
-    DirectXManager::GetDevice().CreateConstantBufferView(&descriptor, mCurrentCbvSrvUavCpuDescriptorHandle);
-
-    mCurrentCbvSrvUavGpuDescriptorHandle.ptr +=
-        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mCurrentCbvSrvUavCpuDescriptorHandle.ptr +=
-        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mMutex.unlock();
+    DirectXManager::GetDevice().CreateConstantBufferView(&descriptor, cpuDescriptorHandle);
 
     return gpuDescriptorHandle;
 }
@@ -57,22 +83,15 @@ CbvSrvUavDescriptorManager::CreateConstantBufferViews(const D3D12_CONSTANT_BUFFE
     BRE_ASSERT(descriptors != nullptr);
     BRE_ASSERT(descriptorCount > 0U);
 
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{};
-
-    mMutex.lock();
-    gpuDescriptorHandle = mCurrentCbvSrvUavGpuDescriptorHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{};
+    const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle = AllocateDescriptors(descriptorCount, cpuDescriptorHandle);
 
     for (std::uint32_t i = 0U; i < descriptorCount; ++i) {
-        DirectXManager::GetDevice().CreateConstantBufferView(&descriptors[i], mCurrentCbvSrvUavCpuDescriptorHandle);
-        mCurrentCbvSrvUavCpuDescriptorHandle.ptr +=
+        DirectXManager::GetDevice().CreateConstantBufferView(&descriptors[i], cpuDescriptorHandle);
+        cpuDescriptorHandle.ptr +=
             DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
     }
 
-    mCurrentCbvSrvUavGpuDescriptorHandle.ptr +=
-        descriptorCount * DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mMutex.unlock();
-
     return gpuDescriptorHandle;
 }
 
@@ -80,22 +99,12 @@ D3D12_GPU_DESCRIPTOR_HANDLE
 CbvSrvUavDescriptorManager::CreateShaderResourceView(ID3D12Resource& resource,
                                                      const D3D12_SHADER_RESOURCE_VIEW_DESC& descriptor) noexcept
 {
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{};
-
-    mMutex.lock();
-    gpuDescriptorHandle = mCurrentCbvSrvUavGpuDescriptorHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{};
+    const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle = AllocateDescriptors(1U, cpuDescriptorHandle);
 
     DirectXManager::GetDevice().CreateShaderResourceView(&resource,
                                                          &descriptor,
-                                                         mCurrentCbvSrvUavCpuDescriptorHandle);
-
-    mCurrentCbvSrvUavGpuDescriptorHandle.ptr +=
-        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mCurrentCbvSrvUavCpuDescriptorHandle.ptr +=
-        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mMutex.unlock();
+                                                         cpuDescriptorHandle);
 
     return gpuDescriptorHandle;
 }
@@ -109,25 +118,18 @@ CbvSrvUavDescriptorManager::CreateShaderResourceViews(ID3D12Resource* *resources
     BRE_ASSERT(descriptors != nullptr);
     BRE_ASSERT(descriptorCount > 0U);
 
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{};
-
-    mMutex.lock();
-    gpuDescriptorHandle = mCurrentCbvSrvUavGpuDescriptorHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{};
+    const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle = AllocateDescriptors(descriptorCount, cpuDescriptorHandle);
 
     for (std::uint32_t i = 0U; i < descriptorCount; ++i) {
         BRE_ASSERT(resources[i] != nullptr);
         DirectXManager::GetDevice().CreateShaderResourceView(resources[i],
                                                              &descriptors[i],
-                                                             mCurrentCbvSrvUavCpuDescriptorHandle);
-        mCurrentCbvSrvUavCpuDescriptorHandle.ptr +=
+                                                             cpuDescriptorHandle);
+        cpuDescriptorHandle.ptr +=
             DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
     }
 
-    mCurrentCbvSrvUavGpuDescriptorHandle.ptr +=
-        descriptorCount * DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mMutex.unlock();
-
     return gpuDescriptorHandle;
 }
 
@@ -135,23 +137,13 @@ D3D12_GPU_DESCRIPTOR_HANDLE
 CbvSrvUavDescriptorManager::CreateUnorderedAccessView(ID3D12Resource& resource,
                                                       const D3D12_UNORDERED_ACCESS_VIEW_DESC& descriptor) noexcept
 {
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{};
-
-    mMutex.lock();
-    gpuDescriptorHandle = mCurrentCbvSrvUavGpuDescriptorHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{};
+    const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle = AllocateDescriptors(1U, cpuDescriptorHandle);
 
     DirectXManager::GetDevice().CreateUnorderedAccessView(&resource,
                                                           nullptr,
                                                           &descriptor,
-                                                          mCurrentCbvSrvUavCpuDescriptorHandle);
-
-    mCurrentCbvSrvUavGpuDescriptorHandle.ptr +=
-        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mCurrentCbvSrvUavCpuDescriptorHandle.ptr +=
-        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-    mMutex.unlock();
+                                                          cpuDescriptorHandle);
 
     return gpuDescriptorHandle;
 }
@@ -165,26 +157,187 @@ CbvSrvUavDescriptorManager::CreateUnorderedAccessViews(ID3D12Resource* *resource
     BRE_ASSERT(descriptors != nullptr);
     BRE_ASSERT(descriptorCount > 0U);
 
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{};
-
-    mMutex.lock();
-    gpuDescriptorHandle = mCurrentCbvSrvUavGpuDescriptorHandle;
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{};
+    const D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle = AllocateDescriptors(descriptorCount, cpuDescriptorHandle);
 
     for (std::uint32_t i = 0U; i < descriptorCount; ++i) {
         BRE_ASSERT(resources[i] != nullptr);
         DirectXManager::GetDevice().CreateUnorderedAccessView(resources[i],
                                                               nullptr,
                                                               &descriptors[i],
-                                                              mCurrentCbvSrvUavCpuDescriptorHandle);
-        mCurrentCbvSrvUavCpuDescriptorHandle.ptr +=
+                                                              cpuDescriptorHandle);
+        cpuDescriptorHandle.ptr +=
             DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
     }
 
-    mCurrentCbvSrvUavGpuDescriptorHandle.ptr +=
-        descriptorCount * DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    return gpuDescriptorHandle;
+}
 
+void
+CbvSrvUavDescriptorManager::FreeDescriptors(const D3D12_GPU_DESCRIPTOR_HANDLE firstGpuDescriptorHandle,
+                                            const std::uint32_t descriptorCount) noexcept
+{
+    BRE_ASSERT(descriptorCount > 0U);
+    BRE_ASSERT(firstGpuDescriptorHandle.ptr >= mCbvSrvUavGpuDescriptorHandleForHeapStart.ptr);
+
+    const std::uint64_t descriptorHandleIncrementSize =
+        DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    FreedDescriptorRange freedDescriptorRange;
+    freedDescriptorRange.mOffset = static_cast<std::uint32_t>(
+        (firstGpuDescriptorHandle.ptr - mCbvSrvUavGpuDescriptorHandleForHeapStart.ptr) / descriptorHandleIncrementSize);
+    freedDescriptorRange.mDescriptorCount = descriptorCount;
+
+    mMutex.lock();
+    mFreedDescriptorRanges.push_back(freedDescriptorRange);
     mMutex.unlock();
+}
+
+void
+CbvSrvUavDescriptorManager::RecycleFreedDescriptors(FenceTimeline& fenceTimeline,
+                                                    const std::uint64_t fenceValue) noexcept
+{
+    BRE_ASSERT(mDescriptorBlockAllocator.get() != nullptr);
+
+    mMutex.lock();
+    BRE_ASSERT(mPendingDescriptorRanges.empty() || mPendingDescriptorRanges.back().mFenceValue <= fenceValue);
+
+    for (FreedDescriptorRange& freedDescriptorRange : mFreedDescriptorRanges) {
+        freedDescriptorRange.mFenceTimeline = &fenceTimeline;
+        freedDescriptorRange.mFenceValue = fenceValue;
+        mPendingDescriptorRanges.push_back(freedDescriptorRange);
+    }
+    mFreedDescriptorRanges.clear();
+
+    while (mPendingDescriptorRanges.empty() == false) {
+        const FreedDescriptorRange& pendingDescriptorRange = mPendingDescriptorRanges.front();
+        BRE_ASSERT(pendingDescriptorRange.mFenceTimeline != nullptr);
+        if (pendingDescriptorRange.mFenceTimeline->IsComplete(pendingDescriptorRange.mFenceValue) == false) {
+            break;
+        }
+
+        mDescriptorBlockAllocator->Free(pendingDescriptorRange.mOffset, pendingDescriptorRange.mDescriptorCount);
+        mPendingDescriptorRanges.pop_front();
+    }
+    mMutex.unlock();
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE
+CbvSrvUavDescriptorManager::CreateStagingShaderResourceView(ID3D12Resource& resource,
+                                                            const D3D12_SHADER_RESOURCE_VIEW_DESC& descriptor) noexcept
+{
+    const D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle = AllocateStagingDescriptor();
+
+    DirectXManager::GetDevice().CreateShaderResourceView(&resource,
+                                                         &descriptor,
+                                                         cpuDescriptorHandle);
+
+    return cpuDescriptorHandle;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE
+CbvSrvUavDescriptorManager::CreateTransientDescriptorTable(const D3D12_CPU_DESCRIPTOR_HANDLE* stagingCpuDescriptorHandles,
+                                                           const std::uint32_t descriptorCount) noexcept
+{
+    BRE_ASSERT(stagingCpuDescriptorHandles != nullptr);
+    BRE_ASSERT(descriptorCount > 0U);
+    BRE_ASSERT(mTransientDescriptorRing.get() != nullptr);
+
+    const std::uint32_t offset = mTransientDescriptorRing->Allocate(descriptorCount);
+    BRE_CHECK_MSG(offset != TransientDescriptorRing::sInvalidOffset,
+                  L"There are not enough transient descriptors for the current frame");
+
+    const std::uint64_t descriptorHandleOffset =
+        offset * static_cast<std::uint64_t>(DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
+
+    const D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{ mCbvSrvUavCpuDescriptorHandleForHeapStart.ptr + static_cast<SIZE_T>(descriptorHandleOffset) };
+
+    // A single destination range and a range of one descriptor per staging view
+    // (nullptr source range sizes), so the whole table is copied in one call.
+    DirectXManager::GetDevice().CopyDescriptors(1U,
+                                                &cpuDescriptorHandle,
+                                                &descriptorCount,
+                                                descriptorCount,
+                                                stagingCpuDescriptorHandles,
+                                                nullptr,
+                                                D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{ mCbvSrvUavGpuDescriptorHandleForHeapStart.ptr + descriptorHandleOffset };
 
     return gpuDescriptorHandle;
 }
-}
\ No newline at end of file
+
+void
+CbvSrvUavDescriptorManager::RecycleTransientDescriptors(FenceTimeline& fenceTimeline,
+                                                        const std::uint64_t fenceValue) noexcept
+{
+    BRE_ASSERT(mTransientDescriptorRing.get() != nullptr);
+
+    const std::uint64_t nextFrameFenceValue = mTransientDescriptorRing->EndFrame(fenceValue);
+    if (nextFrameFenceValue > 0UL) {
+        fenceTimeline.WaitForValue(nextFrameFenceValue);
+    }
+}
+
+void
+CbvSrvUavDescriptorManager::ReturnUnusedDescriptors() noexcept
+{
+    BRE_ASSERT(mDescriptorBlockAllocator.get() != nullptr);
+    mDescriptorBlockAllocator->ReturnUnusedDescriptors();
+}
+
+DescriptorRangeAllocator::Statistics
+CbvSrvUavDescriptorManager::GetStatistics() noexcept
+{
+    BRE_ASSERT(mDescriptorBlockAllocator.get() != nullptr);
+    return mDescriptorBlockAllocator->GetStatistics();
+}
+
+float
+CbvSrvUavDescriptorManager::GetFragmentation() noexcept
+{
+    BRE_ASSERT(mDescriptorBlockAllocator.get() != nullptr);
+    return mDescriptorBlockAllocator->GetFragmentation();
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE
+CbvSrvUavDescriptorManager::AllocateDescriptors(const std::uint32_t descriptorCount,
+                                                D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescriptorHandle) noexcept
+{
+    BRE_ASSERT(descriptorCount > 0U);
+
+    BRE_ASSERT(mDescriptorBlockAllocator.get() != nullptr);
+    const std::uint32_t offset = mDescriptorBlockAllocator->Allocate(descriptorCount);
+
+    BRE_CHECK_MSG(offset != DescriptorRangeAllocator::sInvalidOffset,
+                  L"There are not enough contiguous descriptors in the CBV/SRV/UAV descriptor heap");
+
+    const std::uint64_t descriptorHandleOffset =
+        offset * static_cast<std::uint64_t>(DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
+
+    cpuDescriptorHandle.ptr = mCbvSrvUavCpuDescriptorHandleForHeapStart.ptr + static_cast<SIZE_T>(descriptorHandleOffset);
+
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescriptorHandle{ mCbvSrvUavGpuDescriptorHandleForHeapStart.ptr + descriptorHandleOffset };
+
+    return gpuDescriptorHandle;
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE
+CbvSrvUavDescriptorManager::AllocateStagingDescriptor() noexcept
+{
+    mStagingMutex.lock();
+    BRE_ASSERT(mStagingDescriptorRangeAllocator.get() != nullptr);
+    const std::uint32_t offset = mStagingDescriptorRangeAllocator->Allocate(1U);
+    mStagingMutex.unlock();
+
+    BRE_CHECK_MSG(offset != DescriptorRangeAllocator::sInvalidOffset,
+                  L"There are not enough descriptors in the CBV/SRV/UAV staging descriptor heap");
+
+    const std::uint64_t descriptorHandleOffset =
+        offset * static_cast<std::uint64_t>(DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV));
+
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescriptorHandle{ mStagingCpuDescriptorHandleForHeapStart.ptr + static_cast<SIZE_T>(descriptorHandleOffset) };
+
+    return cpuDescriptorHandle;
+}
+}
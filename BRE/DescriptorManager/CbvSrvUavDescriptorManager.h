@@ -1,16 +1,34 @@
 #pragma once
 
 #include <d3d12.h>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <vector>
 #include <wrl.h>
 
+#include <DescriptorManager\DescriptorBlockAllocator.h>
+#include <DescriptorManager\TransientDescriptorRing.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
+class FenceTimeline;
+
 ///
 /// @brief Responsible to create constant buffers, shader resource views,
 /// and unordered access views.
 ///
+/// Descriptors are allocated from the descriptor heap with a DescriptorBlockAllocator,
+/// so they can be freed with FreeDescriptors() and reused after the GPU stops using them.
+/// Each thread creates views in its own block of descriptors without taking a lock, and
+/// unused descriptors of the blocks are returned with ReturnUnusedDescriptors().
+///
+/// The end of the descriptor heap is a TransientDescriptorRing with a partition per queued frame.
+/// Per frame bindings (for example, the input tables of the tone mapping and post process passes)
+/// create views once in a non shader visible staging heap, and copy them into a contiguous
+/// transient descriptor table of the current frame with CreateTransientDescriptorTable().
+/// Transient descriptors are reclaimed with RecycleTransientDescriptors().
+///
 class CbvSrvUavDescriptorManager {
 public:
     CbvSrvUavDescriptorManager() = delete;
@@ -24,8 +42,13 @@ public:
     /// @brief Initializes manager, for example, descriptor heap.
     /// @param numDescriptorsInCbvSrvUavDescriptorHeap Number of descriptors in
     /// descriptor heap of Constant Buffer Views, Shader Resource Views, and Unordered Access Views.
+    /// @param numTransientDescriptorsPerFrame Number of transient descriptors per queued frame.
+    /// They are added to the end of the descriptor heap.
+    /// @param numStagingDescriptors Number of descriptors in the non shader visible staging heap
     ///
-    static void Init(const std::uint32_t numDescriptorsInCbvSrvUavDescriptorHeap) noexcept;
+    static void Init(const std::uint32_t numDescriptorsInCbvSrvUavDescriptorHeap,
+                     const std::uint32_t numTransientDescriptorsPerFrame,
+                     const std::uint32_t numStagingDescriptors) noexcept;
 
     ///
     /// @brief Create a constant buffer view
@@ -87,6 +110,110 @@ public:
                                                                   const D3D12_UNORDERED_ACCESS_VIEW_DESC* descriptors,
                                                                   const std::uint32_t descriptorCount) noexcept;
 
+    ///
+    /// @brief Allocate contiguous descriptors without creating views.
+    ///
+    /// Views must be created by the caller with the CPU descriptor handle.
+    /// It fails if there is not a free range that fits.
+    ///
+    /// @param descriptorCount The number of descriptors
+    /// @param cpuDescriptorHandle Output CPU descriptor handle of the first descriptor
+    /// @return The GPU descriptor handle of the first descriptor
+    ///
+    static D3D12_GPU_DESCRIPTOR_HANDLE AllocateDescriptors(const std::uint32_t descriptorCount,
+                                                           D3D12_CPU_DESCRIPTOR_HANDLE& cpuDescriptorHandle) noexcept;
+
+    ///
+    /// @brief Free views created by this manager.
+    ///
+    /// Descriptors are not reused immediately, because command lists in flight can still
+    /// reference them. They are reused once the GPU finishes the frame where they were freed
+    /// (see RecycleFreedDescriptors()).
+    ///
+    /// @param firstGpuDescriptorHandle GPU descriptor handle returned by a Create* method
+    /// @param descriptorCount The number of views created by that call
+    ///
+    static void FreeDescriptors(const D3D12_GPU_DESCRIPTOR_HANDLE firstGpuDescriptorHandle,
+                                const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief Recycle freed descriptors at a frame boundary.
+    ///
+    /// Descriptors freed since the last call are tagged with @p fenceValue, and
+    /// freed descriptors whose fence value already completed can be allocated again.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void RecycleFreedDescriptors(FenceTimeline& fenceTimeline,
+                                        const std::uint64_t fenceValue) noexcept;
+
+    ///
+    /// @brief Return the unused descriptors of the per-thread blocks.
+    ///
+    /// It should be called at frame or load boundaries, and it must not be called
+    /// while other threads create views.
+    ///
+    static void ReturnUnusedDescriptors() noexcept;
+
+    ///
+    /// @brief Create a shader resource view in the staging heap
+    ///
+    /// Staging views are not shader visible. They are the source of CreateTransientDescriptorTable().
+    ///
+    /// @param resource Resource to create the view
+    /// @param descriptor The shader resource view descriptor
+    /// @return CPU descriptor handle of the view
+    ///
+    static D3D12_CPU_DESCRIPTOR_HANDLE
+        CreateStagingShaderResourceView(ID3D12Resource& resource,
+                                        const D3D12_SHADER_RESOURCE_VIEW_DESC& descriptor) noexcept;
+
+    ///
+    /// @brief Create a transient descriptor table for the current frame.
+    ///
+    /// Staging descriptors are copied into contiguous descriptors of the transient
+    /// descriptor ring with a single CopyDescriptors call. The table is valid until
+    /// the GPU finishes the current frame.
+    /// This method is thread safe.
+    ///
+    /// @param stagingCpuDescriptorHandles CPU descriptor handles of staging views. It must not be nullptr.
+    /// @param descriptorCount The number of descriptors. It must be greater than zero.
+    /// @return The GPU descriptor handle of the first descriptor of the table
+    ///
+    static D3D12_GPU_DESCRIPTOR_HANDLE
+        CreateTransientDescriptorTable(const D3D12_CPU_DESCRIPTOR_HANDLE* stagingCpuDescriptorHandles,
+                                       const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief Reclaim transient descriptors at a frame boundary.
+    ///
+    /// The partition of the current frame is tagged with @p fenceValue, and the partition of
+    /// the next frame is reused once its fence value completes (it waits if needed).
+    /// It must not be called while other threads create transient descriptor tables.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void RecycleTransientDescriptors(FenceTimeline& fenceTimeline,
+                                            const std::uint64_t fenceValue) noexcept;
+
+    ///
+    /// @brief Get the statistics of the descriptor heap
+    ///
+    /// The maximum number of allocated descriptors can be used to size the heap.
+    /// Unused descriptors of the per-thread blocks are counted as allocated.
+    ///
+    /// @return Statistics
+    ///
+    static DescriptorRangeAllocator::Statistics GetStatistics() noexcept;
+
+    ///
+    /// @brief Get the fragmentation of free descriptors
+    /// @return Fragmentation. See DescriptorRangeAllocator::GetFragmentation()
+    ///
+    static float GetFragmentation() noexcept;
+
     ///
     /// @brief Get descriptor heap
     /// @return The descriptor heap
@@ -98,11 +225,47 @@ public:
     }
 
 private:
+    ///
+    /// @brief Allocate a descriptor in the staging heap.
+    ///
+    /// It fails if the staging heap is full.
+    ///
+    /// @return The CPU descriptor handle of the descriptor
+    ///
+    static D3D12_CPU_DESCRIPTOR_HANDLE AllocateStagingDescriptor() noexcept;
+
+    struct FreedDescriptorRange {
+        std::uint32_t mOffset{ 0U };
+        std::uint32_t mDescriptorCount{ 0U };
+        FenceTimeline* mFenceTimeline{ nullptr };
+        std::uint64_t mFenceValue{ 0UL };
+    };
+
     static Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> mCbvSrvUavDescriptorHeap;
 
-    static D3D12_GPU_DESCRIPTOR_HANDLE mCurrentCbvSrvUavGpuDescriptorHandle;
-    static D3D12_CPU_DESCRIPTOR_HANDLE mCurrentCbvSrvUavCpuDescriptorHandle;
+    static D3D12_GPU_DESCRIPTOR_HANDLE mCbvSrvUavGpuDescriptorHandleForHeapStart;
+    static D3D12_CPU_DESCRIPTOR_HANDLE mCbvSrvUavCpuDescriptorHandleForHeapStart;
+
+    // The number of descriptors that a thread reserves at once
+    static const std::uint32_t sDescriptorBlockSize{ 64U };
+
+    static std::unique_ptr<DescriptorBlockAllocator> mDescriptorBlockAllocator;
+
+    static std::unique_ptr<TransientDescriptorRing> mTransientDescriptorRing;
 
+    // Non shader visible heap of staging views, guarded by mStagingMutex
+    static Microsoft::WRL::ComPtr<ID3D12DescriptorHeap> mStagingDescriptorHeap;
+    static D3D12_CPU_DESCRIPTOR_HANDLE mStagingCpuDescriptorHandleForHeapStart;
+    static std::unique_ptr<DescriptorRangeAllocator> mStagingDescriptorRangeAllocator;
+    static std::mutex mStagingMutex;
+
+    // Guards freed and pending ranges
     static std::mutex mMutex;
+
+    // Ranges freed since the last RecycleFreedDescriptors() call
+    static std::vector<FreedDescriptorRange> mFreedDescriptorRanges;
+
+    // Ranges that wait for their fence value, ordered by fence value
+    static std::deque<FreedDescriptorRange> mPendingDescriptorRanges;
 };
 }
\ No newline at end of file
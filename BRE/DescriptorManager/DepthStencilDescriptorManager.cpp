@@ -4,6 +4,7 @@
 
 #include <DirectXManager\DirectXManager.h>
 #include <DXUtils/d3dx12.h>
+#include <ResourceManager\MemoryBudget.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
@@ -24,6 +25,7 @@ DepthStencilDescriptorManager::Init() noexcept
     mMutex.lock();
     BRE_CHECK_HR(DirectXManager::GetDevice().CreateDescriptorHeap(&depthStencilViewDescriptorHeapDescriptor,
                                                                   IID_PPV_ARGS(mDepthStencilViewDescriptorHeap.GetAddressOf())));
+    MemoryBudget::AddDescriptorHeapAllocation(*mDepthStencilViewDescriptorHeap.Get());
     mMutex.unlock();
 
     mCurrentDepthStencilViewGpuDescriptorHandle = mDepthStencilViewDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
@@ -0,0 +1,86 @@
+#include "DescriptorBlockAllocator.h"
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+DescriptorBlockAllocator::DescriptorBlockAllocator(const std::uint32_t capacity,
+                                                   const std::uint32_t blockSize)
+    : mDescriptorRangeAllocator(capacity)
+    , mBlockSize(blockSize)
+{
+    BRE_ASSERT(blockSize > 0U);
+}
+
+std::uint32_t
+DescriptorBlockAllocator::Allocate(const std::uint32_t descriptorCount) noexcept
+{
+    BRE_ASSERT(descriptorCount > 0U);
+
+    if (descriptorCount > mBlockSize) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mDescriptorRangeAllocator.Allocate(descriptorCount);
+    }
+
+    DescriptorBlock& descriptorBlock = mDescriptorBlockByThread.local();
+    if (descriptorBlock.mEndOffset - descriptorBlock.mNextOffset < descriptorCount) {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Return the tail of the current block and reserve a new block
+        if (descriptorBlock.mNextOffset < descriptorBlock.mEndOffset) {
+            mDescriptorRangeAllocator.Free(descriptorBlock.mNextOffset,
+                                           descriptorBlock.mEndOffset - descriptorBlock.mNextOffset);
+        }
+
+        const std::uint32_t blockOffset = mDescriptorRangeAllocator.Allocate(mBlockSize);
+        if (blockOffset == DescriptorRangeAllocator::sInvalidOffset) {
+            // There is not a free range for a whole block, so try to allocate only what we need.
+            descriptorBlock = DescriptorBlock();
+            return mDescriptorRangeAllocator.Allocate(descriptorCount);
+        }
+
+        descriptorBlock.mNextOffset = blockOffset;
+        descriptorBlock.mEndOffset = blockOffset + mBlockSize;
+    }
+
+    const std::uint32_t offset = descriptorBlock.mNextOffset;
+    descriptorBlock.mNextOffset += descriptorCount;
+
+    return offset;
+}
+
+void
+DescriptorBlockAllocator::Free(const std::uint32_t offset,
+                               const std::uint32_t descriptorCount) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mDescriptorRangeAllocator.Free(offset, descriptorCount);
+}
+
+void
+DescriptorBlockAllocator::ReturnUnusedDescriptors() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (DescriptorBlock& descriptorBlock : mDescriptorBlockByThread) {
+        if (descriptorBlock.mNextOffset < descriptorBlock.mEndOffset) {
+            mDescriptorRangeAllocator.Free(descriptorBlock.mNextOffset,
+                                           descriptorBlock.mEndOffset - descriptorBlock.mNextOffset);
+        }
+
+        descriptorBlock = DescriptorBlock();
+    }
+}
+
+DescriptorRangeAllocator::Statistics
+DescriptorBlockAllocator::GetStatistics() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mDescriptorRangeAllocator.GetStatistics();
+}
+
+float
+DescriptorBlockAllocator::GetFragmentation() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mDescriptorRangeAllocator.GetFragmentation();
+}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <tbb/enumerable_thread_specific.h>
+
+#include <DescriptorManager\DescriptorRangeAllocator.h>
+
+namespace BRE {
+///
+/// @brief Thread safe descriptor allocator with a block of descriptors per thread.
+///
+/// Each thread reserves a block of contiguous descriptors from a shared DescriptorRangeAllocator
+/// (that is the only operation that takes the lock), and then it allocates descriptors
+/// from its block without any lock. Allocations greater than the block size go directly
+/// to the shared allocator.
+/// Unused tails of the blocks must be returned with ReturnUnusedDescriptors() at
+/// frame or load boundaries.
+/// It does not depend on the device.
+///
+class DescriptorBlockAllocator {
+public:
+    ///
+    /// @brief DescriptorBlockAllocator constructor
+    /// @param capacity The number of descriptors in the heap
+    /// @param blockSize The number of descriptors that a thread reserves at once. It must be greater than zero.
+    ///
+    DescriptorBlockAllocator(const std::uint32_t capacity,
+                             const std::uint32_t blockSize);
+
+    ~DescriptorBlockAllocator() = default;
+    DescriptorBlockAllocator(const DescriptorBlockAllocator&) = delete;
+    const DescriptorBlockAllocator& operator=(const DescriptorBlockAllocator&) = delete;
+    DescriptorBlockAllocator(DescriptorBlockAllocator&&) = delete;
+    DescriptorBlockAllocator& operator=(DescriptorBlockAllocator&&) = delete;
+
+    ///
+    /// @brief Allocate a range of contiguous descriptors.
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param descriptorCount The number of descriptors. It must be greater than zero.
+    /// @return The offset of the first descriptor, or DescriptorRangeAllocator::sInvalidOffset
+    /// if there is not a free range that fits.
+    ///
+    std::uint32_t Allocate(const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief Free a range allocated with Allocate().
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param offset The offset of the first descriptor
+    /// @param descriptorCount The number of descriptors of the allocation
+    ///
+    void Free(const std::uint32_t offset,
+              const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief Return the unused descriptors of the blocks of all the threads.
+    ///
+    /// It must not be called while other threads allocate descriptors.
+    ///
+    void ReturnUnusedDescriptors() noexcept;
+
+    ///
+    /// @brief Get statistics
+    ///
+    /// Reserved but unused descriptors of the blocks are counted as allocated.
+    ///
+    /// @return Statistics
+    ///
+    DescriptorRangeAllocator::Statistics GetStatistics() noexcept;
+
+    ///
+    /// @brief Get the fragmentation of free descriptors
+    /// @return Fragmentation. See DescriptorRangeAllocator::GetFragmentation()
+    ///
+    float GetFragmentation() noexcept;
+
+private:
+    struct DescriptorBlock {
+        std::uint32_t mNextOffset{ 0U };
+        std::uint32_t mEndOffset{ 0U };
+    };
+
+    tbb::enumerable_thread_specific<DescriptorBlock> mDescriptorBlockByThread;
+
+    // Guards mDescriptorRangeAllocator
+    std::mutex mMutex;
+    DescriptorRangeAllocator mDescriptorRangeAllocator;
+
+    std::uint32_t mBlockSize{ 0U };
+};
+}
@@ -0,0 +1,113 @@
+#include "DescriptorRangeAllocator.h"
+
+#include <iterator>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+DescriptorRangeAllocator::DescriptorRangeAllocator(const std::uint32_t capacity)
+    : mCapacity(capacity)
+{
+    if (capacity > 0U) {
+        mFreeRanges[0U] = capacity;
+    }
+}
+
+std::uint32_t
+DescriptorRangeAllocator::Allocate(const std::uint32_t descriptorCount) noexcept
+{
+    BRE_ASSERT(descriptorCount > 0U);
+
+    // Best fit, to keep large free ranges for large allocations.
+    std::map<std::uint32_t, std::uint32_t>::iterator bestIt = mFreeRanges.end();
+    for (std::map<std::uint32_t, std::uint32_t>::iterator it = mFreeRanges.begin(); it != mFreeRanges.end(); ++it) {
+        if (it->second >= descriptorCount && (bestIt == mFreeRanges.end() || it->second < bestIt->second)) {
+            bestIt = it;
+            if (it->second == descriptorCount) {
+                break;
+            }
+        }
+    }
+
+    if (bestIt == mFreeRanges.end()) {
+        return sInvalidOffset;
+    }
+
+    const std::uint32_t offset = bestIt->first;
+    const std::uint32_t remainingSize = bestIt->second - descriptorCount;
+    mFreeRanges.erase(bestIt);
+    if (remainingSize > 0U) {
+        mFreeRanges[offset + descriptorCount] = remainingSize;
+    }
+
+    mAllocatedDescriptorCount += descriptorCount;
+    if (mAllocatedDescriptorCount > mMaxAllocatedDescriptorCount) {
+        mMaxAllocatedDescriptorCount = mAllocatedDescriptorCount;
+    }
+
+    return offset;
+}
+
+void
+DescriptorRangeAllocator::Free(const std::uint32_t offset,
+                               const std::uint32_t descriptorCount) noexcept
+{
+    BRE_ASSERT(descriptorCount > 0U);
+    BRE_ASSERT(offset + descriptorCount <= mCapacity);
+    BRE_ASSERT(descriptorCount <= mAllocatedDescriptorCount);
+
+    std::uint32_t rangeOffset = offset;
+    std::uint32_t rangeSize = descriptorCount;
+
+    // Coalesce with the next free range
+    std::map<std::uint32_t, std::uint32_t>::iterator nextIt = mFreeRanges.lower_bound(offset);
+    BRE_ASSERT(nextIt == mFreeRanges.end() || offset + descriptorCount <= nextIt->first);
+    if (nextIt != mFreeRanges.end() && nextIt->first == offset + descriptorCount) {
+        rangeSize += nextIt->second;
+        nextIt = mFreeRanges.erase(nextIt);
+    }
+
+    // Coalesce with the previous free range
+    if (nextIt != mFreeRanges.begin()) {
+        std::map<std::uint32_t, std::uint32_t>::iterator previousIt = std::prev(nextIt);
+        BRE_ASSERT(previousIt->first + previousIt->second <= offset);
+        if (previousIt->first + previousIt->second == offset) {
+            rangeOffset = previousIt->first;
+            rangeSize += previousIt->second;
+            mFreeRanges.erase(previousIt);
+        }
+    }
+
+    mFreeRanges[rangeOffset] = rangeSize;
+    mAllocatedDescriptorCount -= descriptorCount;
+}
+
+DescriptorRangeAllocator::Statistics
+DescriptorRangeAllocator::GetStatistics() const noexcept
+{
+    Statistics statistics;
+    statistics.mCapacity = mCapacity;
+    statistics.mAllocatedDescriptorCount = mAllocatedDescriptorCount;
+    statistics.mMaxAllocatedDescriptorCount = mMaxAllocatedDescriptorCount;
+    statistics.mFreeRangeCount = static_cast<std::uint32_t>(mFreeRanges.size());
+    for (const std::pair<const std::uint32_t, std::uint32_t>& freeRange : mFreeRanges) {
+        if (freeRange.second > statistics.mLargestFreeRangeSize) {
+            statistics.mLargestFreeRangeSize = freeRange.second;
+        }
+    }
+
+    return statistics;
+}
+
+float
+DescriptorRangeAllocator::GetFragmentation() const noexcept
+{
+    const std::uint32_t freeDescriptorCount = mCapacity - mAllocatedDescriptorCount;
+    if (freeDescriptorCount == 0U) {
+        return 0.0f;
+    }
+
+    const Statistics statistics = GetStatistics();
+    return 1.0f - static_cast<float>(statistics.mLargestFreeRangeSize) / freeDescriptorCount;
+}
+}
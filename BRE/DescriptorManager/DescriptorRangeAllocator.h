@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+namespace BRE {
+///
+/// @brief Allocator of contiguous descriptor ranges in a descriptor heap.
+///
+/// It works over descriptor offsets (not over the heap), so it does not depend on the device.
+/// Free ranges are kept sorted by offset in a free list. Allocate() picks the smallest
+/// free range that fits (best fit), and Free() coalesces the range with its neighbors.
+/// It is not thread safe.
+///
+class DescriptorRangeAllocator {
+public:
+    ///
+    /// @brief Allocator statistics
+    ///
+    struct Statistics {
+        std::uint32_t mCapacity{ 0U };
+        std::uint32_t mAllocatedDescriptorCount{ 0U };
+        std::uint32_t mMaxAllocatedDescriptorCount{ 0U };
+        std::uint32_t mFreeRangeCount{ 0U };
+        std::uint32_t mLargestFreeRangeSize{ 0U };
+    };
+
+    // Offset returned by Allocate() when there is no free range that fits.
+    static const std::uint32_t sInvalidOffset{ 0xFFFFFFFFU };
+
+    ///
+    /// @brief DescriptorRangeAllocator constructor
+    /// @param capacity The number of descriptors in the heap
+    ///
+    explicit DescriptorRangeAllocator(const std::uint32_t capacity);
+
+    ~DescriptorRangeAllocator() = default;
+    DescriptorRangeAllocator(const DescriptorRangeAllocator&) = delete;
+    const DescriptorRangeAllocator& operator=(const DescriptorRangeAllocator&) = delete;
+    DescriptorRangeAllocator(DescriptorRangeAllocator&&) = default;
+    DescriptorRangeAllocator& operator=(DescriptorRangeAllocator&&) = default;
+
+    ///
+    /// @brief Allocate a range of contiguous descriptors
+    /// @param descriptorCount The number of descriptors. It must be greater than zero.
+    /// @return The offset of the first descriptor, or sInvalidOffset if there is not a free range that fits.
+    ///
+    std::uint32_t Allocate(const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief Free a range allocated with Allocate()
+    /// @param offset The offset of the first descriptor
+    /// @param descriptorCount The number of descriptors of the allocation
+    ///
+    void Free(const std::uint32_t offset,
+              const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief Get statistics
+    /// @return Statistics
+    ///
+    Statistics GetStatistics() const noexcept;
+
+    ///
+    /// @brief Get the fragmentation of free descriptors
+    /// @return Zero if all free descriptors are contiguous, and it tends to one
+    /// while free descriptors are split into more and smaller ranges.
+    ///
+    float GetFragmentation() const noexcept;
+
+private:
+    // Free ranges. The key is the offset and the value is the size.
+    std::map<std::uint32_t, std::uint32_t> mFreeRanges;
+
+    std::uint32_t mCapacity{ 0U };
+    std::uint32_t mAllocatedDescriptorCount{ 0U };
+    std::uint32_t mMaxAllocatedDescriptorCount{ 0U };
+};
+}
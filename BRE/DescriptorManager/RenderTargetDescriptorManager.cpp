@@ -4,6 +4,7 @@
 
 #include <DirectXManager\DirectXManager.h>
 #include <DXUtils/d3dx12.h>
+#include <ResourceManager\MemoryBudget.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
@@ -24,6 +25,7 @@ RenderTargetDescriptorManager::Init(const std::uint32_t numDescriptorsInRenderTa
     mMutex.lock();
     BRE_CHECK_HR(DirectXManager::GetDevice().CreateDescriptorHeap(&renderTargetViewDescriptorHeapDescriptor,
                                                                   IID_PPV_ARGS(mRenderTargetViewDescriptorHeap.GetAddressOf())));
+    MemoryBudget::AddDescriptorHeapAllocation(*mRenderTargetViewDescriptorHeap.Get());
     mMutex.unlock();
 
     mCurrentRenderTargetViewDescriptorHandle = mRenderTargetViewDescriptorHeap->GetGPUDescriptorHandleForHeapStart();
@@ -0,0 +1,140 @@
+#include "ShaderResourceViewCache.h"
+
+#include <cstring>
+#include <functional>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+namespace {
+///
+/// @brief Computes the FNV-1a hash of a view descriptor
+/// @param descriptor View descriptor
+/// @return Hash
+///
+std::size_t
+HashViewDescriptor(const D3D12_SHADER_RESOURCE_VIEW_DESC& descriptor) noexcept
+{
+    const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(&descriptor);
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0UL; i < sizeof(descriptor); ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return static_cast<std::size_t>(hash);
+}
+}
+
+bool
+ShaderResourceViewCache::ViewKey::operator==(const ViewKey& other) const noexcept
+{
+    return mResource == other.mResource &&
+        mDescriptorHash == other.mDescriptorHash &&
+        std::memcmp(&mDescriptor, &other.mDescriptor, sizeof(mDescriptor)) == 0;
+}
+
+std::size_t
+ShaderResourceViewCache::ViewKeyHasher::operator()(const ViewKey& key) const noexcept
+{
+    return std::hash<const void*>()(key.mResource) ^ (key.mDescriptorHash * 31UL);
+}
+
+ShaderResourceViewCache::ShaderResourceViewCache(const std::uint32_t capacity)
+    : mCapacity(capacity)
+{
+    BRE_ASSERT(capacity > 0U);
+}
+
+std::uint32_t
+ShaderResourceViewCache::AcquireView(const void* resource,
+                                     const D3D12_SHADER_RESOURCE_VIEW_DESC& descriptor,
+                                     bool& isNewView) noexcept
+{
+    BRE_ASSERT(resource != nullptr);
+
+    ViewKey viewKey;
+    viewKey.mResource = resource;
+    viewKey.mDescriptor = descriptor;
+    viewKey.mDescriptorHash = HashViewDescriptor(descriptor);
+
+    const auto indexIt = mIndexByKey.find(viewKey);
+    if (indexIt != mIndexByKey.end()) {
+        ++mViews[indexIt->second].mReferenceCount;
+        isNewView = false;
+        return indexIt->second;
+    }
+
+    std::uint32_t index;
+    if (mFreeIndices.empty() == false) {
+        index = mFreeIndices.back();
+        mFreeIndices.pop_back();
+    } else if (mViews.size() < mCapacity) {
+        index = static_cast<std::uint32_t>(mViews.size());
+        mViews.push_back(View());
+    } else {
+        isNewView = false;
+        return sInvalidIndex;
+    }
+
+    View& view = mViews[index];
+    BRE_ASSERT(view.mReferenceCount == 0U);
+    view.mKey = viewKey;
+    view.mReferenceCount = 1U;
+    mIndexByKey.insert(std::make_pair(viewKey, index));
+
+    isNewView = true;
+
+    return index;
+}
+
+bool
+ShaderResourceViewCache::ReleaseView(const std::uint32_t index) noexcept
+{
+    BRE_ASSERT(index < mViews.size());
+
+    View& view = mViews[index];
+    BRE_ASSERT(view.mReferenceCount > 0U);
+    --view.mReferenceCount;
+    if (view.mReferenceCount > 0U) {
+        return false;
+    }
+
+    FreeView(index);
+
+    return true;
+}
+
+std::uint32_t
+ShaderResourceViewCache::RemoveResourceViews(const void* resource) noexcept
+{
+    std::uint32_t removedViewCount = 0U;
+    const std::uint32_t viewCount = static_cast<std::uint32_t>(mViews.size());
+    for (std::uint32_t i = 0U; i < viewCount; ++i) {
+        View& view = mViews[i];
+        if (view.mReferenceCount > 0U && view.mKey.mResource == resource) {
+            view.mReferenceCount = 0U;
+            FreeView(i);
+            ++removedViewCount;
+        }
+    }
+
+    return removedViewCount;
+}
+
+std::uint32_t
+ShaderResourceViewCache::GetReferenceCount(const std::uint32_t index) const noexcept
+{
+    BRE_ASSERT(index < mViews.size());
+    return mViews[index].mReferenceCount;
+}
+
+void
+ShaderResourceViewCache::FreeView(const std::uint32_t index) noexcept
+{
+    View& view = mViews[index];
+    mIndexByKey.erase(view.mKey);
+    view.mKey = ViewKey();
+    mFreeIndices.push_back(index);
+}
+}
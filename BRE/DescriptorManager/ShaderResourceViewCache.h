@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <unordered_map>
+#include <vector>
+
+namespace BRE {
+///
+/// @brief Cache of shader resource views in a range of descriptors
+///
+/// Views are keyed by resource and view descriptor, so all the users of the same view
+/// share a single descriptor. Each view has a reference count, and its descriptor index
+/// is freed for reuse when the last reference is released.
+/// It works over descriptor indices (not over the heap), so it does not depend on the device:
+/// the caller creates the view when AcquireView() returns a new index.
+/// It is not thread safe.
+///
+class ShaderResourceViewCache {
+public:
+    // Index returned by AcquireView() when all the descriptors are used.
+    static const std::uint32_t sInvalidIndex{ 0xFFFFFFFFU };
+
+    ///
+    /// @brief ShaderResourceViewCache constructor
+    /// @param capacity The number of descriptors of the range
+    ///
+    explicit ShaderResourceViewCache(const std::uint32_t capacity);
+
+    ~ShaderResourceViewCache() = default;
+    ShaderResourceViewCache(const ShaderResourceViewCache&) = delete;
+    const ShaderResourceViewCache& operator=(const ShaderResourceViewCache&) = delete;
+    ShaderResourceViewCache(ShaderResourceViewCache&&) = default;
+    ShaderResourceViewCache& operator=(ShaderResourceViewCache&&) = default;
+
+    ///
+    /// @brief Get the descriptor index of a view, and add a reference to it
+    /// @param resource Resource of the view. It is not dereferenced.
+    /// @param descriptor Shader resource view descriptor. It must be zero initialized
+    /// before filling it, because it is compared byte by byte.
+    /// @param isNewView Output flag. It is true if the view was not in the cache, and
+    /// then the caller must create it in the returned descriptor index.
+    /// @return The descriptor index, or sInvalidIndex if all the descriptors are used.
+    ///
+    std::uint32_t AcquireView(const void* resource,
+                              const D3D12_SHADER_RESOURCE_VIEW_DESC& descriptor,
+                              bool& isNewView) noexcept;
+
+    ///
+    /// @brief Release a reference to a view
+    /// @param index Descriptor index returned by AcquireView()
+    /// @return True if it was the last reference, so the descriptor index is free.
+    ///
+    bool ReleaseView(const std::uint32_t index) noexcept;
+
+    ///
+    /// @brief Remove all the views of a resource, whatever their reference counts
+    ///
+    /// It is used when the resource is destroyed, so its address can be reused.
+    ///
+    /// @param resource Resource
+    /// @return The number of removed views
+    ///
+    std::uint32_t RemoveResourceViews(const void* resource) noexcept;
+
+    ///
+    /// @brief Get the reference count of a view
+    /// @param index Descriptor index returned by AcquireView()
+    /// @return The reference count, or zero if the index is free.
+    ///
+    std::uint32_t GetReferenceCount(const std::uint32_t index) const noexcept;
+
+    ///
+    /// @brief Get the number of views in the cache
+    /// @return Number of views
+    ///
+    std::uint32_t GetViewCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(mIndexByKey.size());
+    }
+
+private:
+    struct ViewKey {
+        bool operator==(const ViewKey& other) const noexcept;
+
+        const void* mResource{ nullptr };
+        D3D12_SHADER_RESOURCE_VIEW_DESC mDescriptor{};
+        std::size_t mDescriptorHash{ 0UL };
+    };
+
+    struct ViewKeyHasher {
+        std::size_t operator()(const ViewKey& key) const noexcept;
+    };
+
+    struct View {
+        ViewKey mKey;
+        std::uint32_t mReferenceCount{ 0U };
+    };
+
+    ///
+    /// @brief Free a descriptor index and forget its view
+    /// @param index Descriptor index of a view in the cache
+    ///
+    void FreeView(const std::uint32_t index) noexcept;
+
+    std::unordered_map<ViewKey, std::uint32_t, ViewKeyHasher> mIndexByKey;
+
+    // View by descriptor index. Free indices have zero references.
+    std::vector<View> mViews;
+    std::vector<std::uint32_t> mFreeIndices;
+    std::uint32_t mCapacity{ 0U };
+};
+}
@@ -0,0 +1,22 @@
+#include "TransientDescriptorRing.h"
+
+namespace BRE {
+TransientDescriptorRing::TransientDescriptorRing(const std::uint32_t firstOffset,
+                                                 const std::uint32_t descriptorCountPerFrame,
+                                                 const std::uint32_t frameCount)
+    : mRing(firstOffset, descriptorCountPerFrame, frameCount)
+{}
+
+std::uint32_t
+TransientDescriptorRing::Allocate(const std::uint32_t descriptorCount) noexcept
+{
+    // Descriptor tables only need contiguous descriptors
+    return mRing.Allocate(descriptorCount, 1U);
+}
+
+std::uint64_t
+TransientDescriptorRing::EndFrame(const std::uint64_t fenceValue) noexcept
+{
+    return mRing.EndFrame(fenceValue);
+}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+#include <Utils\FramePartitionedRing.h>
+
+namespace BRE {
+///
+/// @brief Linear allocator of transient descriptors, partitioned by frame.
+///
+/// It is a FramePartitionedRing of descriptors. Each partition is reclaimed when the GPU
+/// finishes the frame that used it (see FramePartitionedRing).
+///
+class TransientDescriptorRing {
+public:
+    // Offset returned by Allocate() when the partition of the current frame is full.
+    static const std::uint32_t sInvalidOffset{ FramePartitionedRing<std::uint32_t>::sInvalidOffset };
+
+    ///
+    /// @brief TransientDescriptorRing constructor
+    /// @param firstOffset The offset of the first descriptor of the ring in the heap
+    /// @param descriptorCountPerFrame The number of descriptors of each partition
+    /// @param frameCount The number of partitions. It must be greater than zero.
+    ///
+    TransientDescriptorRing(const std::uint32_t firstOffset,
+                            const std::uint32_t descriptorCountPerFrame,
+                            const std::uint32_t frameCount);
+
+    ~TransientDescriptorRing() = default;
+    TransientDescriptorRing(const TransientDescriptorRing&) = delete;
+    const TransientDescriptorRing& operator=(const TransientDescriptorRing&) = delete;
+    TransientDescriptorRing(TransientDescriptorRing&&) = delete;
+    TransientDescriptorRing& operator=(TransientDescriptorRing&&) = delete;
+
+    ///
+    /// @brief Allocate contiguous descriptors in the partition of the current frame.
+    ///
+    /// This method is thread safe and lock free.
+    ///
+    /// @param descriptorCount The number of descriptors. It must be greater than zero.
+    /// @return The offset of the first descriptor, or sInvalidOffset if the partition is full.
+    ///
+    std::uint32_t Allocate(const std::uint32_t descriptorCount) noexcept;
+
+    ///
+    /// @brief End the current frame and begin the next one.
+    ///
+    /// See FramePartitionedRing::EndFrame()
+    ///
+    /// @param fenceValue Fence value signaled at the end of the current frame
+    /// @return The fence value that must complete before allocating descriptors
+    /// in the new current partition. Zero if the partition was not used yet.
+    ///
+    std::uint64_t EndFrame(const std::uint64_t fenceValue) noexcept;
+
+    ///
+    /// @brief Get the maximum number of descriptors allocated in a frame
+    /// @return The maximum number of descriptors
+    ///
+    __forceinline std::uint32_t GetMaxAllocatedDescriptorCountPerFrame() const noexcept
+    {
+        return mRing.GetMaxAllocatedSizePerFrame();
+    }
+
+private:
+    FramePartitionedRing<std::uint32_t> mRing;
+};
+}
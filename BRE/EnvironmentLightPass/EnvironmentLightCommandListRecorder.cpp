@@ -7,7 +7,6 @@
 #include <PSOManager/PSOManager.h>
 #include <RootSignatureManager\RootSignatureManager.h>
 #include <ShaderManager\ShaderManager.h>
-#include <ShaderUtils\CBuffers.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
@@ -74,16 +73,13 @@ EnvironmentLightCommandListRecorder::Init(ID3D12Resource& diffuseIrradianceCubeM
 }
 
 std::uint32_t
-EnvironmentLightCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept
+EnvironmentLightCommandListRecorder::RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                                               const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
     BRE_ASSERT(sRootSignature != nullptr);
 
-    // Update frame constants
-    UploadBuffer& uploadFrameCBuffer(mFrameUploadCBufferPerFrame.GetNextFrameCBuffer());
-    uploadFrameCBuffer.CopyData(0U, &frameCBuffer, sizeof(frameCBuffer));
-
     ID3D12GraphicsCommandList& commandList = mCommandListPerFrame.ResetCommandListWithNextCommandAllocator(sPSO);
 
     commandList.RSSetViewports(1U, &ApplicationSettings::sScreenViewport);
@@ -94,9 +90,8 @@ EnvironmentLightCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffe
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
 
     commandList.SetGraphicsRootSignature(sRootSignature);
-    const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuVAddress(uploadFrameCBuffer.GetResource().GetGPUVirtualAddress());
-    commandList.SetGraphicsRootConstantBufferView(0U, frameCBufferGpuVAddress);
-    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuVAddress);
+    commandList.SetGraphicsRootConstantBufferView(0U, frameCBufferGpuAddress);
+    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuAddress);
     commandList.SetGraphicsRootDescriptorTable(2U, mGeometryBufferShaderResourceViewsBegin);
     commandList.SetGraphicsRootDescriptorTable(3U, mDiffuseAndSpecularIrradianceTextureShaderResourceViews);
     commandList.SetGraphicsRootDescriptorTable(4U, mAmbientAccessibilityBufferShaderResourceView);
@@ -106,7 +101,7 @@ EnvironmentLightCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffe
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
@@ -1,11 +1,9 @@
 #pragma once
 
+#include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandListPerFrame.h>
-#include <ResourceManager\FrameUploadCBufferPerFrame.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible of recording of command lists for environment light pass.
 ///
@@ -50,10 +48,12 @@ public:
     ///
     /// Init() must be called first
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                            const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
@@ -73,8 +73,6 @@ private:
 
     CommandListPerFrame mCommandListPerFrame;
 
-    FrameUploadCBufferPerFrame mFrameUploadCBufferPerFrame;
-
     D3D12_CPU_DESCRIPTOR_HANDLE mOutputColorBufferRenderTargetView{ 0UL };
 
     // First descriptor in the list. All the others are contiguous
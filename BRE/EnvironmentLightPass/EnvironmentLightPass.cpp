@@ -44,14 +44,20 @@ EnvironmentLightPass::Init(ID3D12Resource& baseColorMetalnessBuffer,
 }
 
 std::uint32_t
-EnvironmentLightPass::Execute(const FrameCBuffer& frameCBuffer) noexcept
+EnvironmentLightPass::Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                              tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
 
     std::uint32_t commandListCount = 0U;
 
     commandListCount += RecordAndPushPrePassCommandLists();
-    commandListCount += mEnvironmentLightRecorder.RecordAndPushCommandLists(frameCBuffer);
+
+    const std::uint32_t commandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(1U);
+    recordingTaskGroup.run([this, frameCBufferGpuAddress, commandListSlot]() {
+        mEnvironmentLightRecorder.RecordAndPushCommandLists(frameCBufferGpuAddress, commandListSlot);
+    });
+    ++commandListCount;
 
     return commandListCount;
 }
@@ -75,33 +81,33 @@ EnvironmentLightPass::RecordAndPushPrePassCommandLists() noexcept
 
     D3D12_RESOURCE_BARRIER barriers[5U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*mAmbientAccessibilityBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mAmbientAccessibilityBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mAmbientAccessibilityBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mBaseColorMetalnessBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mBaseColorMetalnessBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mBaseColorMetalnessBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mNormalRoughnessBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mNormalRoughnessBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mNormalRoughnessBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mDepthBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mDepthBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mDepthBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mAmbientAccessibilityBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mAmbientAccessibilityBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mAmbientAccessibilityBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
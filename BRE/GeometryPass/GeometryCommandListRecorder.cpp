@@ -1,8 +1,22 @@
 #include "GeometryCommandListRecorder.h"
 
+#include <algorithm>
+
+#include <CommandListExecutor\CommandListExecutor.h>
+#include <DescriptorManager\BindlessTextureTable.h>
+#include <MathUtils\MathUtils.h>
+#include <ResourceManager\UploadBufferManager.h>
+#include <ShaderUtils\CBuffers.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
+GeometryCommandListRecorder::~GeometryCommandListRecorder()
+{
+    for (const std::uint32_t textureIndex : mTextureIndices) {
+        BindlessTextureTable::ReleaseTextureIndex(textureIndex);
+    }
+}
+
 bool
 GeometryCommandListRecorder::IsDataValid() const noexcept
 {
@@ -15,8 +29,8 @@ GeometryCommandListRecorder::IsDataValid() const noexcept
     }
 
     return
-        mObjectUploadCBuffers != nullptr &&
-        mObjectCBufferViewsBegin.ptr != 0UL &&
+        mObjectUploadBuffer != nullptr &&
+        mMaterialUploadBuffer != nullptr &&
         geometryDataCount != 0UL;
 }
 
@@ -32,5 +46,117 @@ GeometryCommandListRecorder::Init(const D3D12_CPU_DESCRIPTOR_HANDLE* geometryBuf
     mGeometryBufferRenderTargetViews = geometryBufferRenderTargetViews;
     mGeometryBufferRenderTargetViewCount = geometryBufferRenderTargetViewCount;
     mDepthBufferView = depthBufferView;
+
+    // Draw calls are numbered in geometry data order
+    const std::size_t geometryDataCount{ mGeometryDataVec.size() };
+    mFirstDrawIndexByGeometryData.resize(geometryDataCount + 1UL);
+    mFirstDrawIndexByGeometryData[0U] = 0U;
+    for (std::size_t i = 0UL; i < geometryDataCount; ++i) {
+        const std::uint32_t drawCount = static_cast<std::uint32_t>(mGeometryDataVec[i].mWorldMatrices.size());
+        mFirstDrawIndexByGeometryData[i + 1UL] = mFirstDrawIndexByGeometryData[i] + drawCount;
+    }
+}
+
+void
+GeometryCommandListRecorder::BeginFrame(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                        const std::uint32_t commandListCount) noexcept
+{
+    BRE_ASSERT(commandListCount > 0U);
+    BRE_ASSERT(commandListCount <= GetDrawCount());
+
+    mFrameCBufferGpuAddress = frameCBufferGpuAddress;
+
+    while (mCommandListPerFrameByChunk.size() < commandListCount) {
+        mCommandListPerFrameByChunk.push_back(std::make_unique<CommandListPerFrame>());
+    }
+
+    mCommandListCount = commandListCount;
+}
+
+void
+GeometryCommandListRecorder::RecordAndPushCommandList(const std::uint32_t commandListIndex,
+                                                      const std::uint32_t commandListSlot) noexcept
+{
+    BRE_ASSERT(commandListIndex < mCommandListCount);
+    BRE_ASSERT(mFrameCBufferGpuAddress != 0UL);
+
+    // Split draw calls in chunks whose sizes differ at most in one draw call.
+    const std::uint64_t drawCount = GetDrawCount();
+    const std::uint32_t beginDrawIndex = static_cast<std::uint32_t>((drawCount * commandListIndex) / mCommandListCount);
+    const std::uint32_t endDrawIndex = static_cast<std::uint32_t>((drawCount * (commandListIndex + 1U)) / mCommandListCount);
+    BRE_ASSERT(beginDrawIndex < endDrawIndex);
+
+    ID3D12GraphicsCommandList& commandList = RecordCommandList(*mCommandListPerFrameByChunk[commandListIndex],
+                                                               beginDrawIndex,
+                                                               endDrawIndex);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
+}
+
+void
+GeometryCommandListRecorder::InitObjectAndMaterialBuffers(const std::vector<BindlessMaterial>& materials) noexcept
+{
+    BRE_ASSERT(materials.empty() == false);
+    BRE_ASSERT(mObjectUploadBuffer == nullptr);
+    BRE_ASSERT(mMaterialUploadBuffer == nullptr);
+
+    const std::uint32_t drawCount = static_cast<std::uint32_t>(materials.size());
+
+    // Structured buffers elements are not padded like constant buffers
+    mObjectUploadBuffer = &UploadBufferManager::CreateUploadBuffer(sizeof(ObjectCBuffer), drawCount);
+    std::uint32_t drawIndex = 0U;
+    ObjectCBuffer objCBuffer;
+    for (const GeometryData& geomData : mGeometryDataVec) {
+        const std::size_t worldMatsCount{ geomData.mWorldMatrices.size() };
+        for (std::size_t j = 0UL; j < worldMatsCount; ++j) {
+            MathUtils::StoreTransposeMatrix(geomData.mWorldMatrices[j],
+                                            objCBuffer.mWorldMatrix);
+            MathUtils::StoreTransposeMatrix(geomData.mInverseTransposeWorldMatrices[j],
+                                            objCBuffer.mInverseTransposeWorldMatrix);
+            objCBuffer.mTextureScale = geomData.mTextureScales[j];
+            BRE_ASSERT(drawIndex < drawCount);
+            mObjectUploadBuffer->CopyData(drawIndex, &objCBuffer, sizeof(objCBuffer));
+            ++drawIndex;
+        }
+    }
+    BRE_ASSERT(drawIndex == drawCount);
+
+    mMaterialUploadBuffer = &UploadBufferManager::CreateUploadBuffer(sizeof(BindlessMaterial), drawCount);
+    mMaterialUploadBuffer->CopyDataBatch(0U,
+                                         materials.data(),
+                                         sizeof(BindlessMaterial),
+                                         sizeof(BindlessMaterial),
+                                         drawCount);
+}
+
+std::uint32_t
+GeometryCommandListRecorder::AcquireTextureIndex(ID3D12Resource& texture) noexcept
+{
+    const std::uint32_t textureIndex = BindlessTextureTable::AcquireTextureIndex(texture);
+    mTextureIndices.push_back(textureIndex);
+
+    return textureIndex;
+}
+
+void
+GeometryCommandListRecorder::SetBindlessRootArguments(ID3D12GraphicsCommandList& commandList) const noexcept
+{
+    BRE_ASSERT(mObjectUploadBuffer != nullptr);
+    BRE_ASSERT(mMaterialUploadBuffer != nullptr);
+
+    commandList.SetGraphicsRootShaderResourceView(1U, mObjectUploadBuffer->GetResource().GetGPUVirtualAddress());
+    commandList.SetGraphicsRootShaderResourceView(2U, mMaterialUploadBuffer->GetResource().GetGPUVirtualAddress());
+    commandList.SetGraphicsRootDescriptorTable(3U, BindlessTextureTable::GetDescriptorTableBegin());
+}
+
+std::size_t
+GeometryCommandListRecorder::GetGeometryDataIndex(const std::uint32_t drawIndex) const noexcept
+{
+    BRE_ASSERT(drawIndex < GetDrawCount());
+
+    // First geometry data whose first draw call is greater than drawIndex, is the next one.
+    const std::vector<std::uint32_t>::const_iterator it = std::upper_bound(mFirstDrawIndexByGeometryData.begin(),
+                                                                           mFirstDrawIndexByGeometryData.end(),
+                                                                           drawIndex);
+    return static_cast<std::size_t>(it - mFirstDrawIndexByGeometryData.begin()) - 1UL;
 }
 }
\ No newline at end of file
@@ -5,19 +5,24 @@
 #include <memory>
 #include <vector>
 
+#include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandListPerFrame.h>
-#include <ResourceManager\FrameUploadCBufferPerFrame.h>
+#include <GeometryPass\Shaders\BindlessMaterial.h>
+#include <ResourceManager\UploadBuffer.h>
 #include <ResourceManager/VertexAndIndexBufferCreator.h>
+#include <Utils\DebugUtils.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible to record command lists for deferred shading geometry pass
 ///
+/// Draw calls (one per world matrix of each GeometryData) can be split into several
+/// chunks, each of them recorded in its own command list.
+/// Draw calls are bindless: object data and materials are in buffers indexed by the
+/// draw call index (a root constant), and materials index textures in BindlessTextureTable.
 /// Steps:
-/// - Inherit from it and reimplement RecordAndPushCommandLists() method
-/// - Call RecordAndPushCommandLists() to create command lists to execute in the GPU
+/// - Inherit from it and reimplement RecordCommandList() method
+/// - Call BeginFrame() and then RecordAndPushCommandList() per chunk to create command lists to execute in the GPU
 ///
 class GeometryCommandListRecorder {
 public:
@@ -32,8 +37,14 @@ public:
     };
 
     GeometryCommandListRecorder() = default;
-    virtual ~GeometryCommandListRecorder()
-    {}
+
+    ///
+    /// @brief GeometryCommandListRecorder destructor
+    ///
+    /// It releases the texture indices acquired with AcquireTextureIndex(), so the GPU
+    /// must not be using them anymore.
+    ///
+    virtual ~GeometryCommandListRecorder();
 
     GeometryCommandListRecorder(const GeometryCommandListRecorder&) = delete;
     const GeometryCommandListRecorder& operator=(const GeometryCommandListRecorder&) = delete;
@@ -51,14 +62,42 @@ public:
               const D3D12_CPU_DESCRIPTOR_HANDLE& depthBufferView) noexcept;
 
     ///
-    /// @brief Records and pushes command lists to CommandListExecutor
+    /// @brief Get the number of draw calls of the recorder
     ///
     /// Init() must be called first
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
-    /// @return The number of pushed command lists
+    /// @return The number of draw calls, one per world matrix in the geometry data.
     ///
-    virtual std::uint32_t RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept = 0;
+    __forceinline std::uint32_t GetDrawCount() const noexcept
+    {
+        BRE_ASSERT(mFirstDrawIndexByGeometryData.empty() == false);
+        return mFirstDrawIndexByGeometryData.back();
+    }
+
+    ///
+    /// @brief Prepares the recorder to record a new frame
+    ///
+    /// Init() must be called first. It must be called once per frame, before
+    /// RecordAndPushCommandList(), and it must not be called concurrently.
+    ///
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param commandListCount The number of command lists the draw calls are split into.
+    /// It must be greater than zero and not greater than GetDrawCount().
+    ///
+    void BeginFrame(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                    const std::uint32_t commandListCount) noexcept;
+
+    ///
+    /// @brief Records a chunk of the draw calls in its own command list and pushes it to CommandListExecutor
+    ///
+    /// BeginFrame() must be called first. Different chunks can be recorded concurrently.
+    ///
+    /// @param commandListIndex Index of the chunk of draw calls to record. It must be
+    /// lower than the command list count of BeginFrame()
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
+    ///
+    void RecordAndPushCommandList(const std::uint32_t commandListIndex,
+                                  const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
@@ -67,17 +106,83 @@ public:
     virtual bool IsDataValid() const noexcept;
 
 protected:
-    CommandListPerFrame mCommandListPerFrame;
+    ///
+    /// @brief Records a range of draw calls
+    ///
+    /// Inherit from this class and reimplement this method. It can be called
+    /// concurrently with different command lists and draw ranges.
+    ///
+    /// @param commandListPerFrame Command list to reset and record
+    /// @param beginDrawIndex First draw call to record
+    /// @param endDrawIndex One past the last draw call to record
+    /// @return The recorded and closed command list
+    ///
+    virtual ID3D12GraphicsCommandList& RecordCommandList(CommandListPerFrame& commandListPerFrame,
+                                                         const std::uint32_t beginDrawIndex,
+                                                         const std::uint32_t endDrawIndex) noexcept = 0;
+
+    ///
+    /// @brief Initializes the object and material buffers
+    ///
+    /// mGeometryDataVec must be filled first. Both buffers have an element per draw call.
+    ///
+    /// @param materials Material per draw call, in draw call order. Its size must be
+    /// equal to the total number of world matrices of mGeometryDataVec.
+    ///
+    void InitObjectAndMaterialBuffers(const std::vector<BindlessMaterial>& materials) noexcept;
+
+    ///
+    /// @brief Get the index of a texture in BindlessTextureTable for a material
+    ///
+    /// The index is released when the recorder is destroyed.
+    ///
+    /// @param texture 2D texture
+    /// @return The index of the texture in BindlessTextureTable
+    ///
+    std::uint32_t AcquireTextureIndex(ID3D12Resource& texture) noexcept;
+
+    ///
+    /// @brief Set the root arguments shared by all the draw calls
+    ///
+    /// They are the root parameters 1 to 3 of the geometry pass root signatures
+    /// (see BindlessMaterial.hlsli). The draw call index (root parameter 0) must
+    /// be set per draw call.
+    ///
+    /// @param commandList Command list to record. Its root signature must be set.
+    ///
+    void SetBindlessRootArguments(ID3D12GraphicsCommandList& commandList) const noexcept;
+
+    ///
+    /// @brief Get the index of the geometry data that contains a draw call
+    /// @param drawIndex Draw call index. It must be lower than GetDrawCount()
+    /// @return Index in mGeometryDataVec
+    ///
+    std::size_t GetGeometryDataIndex(const std::uint32_t drawIndex) const noexcept;
+
+    // One command list per chunk of draw calls. It grows when a frame
+    // needs more command lists than any previous frame.
+    std::vector<std::unique_ptr<CommandListPerFrame>> mCommandListPerFrameByChunk;
+    std::uint32_t mCommandListCount{ 1U };
+
+    // mFirstDrawIndexByGeometryData[i] is the first draw call of mGeometryDataVec[i], and
+    // the last element is the number of draw calls.
+    std::vector<std::uint32_t> mFirstDrawIndexByGeometryData;
+
+    D3D12_GPU_VIRTUAL_ADDRESS mFrameCBufferGpuAddress{ 0UL };
 
     // Base command data. Once you inherits from this class, you should add
     // more class members that represent the extra information you need (like resources, for example)
 
     std::vector<GeometryData> mGeometryDataVec;
 
-    FrameUploadCBufferPerFrame mFrameUploadCBufferPerFrame;
+    // ObjectCBuffer per draw call, read as a structured buffer
+    UploadBuffer* mObjectUploadBuffer{ nullptr };
+
+    // BindlessMaterial per draw call, read as a structured buffer
+    UploadBuffer* mMaterialUploadBuffer{ nullptr };
 
-    UploadBuffer* mObjectUploadCBuffers{ nullptr };
-    D3D12_GPU_DESCRIPTOR_HANDLE mObjectCBufferViewsBegin{ 0U };
+    // BindlessTextureTable indices referenced by the materials
+    std::vector<std::uint32_t> mTextureIndices;
 
     const D3D12_CPU_DESCRIPTOR_HANDLE* mGeometryBufferRenderTargetViews{ nullptr };
     std::uint32_t mGeometryBufferRenderTargetViewCount{ 0U };
@@ -1,5 +1,6 @@
 #include "GeometryPass.h"
 
+#include <chrono>
 #include <d3d12.h>
 #include <DirectXColors.h>
 #include <tbb/parallel_for.h>
@@ -12,9 +13,10 @@
 #include <GeometryPass\Recorders\HeightMappingCommandListRecorder.h>
 #include <GeometryPass\Recorders\NormalMappingCommandListRecorder.h>
 #include <GeometryPass\Recorders\TextureMappingCommandListRecorder.h>
+#include <MathUtils\MathUtils.h>
 #include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\TransientResourceManager.h>
 #include <ResourceStateManager\ResourceStateManager.h>
-#include <ShaderUtils\CBuffers.h>
 #include <Utils\DebugUtils.h>
 
 using namespace DirectX;
@@ -33,14 +35,24 @@ const DXGI_FORMAT sGeometryBufferFormats[D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT]
     DXGI_FORMAT_UNKNOWN
 };
 
+// Number of command lists to record per CPU processor. More than one
+// balances the work when command lists take different time to be recorded.
+const std::uint64_t sCommandListsPerCpuProcessor{ 2UL };
+
+// Draw calls that take less than this time to be recorded are not split
+// in more command lists, because the command list overhead would exceed the gain.
+const std::uint64_t sMinRecordingTimePerCommandListInMicroseconds{ 100UL };
+
 ///
-/// @brief Create geometry buffers and render target views
-/// @param buffers Output list of geometry buffers
-/// @param bufferRenderTargetViews Output geometry buffers render target views
+/// @brief Declare geometry buffers in the TransientResourceManager
+/// @param firstPassIndex Index of the first pass that uses the geometry buffers
+/// @param lastPassIndex Index of the last pass that uses the geometry buffers
+/// @param bufferIds Output list of geometry buffers identifiers
 ///
 void
-CreateGeometryBuffersAndRenderTargetViews(ID3D12Resource* buffers[GeometryPass::BUFFERS_COUNT],
-                                          D3D12_CPU_DESCRIPTOR_HANDLE bufferRenderTargetViews[GeometryPass::BUFFERS_COUNT]) noexcept
+DeclareGeometryBuffers(const std::uint32_t firstPassIndex,
+                       const std::uint32_t lastPassIndex,
+                       std::uint32_t bufferIds[GeometryPass::BUFFERS_COUNT]) noexcept
 {
     // Set shared buffers properties
     D3D12_RESOURCE_DESC resourceDescriptor = D3DFactory::GetResourceDescriptor(ApplicationSettings::sWindowWidth,
@@ -58,9 +70,6 @@ CreateGeometryBuffersAndRenderTargetViews(ID3D12Resource* buffers[GeometryPass::
     };
     BRE_ASSERT(_countof(clearValue) == GeometryPass::BUFFERS_COUNT);
 
-    const D3D12_HEAP_PROPERTIES heapProperties = D3DFactory::GetHeapProperties();
-
-    // Create and store render target views
     const wchar_t* resourceNames[GeometryPass::BUFFERS_COUNT] =
     {
         L"Normal_RoughnessTexture Buffer",
@@ -68,21 +77,36 @@ CreateGeometryBuffersAndRenderTargetViews(ID3D12Resource* buffers[GeometryPass::
     };
     for (std::uint32_t i = 0U; i < GeometryPass::BUFFERS_COUNT; ++i) {
         resourceDescriptor.Format = sGeometryBufferFormats[i];
+        resourceDescriptor.MipLevels = 1U;
 
         clearValue[i].Format = resourceDescriptor.Format;
 
+        bufferIds[i] = TransientResourceManager::DeclareResource(resourceDescriptor,
+                                                                 D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                                 &clearValue[i],
+                                                                 resourceNames[i],
+                                                                 ResourceManager::ResourceStateTrackingType::FULL_TRACKING,
+                                                                 MemoryBudget::Category::G_BUFFERS,
+                                                                 firstPassIndex,
+                                                                 lastPassIndex);
+    }
+}
+
+///
+/// @brief Create geometry buffers render target views
+/// @param buffers List of geometry buffers
+/// @param bufferRenderTargetViews Output geometry buffers render target views
+///
+void
+CreateGeometryBuffersRenderTargetViews(ID3D12Resource* buffers[GeometryPass::BUFFERS_COUNT],
+                                       D3D12_CPU_DESCRIPTOR_HANDLE bufferRenderTargetViews[GeometryPass::BUFFERS_COUNT]) noexcept
+{
+    for (std::uint32_t i = 0U; i < GeometryPass::BUFFERS_COUNT; ++i) {
+        BRE_ASSERT(buffers[i] != nullptr);
+
         D3D12_RENDER_TARGET_VIEW_DESC rtvDescriptor{};
         rtvDescriptor.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
-        rtvDescriptor.Format = resourceDescriptor.Format;
-        resourceDescriptor.MipLevels = 1U;
-        buffers[i] = &ResourceManager::CreateCommittedResource(heapProperties,
-                                                               D3D12_HEAP_FLAG_NONE,
-                                                               resourceDescriptor,
-                                                               D3D12_RESOURCE_STATE_RENDER_TARGET,
-                                                               &clearValue[i],
-                                                               resourceNames[i],
-                                                               ResourceManager::ResourceStateTrackingType::FULL_TRACKING);
-
+        rtvDescriptor.Format = sGeometryBufferFormats[i];
         RenderTargetDescriptorManager::CreateRenderTargetView(*buffers[i],
                                                               rtvDescriptor,
                                                               &bufferRenderTargetViews[i]);
@@ -94,6 +118,13 @@ GeometryPass::GeometryPass(GeometryCommandListRecorders& geometryPassCommandList
     : mGeometryCommandListRecorders(geometryPassCommandListRecorders)
 {}
 
+void
+GeometryPass::DeclareTransientResources(const std::uint32_t passIndex,
+                                        const std::uint32_t lastPassIndex) noexcept
+{
+    DeclareGeometryBuffers(passIndex, lastPassIndex, mGeometryBufferIds);
+}
+
 void
 GeometryPass::Init(const D3D12_CPU_DESCRIPTOR_HANDLE& depthBufferView) noexcept
 {
@@ -101,7 +132,10 @@ GeometryPass::Init(const D3D12_CPU_DESCRIPTOR_HANDLE& depthBufferView) noexcept
 
     BRE_ASSERT(mGeometryCommandListRecorders.empty() == false);
 
-    CreateGeometryBuffersAndRenderTargetViews(mGeometryBuffers, mGeometryBufferRenderTargetViews);
+    for (std::uint32_t i = 0U; i < BUFFERS_COUNT; ++i) {
+        mGeometryBuffers[i] = &TransientResourceManager::GetResource(mGeometryBufferIds[i]);
+    }
+    CreateGeometryBuffersRenderTargetViews(mGeometryBuffers, mGeometryBufferRenderTargetViews);
 
     HeightMappingCommandListRecorder::InitSharedPSOAndRootSignature(sGeometryBufferFormats, BUFFERS_COUNT);
     NormalMappingCommandListRecorder::InitSharedPSOAndRootSignature(sGeometryBufferFormats, BUFFERS_COUNT);
@@ -121,25 +155,98 @@ GeometryPass::Init(const D3D12_CPU_DESCRIPTOR_HANDLE& depthBufferView) noexcept
 }
 
 std::uint32_t
-GeometryPass::Execute(const FrameCBuffer& frameCBuffer) noexcept
+GeometryPass::Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                      tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
 
-    const std::uint32_t geometryPassCommandListCount = static_cast<std::uint32_t>(mGeometryCommandListRecorders.size());
-    std::uint32_t commandListCount = geometryPassCommandListCount;
+    std::uint32_t commandListCount = RecordAndPushPrePassCommandLists();
+
+    // Split the draw calls of each recorder in command lists and build a task per command list.
+    UpdateCommandListCountByRecorder();
+    mRecordingTasks.clear();
+    const std::uint32_t recorderCount = static_cast<std::uint32_t>(mGeometryCommandListRecorders.size());
+    for (std::uint32_t i = 0U; i < recorderCount; ++i) {
+        mGeometryCommandListRecorders[i]->BeginFrame(frameCBufferGpuAddress, mCommandListCountByRecorder[i]);
+        for (std::uint32_t j = 0U; j < mCommandListCountByRecorder[i]; ++j) {
+            RecordingTask recordingTask;
+            recordingTask.mRecorderIndex = i;
+            recordingTask.mCommandListIndex = j;
+            mRecordingTasks.push_back(recordingTask);
+        }
+    }
+
+    const std::uint32_t recordingTaskCount = static_cast<std::uint32_t>(mRecordingTasks.size());
+    commandListCount += recordingTaskCount;
+
+    // Reserve a slot per task, so command lists are executed in recorders order,
+    // no matter the order in which tasks finish.
+    const std::uint32_t firstCommandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(recordingTaskCount);
+
+    // Execute tasks. The parallel for runs in a task, so the following
+    // passes are recorded while geometry command lists are recorded.
+    recordingTaskGroup.run([this, recordingTaskCount, firstCommandListSlot]() {
+        tbb::parallel_for(tbb::blocked_range<std::uint32_t>(0U, recordingTaskCount),
+                          [&](const tbb::blocked_range<std::uint32_t>& r) {
+            for (std::uint32_t i = r.begin(); i != r.end(); ++i) {
+                RecordingTask& recordingTask = mRecordingTasks[i];
+                const std::chrono::steady_clock::time_point beginTime = std::chrono::steady_clock::now();
+                mGeometryCommandListRecorders[recordingTask.mRecorderIndex]->RecordAndPushCommandList(recordingTask.mCommandListIndex,
+                                                                                                      firstCommandListSlot + i);
+                const std::chrono::steady_clock::duration elapsedTime = std::chrono::steady_clock::now() - beginTime;
+                recordingTask.mRecordingTimeInMicroseconds =
+                    static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsedTime).count());
+            }
+        }
+        );
+    });
 
-    commandListCount += RecordAndPushPrePassCommandLists();
+    return commandListCount;
+}
 
-    // Execute tasks
-    std::uint32_t grainSize{ max(1U, (geometryPassCommandListCount) / ApplicationSettings::sCpuProcessorCount) };
-    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, geometryPassCommandListCount, grainSize),
-                      [&](const tbb::blocked_range<size_t>& r) {
-        for (size_t i = r.begin(); i != r.end(); ++i)
-            mGeometryCommandListRecorders[i]->RecordAndPushCommandLists(frameCBuffer);
+void
+GeometryPass::UpdateCommandListCountByRecorder() noexcept
+{
+    const std::size_t recorderCount = mGeometryCommandListRecorders.size();
+    mCommandListCountByRecorder.resize(recorderCount, 1U);
+
+    // Accumulate the recording time of the previous frame tasks
+    mRecordingTimeInMicrosecondsByRecorder.assign(recorderCount, 0UL);
+    std::uint64_t totalRecordingTime = 0UL;
+    for (const RecordingTask& recordingTask : mRecordingTasks) {
+        mRecordingTimeInMicrosecondsByRecorder[recordingTask.mRecorderIndex] += recordingTask.mRecordingTimeInMicroseconds;
+        totalRecordingTime += recordingTask.mRecordingTimeInMicroseconds;
     }
-    );
 
-    return commandListCount;
+    // If there is no measurement yet (first frame), then the draw call count
+    // is used as the recording cost.
+    const bool isRecordingTimeMeasured = totalRecordingTime > 0UL;
+    std::uint64_t totalRecordingCost = 0UL;
+    for (std::size_t i = 0UL; i < recorderCount; ++i) {
+        totalRecordingCost += isRecordingTimeMeasured ?
+            mRecordingTimeInMicrosecondsByRecorder[i] :
+            mGeometryCommandListRecorders[i]->GetDrawCount();
+    }
+
+    if (totalRecordingCost == 0UL) {
+        return;
+    }
+
+    // Distribute command lists proportionally to the recording cost of each recorder.
+    const std::uint64_t targetCommandListCount = ApplicationSettings::sCpuProcessorCount * sCommandListsPerCpuProcessor;
+    for (std::size_t i = 0UL; i < recorderCount; ++i) {
+        const std::uint64_t drawCount = mGeometryCommandListRecorders[i]->GetDrawCount();
+        const std::uint64_t recordingCost = isRecordingTimeMeasured ? mRecordingTimeInMicrosecondsByRecorder[i] : drawCount;
+
+        std::uint64_t commandListCount = (recordingCost * targetCommandListCount + totalRecordingCost - 1UL) / totalRecordingCost;
+        if (isRecordingTimeMeasured) {
+            const std::uint64_t maxCommandListCount = 
+                MathUtils::Max<std::uint64_t>(1UL, mRecordingTimeInMicrosecondsByRecorder[i] / sMinRecordingTimePerCommandListInMicroseconds);
+            commandListCount = MathUtils::Min(commandListCount, maxCommandListCount);
+        }
+
+        mCommandListCountByRecorder[i] = static_cast<std::uint32_t>(MathUtils::Clamp<std::uint64_t>(commandListCount, 1UL, drawCount));
+    }
 }
 
 bool
@@ -170,9 +277,9 @@ GeometryPass::RecordAndPushPrePassCommandLists() noexcept
     D3D12_RESOURCE_BARRIER barriers[BUFFERS_COUNT];
     std::uint32_t barrierCount = 0UL;
     for (std::uint32_t i = 0U; i < BUFFERS_COUNT; ++i) {
-        if (ResourceStateManager::GetResourceState(*mGeometryBuffers[i]) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-            barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mGeometryBuffers[i],
-                                                                                            D3D12_RESOURCE_STATE_RENDER_TARGET);
+        if (ResourceStateManager::TransitionResourceIfNeeded(*mGeometryBuffers[i],
+                                                             D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                             barriers[barrierCount])) {
             ++barrierCount;
         }
     }
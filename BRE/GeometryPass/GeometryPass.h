@@ -1,14 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <tbb/task_group.h>
 #include <vector>
 
 #include <CommandManager\CommandListPerFrame.h>
 #include <GeometryPass\GeometryCommandListRecorder.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible to execute command list recorders related with deferred shading geometry pass
 ///
@@ -28,8 +27,19 @@ public:
     GeometryPass(GeometryPass&&) = delete;
     GeometryPass& operator=(GeometryPass&&) = delete;
 
+    ///
+    /// @brief Declares the geometry buffers in the TransientResourceManager
+    /// @param passIndex Index of this pass in the frame
+    /// @param lastPassIndex Index of the last pass that reads the geometry buffers
+    ///
+    void DeclareTransientResources(const std::uint32_t passIndex,
+                                   const std::uint32_t lastPassIndex) noexcept;
+
     ///
     /// @brief Initializes geometry pass
+    ///
+    /// DeclareTransientResources() must be called first, and then TransientResourceManager::CreateResources().
+    ///
     /// @param depthBufferView Depth buffer view
     ///
     void Init(const D3D12_CPU_DESCRIPTOR_HANDLE& depthBufferView) noexcept;
@@ -68,12 +78,17 @@ public:
     /// @brief Executes the pass
     ///
     /// Init() must be called first. This method can record and
-    /// push command lists to the CommandListExecutor.
+    /// push command lists to the CommandListExecutor. Barrier command lists are
+    /// recorded by the calling thread, in pass order, and the other command lists
+    /// are recorded by tasks run in @p recordingTaskGroup.
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param recordingTaskGroup Task group where recording tasks are run. The caller must wait for it
+    /// before waiting for the execution of the recorded command lists.
     /// @return The number of recorded command lists.
     ///
-    std::uint32_t Execute(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                          tbb::task_group& recordingTaskGroup) noexcept;
 
 private:
     ///
@@ -94,13 +109,34 @@ private:
     ///
     void InitShaderResourceViews() noexcept;
 
+    ///
+    /// @brief Updates the number of command lists each recorder splits its draw calls into.
+    ///
+    /// It distributes ApplicationSettings::sCpuProcessorCount multiple of command lists 
+    /// proportionally to the recording time of each recorder in the previous frame, without
+    /// splitting recorders that are already fast to record.
+    ///
+    void UpdateCommandListCountByRecorder() noexcept;
+
     CommandListPerFrame mPrePassCommandListPerFrame;
 
     // Geometry buffers data
+    std::uint32_t mGeometryBufferIds[BUFFERS_COUNT]{ 0U };
     ID3D12Resource* mGeometryBuffers[BUFFERS_COUNT]{ nullptr };
     D3D12_GPU_DESCRIPTOR_HANDLE mGeometryBufferShaderResourceViews[BUFFERS_COUNT]{ 0UL };
     D3D12_CPU_DESCRIPTOR_HANDLE mGeometryBufferRenderTargetViews[BUFFERS_COUNT]{ 0UL };
 
     GeometryCommandListRecorders& mGeometryCommandListRecorders;
+
+    // A recording task records a chunk of the draw calls of a recorder in its own command list.
+    struct RecordingTask {
+        std::uint32_t mRecorderIndex{ 0U };
+        std::uint32_t mCommandListIndex{ 0U };
+        std::uint64_t mRecordingTimeInMicroseconds{ 0UL };
+    };
+
+    std::vector<RecordingTask> mRecordingTasks;
+    std::vector<std::uint32_t> mCommandListCountByRecorder;
+    std::vector<std::uint64_t> mRecordingTimeInMicrosecondsByRecorder;
 };
 }
\ No newline at end of file
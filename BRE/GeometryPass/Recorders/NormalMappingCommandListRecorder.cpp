@@ -2,7 +2,6 @@
 
 #include <DirectXMath.h>
 
-#include <CommandListExecutor\CommandListExecutor.h>
 #include <DescriptorManager\CbvSrvUavDescriptorManager.h>
 #include <DirectXManager\DirectXManager.h>
 #include <MathUtils/MathUtils.h>
@@ -10,18 +9,16 @@
 #include <ResourceManager/UploadBufferManager.h>
 #include <RootSignatureManager\RootSignatureManager.h>
 #include <ShaderManager\ShaderManager.h>
-#include <ShaderUtils\CBuffers.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
 // Root Signature:
-// "DescriptorTable(CBV(b0), visibility = SHADER_VISIBILITY_VERTEX), " \ 0 -> Object CBuffers
-// "CBV(b1, visibility = SHADER_VISIBILITY_VERTEX), " \ 1 -> Frame CBuffers
-// "CBV(b0, visibility = SHADER_VISIBILITY_PIXEL), " \ 2 -> Frame CBuffer
-// "DescriptorTable(SRV(t0), visibility = SHADER_VISIBILITY_PIXEL), " \ 3 -> Base Color Texture
-// "DescriptorTable(SRV(t1), visibility = SHADER_VISIBILITY_PIXEL), " \ 4 -> Metalness Texture
-// "DescriptorTable(SRV(t2), visibility = SHADER_VISIBILITY_PIXEL), " \ 5 -> Roughness Texture
-// "DescriptorTable(SRV(t3), visibility = SHADER_VISIBILITY_PIXEL), " \ 6 -> Normal Texture
+// "RootConstants(num32BitConstants = 1, b0, space = 1), " \ 0 -> Draw index
+// "SRV(t0, space = 1, visibility = SHADER_VISIBILITY_VERTEX), " \ 1 -> Object buffer
+// "SRV(t1, space = 1), " \ 2 -> Material buffer
+// "DescriptorTable(SRV(t0, space = 2, numDescriptors = unbounded)), " \ 3 -> Bindless textures
+// "CBV(b1, visibility = SHADER_VISIBILITY_VERTEX), " \ 4 -> Frame CBuffers
+// "CBV(b0, visibility = SHADER_VISIBILITY_PIXEL), " \ 5 -> Frame CBuffer
 
 namespace {
 ID3D12PipelineState* sPSO{ nullptr };
@@ -87,16 +84,18 @@ NormalMappingCommandListRecorder::Init(const std::vector<GeometryData>& geometry
         mGeometryDataVec.push_back(geometryDataVector[i]);
     }
 
-    InitCBuffersAndViews(baseColorTextures,
-                         metalnessTextures,
-                         roughnessTextures,
-                         normalTextures);
+    InitBuffers(baseColorTextures,
+                metalnessTextures,
+                roughnessTextures,
+                normalTextures);
 
     BRE_ASSERT(IsDataValid());
 }
 
-std::uint32_t
-NormalMappingCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept
+ID3D12GraphicsCommandList&
+NormalMappingCommandListRecorder::RecordCommandList(CommandListPerFrame& commandListPerFrame,
+                                                    const std::uint32_t beginDrawIndex,
+                                                    const std::uint32_t endDrawIndex) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
@@ -104,12 +103,10 @@ NormalMappingCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer&
     BRE_ASSERT(mGeometryBufferRenderTargetViews != nullptr);
     BRE_ASSERT(mGeometryBufferRenderTargetViewCount != 0U);
     BRE_ASSERT(mDepthBufferView.ptr != 0U);
+    BRE_ASSERT(beginDrawIndex < endDrawIndex);
+    BRE_ASSERT(endDrawIndex <= GetDrawCount());
 
-    // Update frame constants
-    UploadBuffer& uploadFrameCBuffer(mFrameUploadCBufferPerFrame.GetNextFrameCBuffer());
-    uploadFrameCBuffer.CopyData(0U, &frameCBuffer, sizeof(frameCBuffer));
-
-    ID3D12GraphicsCommandList& commandList = mCommandListPerFrame.ResetCommandListWithNextCommandAllocator(sPSO);
+    ID3D12GraphicsCommandList& commandList = commandListPerFrame.ResetCommandListWithNextCommandAllocator(sPSO);
 
     commandList.RSSetViewports(1U, &ApplicationSettings::sScreenViewport);
     commandList.RSSetScissorRects(1U, &ApplicationSettings::sScissorRect);
@@ -121,209 +118,62 @@ NormalMappingCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer&
     ID3D12DescriptorHeap* heaps[] = { &CbvSrvUavDescriptorManager::GetDescriptorHeap() };
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
     commandList.SetGraphicsRootSignature(sRootSignature);
-
-    const std::size_t descHandleIncSize{ DirectXManager::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV) };
-    D3D12_GPU_DESCRIPTOR_HANDLE objectCBufferView(mObjectCBufferViewsBegin);
-    D3D12_GPU_DESCRIPTOR_HANDLE baseColorTextureRenderTargetView(mBaseColorTextureRenderTargetViewsBegin);
-    D3D12_GPU_DESCRIPTOR_HANDLE metalnessTextureRenderTargetView(mMetalnessTextureRenderTargetViewsBegin);
-    D3D12_GPU_DESCRIPTOR_HANDLE roughnessTextureRenderTargetView(mRoughnessTextureRenderTargetViewsBegin);
-    D3D12_GPU_DESCRIPTOR_HANDLE normalTextureRenderTargetView(mNormalTextureRenderTargetViewsBegin);
+    SetBindlessRootArguments(commandList);
 
     commandList.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
     // Set frame constants root parameters
-    D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuVAddress(uploadFrameCBuffer.GetResource().GetGPUVirtualAddress());
-    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuVAddress);
-    commandList.SetGraphicsRootConstantBufferView(2U, frameCBufferGpuVAddress);
+    const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuVAddress(mFrameCBufferGpuAddress);
+    commandList.SetGraphicsRootConstantBufferView(4U, frameCBufferGpuVAddress);
+    commandList.SetGraphicsRootConstantBufferView(5U, frameCBufferGpuVAddress);
 
     // Draw objects
-    const std::size_t geomCount{ mGeometryDataVec.size() };
-    for (std::size_t i = 0UL; i < geomCount; ++i) {
+    std::uint32_t drawIndex = beginDrawIndex;
+    for (std::size_t i = GetGeometryDataIndex(beginDrawIndex); drawIndex < endDrawIndex; ++i) {
         GeometryData& geomData{ mGeometryDataVec[i] };
         commandList.IASetVertexBuffers(0U, 1U, &geomData.mVertexBufferData.mBufferView);
         commandList.IASetIndexBuffer(&geomData.mIndexBufferData.mBufferView);
-        const std::size_t worldMatsCount{ geomData.mWorldMatrices.size() };
-        for (std::size_t j = 0UL; j < worldMatsCount; ++j) {
-            commandList.SetGraphicsRootDescriptorTable(0U, objectCBufferView);
-            objectCBufferView.ptr += descHandleIncSize;
-
-            commandList.SetGraphicsRootDescriptorTable(3U, baseColorTextureRenderTargetView);
-            baseColorTextureRenderTargetView.ptr += descHandleIncSize;
-
-            commandList.SetGraphicsRootDescriptorTable(4U, metalnessTextureRenderTargetView);
-            metalnessTextureRenderTargetView.ptr += descHandleIncSize;
-
-            commandList.SetGraphicsRootDescriptorTable(5U, roughnessTextureRenderTargetView);
-            roughnessTextureRenderTargetView.ptr += descHandleIncSize;
-
-            commandList.SetGraphicsRootDescriptorTable(6U, normalTextureRenderTargetView);
-            normalTextureRenderTargetView.ptr += descHandleIncSize;
-
+        const std::uint32_t geometryDataEndDrawIndex{ MathUtils::Min(endDrawIndex, mFirstDrawIndexByGeometryData[i + 1UL]) };
+        for (; drawIndex < geometryDataEndDrawIndex; ++drawIndex) {
+            // Object data and material are fetched in the shaders with the draw index
+            commandList.SetGraphicsRoot32BitConstant(0U, drawIndex, 0U);
             commandList.DrawIndexedInstanced(geomData.mIndexBufferData.mElementCount, 1U, 0U, 0U, 0U);
         }
     }
 
-    commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    BRE_CHECK_HR(commandList.Close());
 
-    return 1U;
+    return commandList;
 }
 
 bool
 NormalMappingCommandListRecorder::IsDataValid() const noexcept
 {
-    const bool result =
-        GeometryCommandListRecorder::IsDataValid() &&
-        mBaseColorTextureRenderTargetViewsBegin.ptr != 0UL &&
-        mMetalnessTextureRenderTargetViewsBegin.ptr != 0UL &&
-        mRoughnessTextureRenderTargetViewsBegin.ptr != 0UL &&
-        mNormalTextureRenderTargetViewsBegin.ptr != 0UL;
-
-    return result;
+    return GeometryCommandListRecorder::IsDataValid();
 }
 
 void
-NormalMappingCommandListRecorder::InitCBuffersAndViews(const std::vector<ID3D12Resource*>& baseColorTextures,
-                                                       const std::vector<ID3D12Resource*>& metalnessTextures,
-                                                       const std::vector<ID3D12Resource*>& roughnessTextures,
-                                                       const std::vector<ID3D12Resource*>& normalTextures) noexcept
+NormalMappingCommandListRecorder::InitBuffers(const std::vector<ID3D12Resource*>& baseColorTextures,
+                                              const std::vector<ID3D12Resource*>& metalnessTextures,
+                                              const std::vector<ID3D12Resource*>& roughnessTextures,
+                                              const std::vector<ID3D12Resource*>& normalTextures) noexcept
 {
     BRE_ASSERT(baseColorTextures.empty() == false);
     BRE_ASSERT(baseColorTextures.size() == metalnessTextures.size());
     BRE_ASSERT(metalnessTextures.size() == roughnessTextures.size());
     BRE_ASSERT(roughnessTextures.size() == normalTextures.size());
-    BRE_ASSERT(mObjectUploadCBuffers == nullptr);
-
-    const std::uint32_t numResources = static_cast<std::uint32_t>(baseColorTextures.size());
-
-    // Create object cbuffer and fill it
-    const std::size_t objCBufferElemSize{ UploadBuffer::GetRoundedConstantBufferSizeInBytes(sizeof(ObjectCBuffer)) };
-    mObjectUploadCBuffers = &UploadBufferManager::CreateUploadBuffer(objCBufferElemSize, numResources);
-    std::uint32_t k = 0U;
-    const std::size_t geometryDataCount{ mGeometryDataVec.size() };
-    ObjectCBuffer objCBuffer;
-    for (std::size_t i = 0UL; i < geometryDataCount; ++i) {
-        GeometryData& geomData{ mGeometryDataVec[i] };
-        const std::uint32_t worldMatsCount{ static_cast<std::uint32_t>(geomData.mWorldMatrices.size()) };
-        for (std::uint32_t j = 0UL; j < worldMatsCount; ++j) {
-            MathUtils::StoreTransposeMatrix(geomData.mWorldMatrices[j],
-                                            objCBuffer.mWorldMatrix);
-            MathUtils::StoreTransposeMatrix(geomData.mInverseTransposeWorldMatrices[j],
-                                            objCBuffer.mInverseTransposeWorldMatrix);
-            objCBuffer.mTextureScale = geomData.mTextureScales[j];
-            mObjectUploadCBuffers->CopyData(k + j, &objCBuffer, sizeof(objCBuffer));
-        }
-
-        k += worldMatsCount;
-    }
-
-    D3D12_GPU_VIRTUAL_ADDRESS objCBufferGpuAddress{ mObjectUploadCBuffers->GetResource().GetGPUVirtualAddress() };
-
-    // Create object / materials cbuffers descriptors
-    // Create textures SRV descriptors
-    std::vector<D3D12_CONSTANT_BUFFER_VIEW_DESC> objectCbufferViewDescVec;
-    objectCbufferViewDescVec.reserve(numResources);
 
-    std::vector<D3D12_CONSTANT_BUFFER_VIEW_DESC> materialCbufferViewDescVec;
-    materialCbufferViewDescVec.reserve(numResources);
-
-    std::vector<ID3D12Resource*> textureResVec;
-    textureResVec.reserve(numResources);
-    std::vector<D3D12_SHADER_RESOURCE_VIEW_DESC> textureSrvDescVec;
-    textureSrvDescVec.reserve(numResources);
-
-    std::vector<ID3D12Resource*> metalnessResVec;
-    metalnessResVec.reserve(numResources);
-    std::vector<D3D12_SHADER_RESOURCE_VIEW_DESC> metalnessSrvDescVec;
-    metalnessSrvDescVec.reserve(numResources);
-
-    std::vector<ID3D12Resource*> roughnessResVec;
-    roughnessResVec.reserve(numResources);
-    std::vector<D3D12_SHADER_RESOURCE_VIEW_DESC> roughnessSrvDescVec;
-    roughnessSrvDescVec.reserve(numResources);
+    const std::size_t numResources = baseColorTextures.size();
 
-    std::vector<ID3D12Resource*> normalResVec;
-    normalResVec.reserve(numResources);
-    std::vector<D3D12_SHADER_RESOURCE_VIEW_DESC> normalSrvDescVec;
-    normalSrvDescVec.reserve(numResources);
+    // Textures are indexed in the bindless table, so draws that use the same texture share the view.
+    std::vector<BindlessMaterial> materials(numResources);
     for (std::size_t i = 0UL; i < numResources; ++i) {
-        // Object cbuffer desc
-        D3D12_CONSTANT_BUFFER_VIEW_DESC cBufferDesc{};
-        cBufferDesc.BufferLocation = objCBufferGpuAddress + i * objCBufferElemSize;
-        cBufferDesc.SizeInBytes = static_cast<std::uint32_t>(objCBufferElemSize);
-        objectCbufferViewDescVec.push_back(cBufferDesc);
-
-        // Texture descriptor
-        textureResVec.push_back(baseColorTextures[i]);
-
-        D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc{};
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MostDetailedMip = 0;
-        srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-        srvDesc.Format = textureResVec.back()->GetDesc().Format;
-        srvDesc.Texture2D.MipLevels = textureResVec.back()->GetDesc().MipLevels;
-        textureSrvDescVec.push_back(srvDesc);
-
-        // Metalness descriptor
-        metalnessResVec.push_back(metalnessTextures[i]);
-
-        srvDesc = D3D12_SHADER_RESOURCE_VIEW_DESC{};
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MostDetailedMip = 0;
-        srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-        srvDesc.Format = metalnessResVec.back()->GetDesc().Format;
-        srvDesc.Texture2D.MipLevels = metalnessResVec.back()->GetDesc().MipLevels;
-        metalnessSrvDescVec.push_back(srvDesc);
-
-        // Roughness descriptor
-        roughnessResVec.push_back(roughnessTextures[i]);
-
-        srvDesc = D3D12_SHADER_RESOURCE_VIEW_DESC{};
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MostDetailedMip = 0;
-        srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-        srvDesc.Format = roughnessResVec.back()->GetDesc().Format;
-        srvDesc.Texture2D.MipLevels = roughnessResVec.back()->GetDesc().MipLevels;
-        roughnessSrvDescVec.push_back(srvDesc);
-
-        // Normal descriptor
-        normalResVec.push_back(normalTextures[i]);
-
-        srvDesc = D3D12_SHADER_RESOURCE_VIEW_DESC{};
-        srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MostDetailedMip = 0;
-        srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
-        srvDesc.Format = normalResVec.back()->GetDesc().Format;
-        srvDesc.Texture2D.MipLevels = normalResVec.back()->GetDesc().MipLevels;
-        normalSrvDescVec.push_back(srvDesc);
+        materials[i].mBaseColorTextureIndex = AcquireTextureIndex(*baseColorTextures[i]);
+        materials[i].mMetalnessTextureIndex = AcquireTextureIndex(*metalnessTextures[i]);
+        materials[i].mRoughnessTextureIndex = AcquireTextureIndex(*roughnessTextures[i]);
+        materials[i].mNormalTextureIndex = AcquireTextureIndex(*normalTextures[i]);
     }
 
-    mObjectCBufferViewsBegin =
-        CbvSrvUavDescriptorManager::CreateConstantBufferViews(objectCbufferViewDescVec.data(),
-                                                              static_cast<std::uint32_t>(objectCbufferViewDescVec.size()));
-
-    mBaseColorTextureRenderTargetViewsBegin =
-        CbvSrvUavDescriptorManager::CreateShaderResourceViews(textureResVec.data(),
-                                                              textureSrvDescVec.data(),
-                                                              static_cast<std::uint32_t>(textureSrvDescVec.size()));
-
-    mMetalnessTextureRenderTargetViewsBegin =
-        CbvSrvUavDescriptorManager::CreateShaderResourceViews(metalnessResVec.data(),
-                                                              metalnessSrvDescVec.data(),
-                                                              static_cast<std::uint32_t>(metalnessSrvDescVec.size()));
-
-    mRoughnessTextureRenderTargetViewsBegin =
-        CbvSrvUavDescriptorManager::CreateShaderResourceViews(roughnessResVec.data(),
-                                                              roughnessSrvDescVec.data(),
-                                                              static_cast<std::uint32_t>(roughnessSrvDescVec.size()));
-
-    mNormalTextureRenderTargetViewsBegin =
-        CbvSrvUavDescriptorManager::CreateShaderResourceViews(normalResVec.data(),
-                                                              normalSrvDescVec.data(),
-                                                              static_cast<std::uint32_t>(normalSrvDescVec.size()));
+    InitObjectAndMaterialBuffers(materials);
 }
 }
\ No newline at end of file
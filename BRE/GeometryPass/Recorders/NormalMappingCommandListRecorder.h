@@ -40,16 +40,6 @@ public:
               const std::vector<ID3D12Resource*>& roughnessTextures,
               const std::vector<ID3D12Resource*>& normalTextures) noexcept;
 
-    ///
-    /// @brief Records and push command lists to CommandListExecutor
-    ///
-    /// Init() must be called first
-    ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
-    /// @return The number of pushed command lists
-    ///
-    std::uint32_t RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept final override;
-
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
     /// @return True if valid. Otherwise, false
@@ -58,27 +48,26 @@ public:
 
 private:
     ///
-    /// @brief Initializes the constant buffers and views
+    /// @brief Records a range of draw calls
+    /// @param commandListPerFrame Command list to reset and record
+    /// @param beginDrawIndex First draw call to record
+    /// @param endDrawIndex One past the last draw call to record
+    /// @return The recorded and closed command list
+    ///
+    ID3D12GraphicsCommandList& RecordCommandList(CommandListPerFrame& commandListPerFrame,
+                                                 const std::uint32_t beginDrawIndex,
+                                                 const std::uint32_t endDrawIndex) noexcept final override;
+
+    ///
+    /// @brief Initializes the object and material buffers
     /// @param baseColorTextures List of base color textures. Must not be empty.
     /// @param metalnessTextures List of metalness textures. Must not be empty.
     /// @param roughnessTextures List of rougness textures. Must not be empty.
     /// @param normalTextures List of normal textures. Must not be empty.
     ///
-    void InitCBuffersAndViews(const std::vector<ID3D12Resource*>& baseColorTextures,
-                              const std::vector<ID3D12Resource*>& metalnessTextures,
-                              const std::vector<ID3D12Resource*>& roughnessTextures,
-                              const std::vector<ID3D12Resource*>& normalTextures) noexcept;
-
-    // First descriptor in the list. All the others are contiguous
-    D3D12_GPU_DESCRIPTOR_HANDLE mBaseColorTextureRenderTargetViewsBegin{ 0U };
-
-    // First descriptor in the list. All the others are contiguous
-    D3D12_GPU_DESCRIPTOR_HANDLE mMetalnessTextureRenderTargetViewsBegin{ 0U };
-
-    // First descriptor in the list. All the others are contiguous
-    D3D12_GPU_DESCRIPTOR_HANDLE mRoughnessTextureRenderTargetViewsBegin{ 0U };
-
-    // First descriptor in the list. All the others are contiguous
-    D3D12_GPU_DESCRIPTOR_HANDLE mNormalTextureRenderTargetViewsBegin{ 0U };
+    void InitBuffers(const std::vector<ID3D12Resource*>& baseColorTextures,
+                     const std::vector<ID3D12Resource*>& metalnessTextures,
+                     const std::vector<ID3D12Resource*>& roughnessTextures,
+                     const std::vector<ID3D12Resource*>& normalTextures) noexcept;
 };
 }
\ No newline at end of file
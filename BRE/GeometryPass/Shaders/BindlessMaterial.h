@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+namespace BRE {
+///
+/// @brief Material of a draw call, as indices of textures in BindlessTextureTable.
+///
+/// Indices of textures that a recorder does not use are zero.
+///
+struct BindlessMaterial {
+    BindlessMaterial() = default;
+    ~BindlessMaterial() = default;
+    BindlessMaterial(const BindlessMaterial&) = default;
+    BindlessMaterial(BindlessMaterial&&) = default;
+    BindlessMaterial& operator=(BindlessMaterial&&) = default;
+
+    std::uint32_t mBaseColorTextureIndex{ 0U };
+    std::uint32_t mMetalnessTextureIndex{ 0U };
+    std::uint32_t mRoughnessTextureIndex{ 0U };
+    std::uint32_t mNormalTextureIndex{ 0U };
+    std::uint32_t mHeightTextureIndex{ 0U };
+};
+}
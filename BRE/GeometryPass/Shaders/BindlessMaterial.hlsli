@@ -0,0 +1,30 @@
+#ifndef BINDLESS_MATERIAL_HEADER
+#define BINDLESS_MATERIAL_HEADER
+
+#include <ShaderUtils/CBuffers.hlsli>
+
+// Material of a draw call, as indices of textures in the bindless texture table
+struct BindlessMaterial {
+    uint mBaseColorTextureIndex;
+    uint mMetalnessTextureIndex;
+    uint mRoughnessTextureIndex;
+    uint mNormalTextureIndex;
+    uint mHeightTextureIndex;
+};
+
+// Index of the draw call in the object and material buffers
+struct DrawConstants {
+    uint mDrawIndex;
+};
+
+// Root parameters 0 to 3 of all the geometry pass root signatures:
+// "RootConstants(num32BitConstants = 1, b0, space = 1), " \ 0 -> Draw constants
+// "SRV(t0, space = 1, visibility = SHADER_VISIBILITY_VERTEX), " \ 1 -> Object buffer
+// "SRV(t1, space = 1), " \ 2 -> Material buffer
+// "DescriptorTable(SRV(t0, space = 2, numDescriptors = unbounded)), " \ 3 -> Bindless textures
+ConstantBuffer<DrawConstants> gDrawConstants : register(b0, space1);
+StructuredBuffer<ObjectCBuffer> gObjectBuffer : register(t0, space1);
+StructuredBuffer<BindlessMaterial> gMaterialBuffer : register(t1, space1);
+Texture2D gTextures[] : register(t0, space2);
+
+#endif
@@ -1,3 +1,4 @@
+#include <GeometryPass/Shaders/BindlessMaterial.hlsli>
 #include <GeometryPass/Shaders/HeightMappingCBuffer.hlsli>
 #include <ShaderUtils/CBuffers.hlsli>
 
@@ -21,7 +22,6 @@ ConstantBuffer<FrameCBuffer> gFrameCBuffer : register(b0);
 ConstantBuffer<HeightMappingCBuffer> gHeightMappingCBuffer : register(b1);
 
 SamplerState TextureSampler : register (s0);
-Texture2D HeightTexture : register (t0);
 
 struct Output {
     float4 mPositionClipSpace : SV_Position;
@@ -60,9 +60,10 @@ Output main(const HullShaderConstantOutput HSConstantOutput,
     float3 positionViewSpace = mul(float4(positionWorldSpace, 1.0f),
                                    gFrameCBuffer.mViewMatrix).xyz;
 
-    const float height = HeightTexture.SampleLevel(TextureSampler,
-                                                   output.mUV,
-                                                   0).x;
+    const BindlessMaterial material = gMaterialBuffer[gDrawConstants.mDrawIndex];
+    const float height = gTextures[material.mHeightTextureIndex].SampleLevel(TextureSampler,
+                                                                             output.mUV,
+                                                                             0).x;
     const float displacement = (gHeightMappingCBuffer.mHeightScale * (height - 1));
 
     // Offset vertex along normal
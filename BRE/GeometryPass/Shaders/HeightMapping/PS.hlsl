@@ -1,3 +1,4 @@
+#include <GeometryPass/Shaders/BindlessMaterial.hlsli>
 #include <ShaderUtils/CBuffers.hlsli>
 #include <ShaderUtils/Utils.hlsli>
 
@@ -19,10 +20,6 @@ struct Input {
 ConstantBuffer<FrameCBuffer> gFrameCBuffer : register(b0);
 
 SamplerState TextureSampler : register (s0);
-Texture2D BaseColorTexture : register (t0);
-Texture2D MetalnessTexture : register (t1);
-Texture2D RoughnessTexture : register (t2);
-Texture2D NormalTexture : register (t3);
 
 struct Output {
     float4 mNormal_Roughness : SV_Target0;
@@ -34,9 +31,11 @@ Output main(const in Input input)
 {
     Output output = (Output)0;
 
+    const BindlessMaterial material = gMaterialBuffer[gDrawConstants.mDrawIndex];
+
     // Normal (encoded in view space) 
-    const float3 normalObjectSpace = normalize(NormalTexture.Sample(TextureSampler,
-                                                                    input.mUV).xyz * 2.0f - 1.0f);
+    const float3 normalObjectSpace = normalize(gTextures[material.mNormalTextureIndex].Sample(TextureSampler,
+                                                                                              input.mUV).xyz * 2.0f - 1.0f);
     const float3x3 tbnWorldSpace = float3x3(normalize(input.mTangentWorldSpace),
                                             normalize(input.mBinormalWorldSpace),
                                             normalize(input.mNormalWorldSpace));
@@ -47,16 +46,16 @@ Output main(const in Input input)
     output.mNormal_Roughness.xy = Encode(normalize(mul(normalObjectSpace, tbnViewSpace)));
 
     // Base color and metalness 
-    const float3 baseColor = BaseColorTexture.Sample(TextureSampler,
-                                                     input.mUV).rgb;
-    const float metalness = MetalnessTexture.Sample(TextureSampler,
-                                                    input.mUV).r;
+    const float3 baseColor = gTextures[material.mBaseColorTextureIndex].Sample(TextureSampler,
+                                                                               input.mUV).rgb;
+    const float metalness = gTextures[material.mMetalnessTextureIndex].Sample(TextureSampler,
+                                                                              input.mUV).r;
     output.mBaseColor_Metalness = float4(baseColor,
                                          metalness);
 
     // Roughness
-    output.mNormal_Roughness.z = RoughnessTexture.Sample(TextureSampler,
-                                                         input.mUV).r;
+    output.mNormal_Roughness.z = gTextures[material.mRoughnessTextureIndex].Sample(TextureSampler,
+                                                                                   input.mUV).r;
 
     return output;
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <GeometryPass/Shaders/BindlessMaterial.hlsli>
 #include <GeometryPass/Shaders/HeightMappingCBuffer.hlsli>
 #include <ShaderUtils/CBuffers.hlsli>
 
@@ -10,7 +11,6 @@ struct Input {
     float2 mUV : TEXCOORD;
 };
 
-ConstantBuffer<ObjectCBuffer> gObjCBuffer : register(b0);
 ConstantBuffer<FrameCBuffer> gFrameCBuffer : register(b1);
 ConstantBuffer<HeightMappingCBuffer> gHeightMappingCBuffer : register(b2);
 
@@ -26,17 +26,18 @@ struct Output {
 Output main(in const Input input)
 {
     Output output;
+    const ObjectCBuffer objCBuffer = gObjectBuffer[gDrawConstants.mDrawIndex];
 
     output.mPositionWorldSpace = mul(float4(input.mPositionObjectSpace, 1.0f),
-                                     gObjCBuffer.mWorldMatrix).xyz;
+                                     objCBuffer.mWorldMatrix).xyz;
 
     output.mNormalWorldSpace = mul(float4(input.mNormalObjectSpace, 0.0f),
-                                   gObjCBuffer.mInverseTransposeWorldMatrix).xyz;
+                                   objCBuffer.mInverseTransposeWorldMatrix).xyz;
 
     output.mTangentWorldSpace = mul(float4(input.mTangentObjectSpace, 0.0f),
-                                    gObjCBuffer.mWorldMatrix).xyz;
+                                    objCBuffer.mWorldMatrix).xyz;
 
-    output.mUV = gObjCBuffer.mTextureScale * input.mUV;
+    output.mUV = objCBuffer.mTextureScale * input.mUV;
 
     // Normalized tessellation factor. 
     // The tessellation is 
@@ -3,11 +3,10 @@
 "DENY_HULL_SHADER_ROOT_ACCESS | " \
 "DENY_DOMAIN_SHADER_ROOT_ACCESS | " \
 "DENY_GEOMETRY_SHADER_ROOT_ACCESS), " \
-"DescriptorTable(CBV(b0), visibility = SHADER_VISIBILITY_VERTEX), " \
+"RootConstants(num32BitConstants = 1, b0, space = 1), " \
+"SRV(t0, space = 1, visibility = SHADER_VISIBILITY_VERTEX), " \
+"SRV(t1, space = 1), " \
+"DescriptorTable(SRV(t0, space = 2, numDescriptors = unbounded)), " \
 "CBV(b1, visibility = SHADER_VISIBILITY_VERTEX), " \
 "CBV(b0, visibility = SHADER_VISIBILITY_PIXEL), " \
-"DescriptorTable(SRV(t0), visibility = SHADER_VISIBILITY_PIXEL), " \
-"DescriptorTable(SRV(t1), visibility = SHADER_VISIBILITY_PIXEL), " \
-"DescriptorTable(SRV(t2), visibility = SHADER_VISIBILITY_PIXEL), " \
-"DescriptorTable(SRV(t3), visibility = SHADER_VISIBILITY_PIXEL), " \
 "StaticSampler(s0, filter=FILTER_ANISOTROPIC)"
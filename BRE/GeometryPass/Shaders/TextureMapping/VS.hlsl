@@ -1,3 +1,4 @@
+#include <GeometryPass/Shaders/BindlessMaterial.hlsli>
 #include <ShaderUtils/CBuffers.hlsli>
 
 #include "RS.hlsl"
@@ -9,7 +10,6 @@ struct Input {
     float2 mUV : TEXCOORD;
 };
 
-ConstantBuffer<ObjectCBuffer> gObjCBuffer : register(b0);
 ConstantBuffer<FrameCBuffer> gFrameCBuffer : register(b1);
 
 struct Output {
@@ -25,20 +25,22 @@ struct Output {
 Output main(in const Input input)
 {
     Output output;
+    const ObjectCBuffer objCBuffer = gObjectBuffer[gDrawConstants.mDrawIndex];
+
     output.mPositionWorldSpace = mul(float4(input.mPositionObjectSpace, 1.0f),
-                                     gObjCBuffer.mWorldMatrix).xyz;
+                                     objCBuffer.mWorldMatrix).xyz;
     output.mPositionViewSpace = mul(float4(output.mPositionWorldSpace, 1.0f),
                                     gFrameCBuffer.mViewMatrix).xyz;
 
     output.mNormalWorldSpace = mul(float4(input.mNormalObjectSpace, 0.0f),
-                                   gObjCBuffer.mInverseTransposeWorldMatrix).xyz;
+                                   objCBuffer.mInverseTransposeWorldMatrix).xyz;
     output.mNormalViewSpace = mul(float4(output.mNormalWorldSpace, 0.0f),
                                   gFrameCBuffer.mViewMatrix).xyz;
 
     output.mPositionClipSpace = mul(float4(output.mPositionViewSpace, 1.0f),
                                     gFrameCBuffer.mProjectionMatrix);
 
-    output.mUV = gObjCBuffer.mTextureScale * input.mUV;
+    output.mUV = objCBuffer.mTextureScale * input.mUV;
 
     return output;
 }
\ No newline at end of file
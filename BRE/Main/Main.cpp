@@ -8,8 +8,11 @@
 
 #include <CommandManager\CommandAllocatorManager.h>
 #include <CommandManager/CommandListManager.h>
+#include <CommandManager\CommandListPool.h>
 #include <CommandManager\CommandQueueManager.h>
 #include <CommandManager\FenceManager.h>
+#include <CommandManager\WaitEventPool.h>
+#include <DescriptorManager/BindlessTextureTable.h>
 #include <DescriptorManager/CbvSrvUavDescriptorManager.h>
 #include <DescriptorManager/DepthStencilDescriptorManager.h>
 #include <DescriptorManager/RenderTargetDescriptorManager.h>
@@ -17,7 +20,12 @@
 #include <Input/Keyboard.h>
 #include <Input/Mouse.h>
 #include <PSOManager\PSOManager.h>
+#include <ResourceManager\FrameUploadRing.h>
+#include <ResourceManager\MemoryBudget.h>
+#include <ResourceManager\ResourceHeapAllocator.h>
 #include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\StagingBufferManager.h>
+#include <ResourceManager\TransientResourceManager.h>
 #include <ResourceManager\UploadBufferManager.h>
 #include <RootSignatureManager\RootSignatureManager.h>
 #include <SceneExecutor/SceneExecutor.h>
@@ -36,6 +44,12 @@ namespace BRE {
 namespace {
 const std::uint32_t RENDER_TARGET_DESCRIPTOR_HEAP_SIZE = 30U;
 const std::uint32_t CBV_SRV_UAV_DESCRIPTOR_HEAP_SIZE = 3000U;
+const std::uint32_t CBV_SRV_UAV_TRANSIENT_DESCRIPTOR_COUNT_PER_FRAME = 64U;
+const std::uint32_t CBV_SRV_UAV_STAGING_DESCRIPTOR_HEAP_SIZE = 64U;
+const std::uint32_t BINDLESS_TEXTURE_TABLE_SIZE = 512U;
+const std::size_t FRAME_UPLOAD_RING_SIZE_PER_FRAME = 1024UL * 1024UL;
+const std::uint64_t RESOURCE_HEAP_SIZE = 64UL * 1024UL * 1024UL;
+const char* MEMORY_BUDGET_REPORT_FILENAME = "MemoryBudget.csv";
 
 ///
 /// @brief Initializes all the systems
@@ -66,9 +80,14 @@ void InitSystems(const HINSTANCE moduleInstanceHandle,
     Keyboard::Create(*directInput, windowHandle);
     Mouse::Create(*directInput, windowHandle);
 
-    CbvSrvUavDescriptorManager::Init(CBV_SRV_UAV_DESCRIPTOR_HEAP_SIZE);
+    CbvSrvUavDescriptorManager::Init(CBV_SRV_UAV_DESCRIPTOR_HEAP_SIZE,
+                                     CBV_SRV_UAV_TRANSIENT_DESCRIPTOR_COUNT_PER_FRAME,
+                                     CBV_SRV_UAV_STAGING_DESCRIPTOR_HEAP_SIZE);
+    BindlessTextureTable::Init(BINDLESS_TEXTURE_TABLE_SIZE);
     DepthStencilDescriptorManager::Init();
     RenderTargetDescriptorManager::Init(RENDER_TARGET_DESCRIPTOR_HEAP_SIZE);
+    ResourceHeapAllocator::Init(RESOURCE_HEAP_SIZE);
+    FrameUploadRing::Init(FRAME_UPLOAD_RING_SIZE_PER_FRAME);
 
     //ShowCursor(false);
 }
@@ -78,15 +97,24 @@ void InitSystems(const HINSTANCE moduleInstanceHandle,
 ///
 void FinalizeSystems() noexcept
 {
+    // The report is written before releasing anything, so it has the memory usage at shutdown
+    // and the peaks of the whole execution.
+    MemoryBudget::WriteCsvFile(MEMORY_BUDGET_REPORT_FILENAME);
+
     CommandAllocatorManager::Clear();
     CommandListManager::Clear();
+    CommandListPool::Clear();
     CommandQueueManager::Clear();
     FenceManager::Clear();
+    MemoryBudget::Clear();
     PSOManager::Clear();
     ResourceManager::Clear();
     RootSignatureManager::Clear();
     ShaderManager::Clear();
+    StagingBufferManager::Clear();
+    TransientResourceManager::Clear();
     UploadBufferManager::Clear();
+    WaitEventPool::Clear();
 }
 }
 }
@@ -15,21 +15,11 @@ namespace {
 /// @param meshData Mesh data to get vertices and indices
 /// @param commandList Command list used to upload buffers content to GPU.
 /// It must be executed after this function call to upload buffers content to GPU.
-/// @param uploadVertexBuffer Upload buffer to create the buffer.
-/// It has to be kept alive after the function call because
-/// the command list has not been executed yet that performs the actual copy.
-/// The caller can Release the uploadBuffer after it knows the copy has been executed.
-/// @param uploadIndexBuffer Upload buffer to create the buffer.
-/// It has to be kept alive after the function call because
-/// the command list has not been executed yet that performs the actual copy.
-/// The caller can Release the uploadBuffer after it knows the copy has been executed.
 ///
 void CreateVertexAndIndexBufferData(VertexAndIndexBufferCreator::VertexBufferData& vertexBufferData,
                                     VertexAndIndexBufferCreator::IndexBufferData& indexBufferData,
                                     const GeometryGenerator::MeshData& meshData,
-                                    ID3D12GraphicsCommandList& commandList,
-                                    ID3D12Resource* &uploadVertexBuffer,
-                                    ID3D12Resource* &uploadIndexBuffer) noexcept
+                                    ID3D12GraphicsCommandList& commandList) noexcept
 {
     BRE_ASSERT(vertexBufferData.IsDataValid() == false);
     BRE_ASSERT(indexBufferData.IsDataValid() == false);
@@ -41,8 +31,7 @@ void CreateVertexAndIndexBufferData(VertexAndIndexBufferCreator::VertexBufferDat
 
     VertexAndIndexBufferCreator::CreateVertexBuffer(vertexBufferParams,
                                                     vertexBufferData,
-                                                    commandList,
-                                                    uploadVertexBuffer);
+                                                    commandList);
 
     // Create index buffer
     VertexAndIndexBufferCreator::BufferCreationData indexBufferParams(meshData.mIndices32.data(),
@@ -51,8 +40,7 @@ void CreateVertexAndIndexBufferData(VertexAndIndexBufferCreator::VertexBufferDat
 
     VertexAndIndexBufferCreator::CreateIndexBuffer(indexBufferParams,
                                                    indexBufferData,
-                                                   commandList,
-                                                   uploadIndexBuffer);
+                                                   commandList);
 
     BRE_ASSERT(vertexBufferData.IsDataValid());
     BRE_ASSERT(indexBufferData.IsDataValid());
@@ -60,9 +48,7 @@ void CreateVertexAndIndexBufferData(VertexAndIndexBufferCreator::VertexBufferDat
 }
 
 Mesh::Mesh(const aiMesh& mesh,
-           ID3D12GraphicsCommandList& commandList,
-           ID3D12Resource* &uploadVertexBuffer,
-           ID3D12Resource* &uploadIndexBuffer)
+           ID3D12GraphicsCommandList& commandList)
 {
     GeometryGenerator::MeshData meshData;
 
@@ -110,25 +96,19 @@ Mesh::Mesh(const aiMesh& mesh,
     CreateVertexAndIndexBufferData(mVertexBufferData,
                                    mIndexBufferData,
                                    meshData,
-                                   commandList,
-                                   uploadVertexBuffer,
-                                   uploadIndexBuffer);
+                                   commandList);
 
     BRE_ASSERT(mVertexBufferData.IsDataValid());
     BRE_ASSERT(mIndexBufferData.IsDataValid());
 }
 
 Mesh::Mesh(const GeometryGenerator::MeshData& meshData,
-           ID3D12GraphicsCommandList& commandList,
-           ID3D12Resource* &uploadVertexBuffer,
-           ID3D12Resource* &uploadIndexBuffer)
+           ID3D12GraphicsCommandList& commandList)
 {
     CreateVertexAndIndexBufferData(mVertexBufferData,
                                    mIndexBufferData,
                                    meshData,
-                                   commandList,
-                                   uploadVertexBuffer,
-                                   uploadIndexBuffer);
+                                   commandList);
 
     BRE_ASSERT(mVertexBufferData.IsDataValid());
     BRE_ASSERT(mIndexBufferData.IsDataValid());
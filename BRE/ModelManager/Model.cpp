@@ -8,9 +8,7 @@
 
 namespace BRE {
 Model::Model(const char* modelFilename,
-             ID3D12GraphicsCommandList& commandList,
-             ID3D12Resource* &uploadVertexBuffer,
-             ID3D12Resource* &uploadIndexBuffer)
+             ID3D12GraphicsCommandList& commandList)
 {
     BRE_ASSERT(modelFilename != nullptr);
     const std::string filePath(modelFilename);
@@ -26,20 +24,14 @@ Model::Model(const char* modelFilename,
         aiMesh* mesh{ scene->mMeshes[i] };
         BRE_ASSERT(mesh != nullptr);
         mMeshes.push_back(Mesh(*mesh,
-                               commandList,
-                               uploadVertexBuffer,
-                               uploadIndexBuffer));
+                               commandList));
     }
 }
 
 Model::Model(const GeometryGenerator::MeshData& meshData,
-             ID3D12GraphicsCommandList& commandList,
-             ID3D12Resource* &uploadVertexBuffer,
-             ID3D12Resource* &uploadIndexBuffer)
+             ID3D12GraphicsCommandList& commandList)
 {
     mMeshes.push_back(Mesh(meshData,
-                           commandList,
-                           uploadVertexBuffer,
-                           uploadIndexBuffer));
+                           commandList));
 }
 }
\ No newline at end of file
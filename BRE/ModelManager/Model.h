@@ -23,19 +23,9 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
     ///
     explicit Model(const char* modelFilename,
-                   ID3D12GraphicsCommandList& commandList,
-                   ID3D12Resource* &ploadVertexBuffer,
-                   ID3D12Resource* &uploadIndexBuffer);
+                   ID3D12GraphicsCommandList& commandList);
 
     ///
     /// @brief Model constructor
@@ -43,19 +33,9 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
     ///
     explicit Model(const GeometryGenerator::MeshData& meshData,
-                   ID3D12GraphicsCommandList& commandList,
-                   ID3D12Resource* &uploadVertexBuffer,
-                   ID3D12Resource* &uploadIndexBuffer);
+                   ID3D12GraphicsCommandList& commandList);
 
     ///
     /// @brief Checks if there are meshes or not
@@ -1,28 +1,26 @@
 #include "ModelManager.h"
 
+#include <CommandManager\FenceTimeline.h>
 #include <GeometryGenerator\GeometryGenerator.h>
+#include <ResourceManager\ResourceManager.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
-tbb::concurrent_unordered_set<Model*> ModelManager::mModels;
+SlotMap<Model> ModelManager::mModels;
 std::mutex ModelManager::mMutex;
 
 void
 ModelManager::Clear() noexcept
 {
-    for (Model* model : mModels) {
-        BRE_ASSERT(model != nullptr);
-        delete model;
-    }
-
-    mModels.clear();
+    mModels.Clear([](Model& model) {
+        delete &model;
+    });
 }
 
 Model&
 ModelManager::LoadModel(const char* modelFilename,
                         ID3D12GraphicsCommandList& commandList,
-                        ID3D12Resource* &uploadVertexBuffer,
-                        ID3D12Resource* &uploadIndexBuffer) noexcept
+                        SlotMapHandle* modelHandle) noexcept
 {
     BRE_ASSERT(modelFilename != nullptr);
 
@@ -30,13 +28,14 @@ ModelManager::LoadModel(const char* modelFilename,
 
     mMutex.lock();
     model = new Model(modelFilename,
-                      commandList,
-                      uploadVertexBuffer,
-                      uploadIndexBuffer);
+                      commandList);
     mMutex.unlock();
 
     BRE_ASSERT(model != nullptr);
-    mModels.insert(model);
+    const SlotMapHandle handle = mModels.Insert(*model);
+    if (modelHandle != nullptr) {
+        *modelHandle = handle;
+    }
 
     return *model;
 }
@@ -47,8 +46,7 @@ ModelManager::CreateBox(const float width,
                         const float depth,
                         const std::uint32_t numSubdivisions,
                         ID3D12GraphicsCommandList& commandList,
-                        ID3D12Resource* &uploadVertexBuffer,
-                        ID3D12Resource* &uploadIndexBuffer) noexcept
+                        SlotMapHandle* modelHandle) noexcept
 {
     Model* model{ nullptr };
 
@@ -60,13 +58,14 @@ ModelManager::CreateBox(const float width,
 
     mMutex.lock();
     model = new Model(meshData,
-                      commandList,
-                      uploadVertexBuffer,
-                      uploadIndexBuffer);
+                      commandList);
     mMutex.unlock();
 
     BRE_ASSERT(model != nullptr);
-    mModels.insert(model);
+    const SlotMapHandle handle = mModels.Insert(*model);
+    if (modelHandle != nullptr) {
+        *modelHandle = handle;
+    }
 
     return *model;
 }
@@ -76,8 +75,7 @@ ModelManager::CreateSphere(const float radius,
                            const std::uint32_t sliceCount,
                            const std::uint32_t stackCount,
                            ID3D12GraphicsCommandList& commandList,
-                           ID3D12Resource* &uploadVertexBuffer,
-                           ID3D12Resource* &uploadIndexBuffer) noexcept
+                           SlotMapHandle* modelHandle) noexcept
 {
     Model* model{ nullptr };
 
@@ -89,13 +87,14 @@ ModelManager::CreateSphere(const float radius,
 
     mMutex.lock();
     model = new Model(meshData,
-                      commandList,
-                      uploadVertexBuffer,
-                      uploadIndexBuffer);
+                      commandList);
     mMutex.unlock();
 
     BRE_ASSERT(model != nullptr);
-    mModels.insert(model);
+    const SlotMapHandle handle = mModels.Insert(*model);
+    if (modelHandle != nullptr) {
+        *modelHandle = handle;
+    }
 
     return *model;
 }
@@ -104,8 +103,7 @@ Model&
 ModelManager::CreateGeosphere(const float radius,
                               const std::uint32_t numSubdivisions,
                               ID3D12GraphicsCommandList& commandList,
-                              ID3D12Resource* &uploadVertexBuffer,
-                              ID3D12Resource* &uploadIndexBuffer) noexcept
+                              SlotMapHandle* modelHandle) noexcept
 {
     Model* model{ nullptr };
 
@@ -116,13 +114,14 @@ ModelManager::CreateGeosphere(const float radius,
 
     mMutex.lock();
     model = new Model(meshData,
-                      commandList,
-                      uploadVertexBuffer,
-                      uploadIndexBuffer);
+                      commandList);
     mMutex.unlock();
 
     BRE_ASSERT(model != nullptr);
-    mModels.insert(model);
+    const SlotMapHandle handle = mModels.Insert(*model);
+    if (modelHandle != nullptr) {
+        *modelHandle = handle;
+    }
 
     return *model;
 }
@@ -134,8 +133,7 @@ ModelManager::CreateCylinder(const float bottomRadius,
                              const std::uint32_t sliceCount,
                              const std::uint32_t stackCount,
                              ID3D12GraphicsCommandList& commandList,
-                             ID3D12Resource* &uploadVertexBuffer,
-                             ID3D12Resource* &uploadIndexBuffer) noexcept
+                             SlotMapHandle* modelHandle) noexcept
 {
     Model* model{ nullptr };
 
@@ -149,13 +147,14 @@ ModelManager::CreateCylinder(const float bottomRadius,
 
     mMutex.lock();
     model = new Model(meshData,
-                      commandList,
-                      uploadVertexBuffer,
-                      uploadIndexBuffer);
+                      commandList);
     mMutex.unlock();
 
     BRE_ASSERT(model != nullptr);
-    mModels.insert(model);
+    const SlotMapHandle handle = mModels.Insert(*model);
+    if (modelHandle != nullptr) {
+        *modelHandle = handle;
+    }
 
     return *model;
 }
@@ -166,8 +165,7 @@ ModelManager::CreateGrid(const float width,
                          const std::uint32_t rows,
                          const std::uint32_t columns,
                          ID3D12GraphicsCommandList& commandList,
-                         ID3D12Resource* &uploadVertexBuffer,
-                         ID3D12Resource* &uploadIndexBuffer) noexcept
+                         SlotMapHandle* modelHandle) noexcept
 {
     Model* model{ nullptr };
 
@@ -180,14 +178,46 @@ ModelManager::CreateGrid(const float width,
 
     mMutex.lock();
     model = new Model(meshData,
-                      commandList,
-                      uploadVertexBuffer,
-                      uploadIndexBuffer);
+                      commandList);
     mMutex.unlock();
 
     BRE_ASSERT(model != nullptr);
-    mModels.insert(model);
+    const SlotMapHandle handle = mModels.Insert(*model);
+    if (modelHandle != nullptr) {
+        *modelHandle = handle;
+    }
 
     return *model;
 }
+
+Model*
+ModelManager::GetModel(const SlotMapHandle modelHandle) noexcept
+{
+    return mModels.Get(modelHandle);
+}
+
+void
+ModelManager::RemoveModel(const SlotMapHandle modelHandle) noexcept
+{
+    Model* model = mModels.Remove(modelHandle);
+    BRE_CHECK_MSG(model != nullptr, L"Model handle is not valid");
+
+    // Buffers are removed now, so they are released in the same frame as the model.
+    for (const Mesh& mesh : model->GetMeshes()) {
+        ResourceManager::RemoveResource(mesh.GetVertexBufferData().mBufferHandle);
+        ResourceManager::RemoveResource(mesh.GetIndexBufferData().mBufferHandle);
+    }
+}
+
+void
+ModelManager::ReleaseRemovedModels(FenceTimeline& fenceTimeline,
+                                   const std::uint64_t fenceValue) noexcept
+{
+    const auto isComplete = [&fenceTimeline](const std::uint64_t value) {
+        return fenceTimeline.IsComplete(value);
+    };
+    mModels.ReleaseRemovedItems(fenceValue, isComplete, [](Model& model) {
+        delete &model;
+    });
+}
 }
\ No newline at end of file
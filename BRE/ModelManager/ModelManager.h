@@ -2,11 +2,13 @@
 
 #include <d3d12.h>
 #include <mutex>
-#include <tbb\concurrent_unordered_set.h>
 
 #include <ModelManager/Model.h>
+#include <Utils\SlotMap.h>
 
 namespace BRE {
+class FenceTimeline;
+
 ///
 /// @brief Responsible to create models or built-in geometry (box, sphere, etc)
 ///
@@ -30,20 +32,13 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
+    /// @param modelHandle If it is not nullptr, then it is filled with the handle of the model,
+    /// that can be used to remove it with RemoveModel().
     /// @return Model
     ///
     static Model& LoadModel(const char* modelFilename,
                             ID3D12GraphicsCommandList& commandList,
-                            ID3D12Resource* &uploadVertexBuffer,
-                            ID3D12Resource* &uploadIndexBuffer) noexcept;
+                            SlotMapHandle* modelHandle = nullptr) noexcept;
 
     ///
     /// @brief Create a box centered at the origin
@@ -54,14 +49,8 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
+    /// @param modelHandle If it is not nullptr, then it is filled with the handle of the model,
+    /// that can be used to remove it with RemoveModel().
     /// @return Model
     ///
     static Model& CreateBox(const float width,
@@ -69,8 +58,7 @@ public:
                             const float depth,
                             const std::uint32_t numSubdivisions,
                             ID3D12GraphicsCommandList& commandList,
-                            ID3D12Resource* &uploadVertexBuffer,
-                            ID3D12Resource* &uploadIndexBuffer) noexcept;
+                            SlotMapHandle* modelHandle = nullptr) noexcept;
 
     ///
     /// @brief Create a sphere centered at the origin
@@ -80,22 +68,15 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
+    /// @param modelHandle If it is not nullptr, then it is filled with the handle of the model,
+    /// that can be used to remove it with RemoveModel().
     /// @return Model
     ///
     static Model& CreateSphere(const float radius,
                                const std::uint32_t sliceCount,
                                const std::uint32_t stackCount,
                                ID3D12GraphicsCommandList& commandList,
-                               ID3D12Resource* &uploadVertexBuffer,
-                               ID3D12Resource* &uploadIndexBuffer) noexcept;
+                               SlotMapHandle* modelHandle = nullptr) noexcept;
 
     ///
     /// @brief Create a geosphere centered at the origin
@@ -104,21 +85,14 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
+    /// @param modelHandle If it is not nullptr, then it is filled with the handle of the model,
+    /// that can be used to remove it with RemoveModel().
     /// @return Model
     ///
     static Model& CreateGeosphere(const float radius,
                                   const std::uint32_t numSubdivisions,
                                   ID3D12GraphicsCommandList& commandList,
-                                  ID3D12Resource* &uploadVertexBuffer,
-                                  ID3D12Resource* &uploadIndexBuffer) noexcept;
+                                  SlotMapHandle* modelHandle = nullptr) noexcept;
 
     ///
     /// @brief Create a cylinder centered at the origin
@@ -130,14 +104,8 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
+    /// @param modelHandle If it is not nullptr, then it is filled with the handle of the model,
+    /// that can be used to remove it with RemoveModel().
     /// @return Model
     /// 
     static Model& CreateCylinder(const float bottomRadius,
@@ -146,8 +114,7 @@ public:
                                  const std::uint32_t sliceCount,
                                  const std::uint32_t stackCount,
                                  ID3D12GraphicsCommandList& commandList,
-                                 ID3D12Resource* &uploadVertexBuffer,
-                                 ID3D12Resource* &uploadIndexBuffer) noexcept;
+                                 SlotMapHandle* modelHandle = nullptr) noexcept;
 
     ///
     /// @brief Create a rows X columns grid in the xz-plane centered at the origin
@@ -158,14 +125,8 @@ public:
     /// @param commandList Command list used to upload buffers content to GPU.
     /// It must be executed after this function call to upload buffers content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadVertexBuffer Upload buffer to upload the vertex buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffer Upload buffer to upload the index buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffer after it knows the copy has been executed.
+    /// @param modelHandle If it is not nullptr, then it is filled with the handle of the model,
+    /// that can be used to remove it with RemoveModel().
     /// @return Model
     ///
     static Model& CreateGrid(const float width,
@@ -173,11 +134,43 @@ public:
                              const std::uint32_t rows,
                              const std::uint32_t columns,
                              ID3D12GraphicsCommandList& commandList,
-                             ID3D12Resource* &uploadVertexBuffer,
-                             ID3D12Resource* &uploadIndexBuffer) noexcept;
+                             SlotMapHandle* modelHandle = nullptr) noexcept;
+
+    ///
+    /// @brief Get a model
+    ///
+    /// This method is thread safe and does not lock.
+    ///
+    /// @param modelHandle Model handle returned by a creation method
+    /// @return The model, or nullptr if it was removed.
+    ///
+    static Model* GetModel(const SlotMapHandle modelHandle) noexcept;
+
+    ///
+    /// @brief Remove a model and the vertex and index buffers of its meshes
+    ///
+    /// The model is not released immediately, because command lists in flight can still
+    /// use its buffers. It is released once the GPU finishes the frame where it was removed
+    /// (see ReleaseRemovedModels()). This method is thread safe.
+    ///
+    /// @param modelHandle Model handle returned by a creation method
+    ///
+    static void RemoveModel(const SlotMapHandle modelHandle) noexcept;
+
+    ///
+    /// @brief Release removed models at a frame boundary.
+    ///
+    /// Models removed since the last call are tagged with @p fenceValue, and
+    /// removed models whose fence value already completed are released.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void ReleaseRemovedModels(FenceTimeline& fenceTimeline,
+                                     const std::uint64_t fenceValue) noexcept;
 
 private:
-    static tbb::concurrent_unordered_set<Model*> mModels;
+    static SlotMap<Model> mModels;
 
     static std::mutex mMutex;
 };
@@ -2,21 +2,19 @@
 
 #include <DirectXManager/DirectXManager.h>
 #include <ApplicationSettings\ApplicationSettings.h>
+#include <CommandManager\FenceTimeline.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
-tbb::concurrent_unordered_set<ID3D12PipelineState*> PSOManager::mPSOs;
+SlotMap<ID3D12PipelineState> PSOManager::mPSOs;
 std::mutex PSOManager::mMutex;
 
 void
 PSOManager::Clear() noexcept
 {
-    for (ID3D12PipelineState* pso : mPSOs) {
-        BRE_ASSERT(pso != nullptr);
-        pso->Release();
-    }
-
-    mPSOs.clear();
+    mPSOs.Clear([](ID3D12PipelineState& pso) {
+        pso.Release();
+    });
 }
 
 bool
@@ -38,7 +36,8 @@ PSOManager::PSOCreationData::IsDataValid() const noexcept
 }
 
 ID3D12PipelineState&
-PSOManager::CreateGraphicsPSO(const PSOManager::PSOCreationData& psoData) noexcept
+PSOManager::CreateGraphicsPSO(const PSOManager::PSOCreationData& psoData,
+                              SlotMapHandle* psoHandle) noexcept
 {
     BRE_ASSERT(psoData.IsDataValid());
 
@@ -65,11 +64,12 @@ PSOManager::CreateGraphicsPSO(const PSOManager::PSOCreationData& psoData) noexce
     psoDescriptor.SampleMask = psoData.mSampleMask;
     psoDescriptor.VS = psoData.mVertexShaderBytecode;
 
-    return CreateGraphicsPSOByDescriptor(psoDescriptor);
+    return CreateGraphicsPSOByDescriptor(psoDescriptor, psoHandle);
 }
 
 ID3D12PipelineState&
-PSOManager::CreateGraphicsPSOByDescriptor(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDescriptor) noexcept
+PSOManager::CreateGraphicsPSOByDescriptor(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDescriptor,
+                                          SlotMapHandle* psoHandle) noexcept
 {
     ID3D12PipelineState* pso{ nullptr };
 
@@ -78,8 +78,35 @@ PSOManager::CreateGraphicsPSOByDescriptor(const D3D12_GRAPHICS_PIPELINE_STATE_DE
     mMutex.unlock();
 
     BRE_ASSERT(pso != nullptr);
-    mPSOs.insert(pso);
+    const SlotMapHandle handle = mPSOs.Insert(*pso);
+    if (psoHandle != nullptr) {
+        *psoHandle = handle;
+    }
 
     return *pso;
 }
+
+ID3D12PipelineState*
+PSOManager::GetPSO(const SlotMapHandle psoHandle) noexcept
+{
+    return mPSOs.Get(psoHandle);
+}
+
+void
+PSOManager::RemovePSO(const SlotMapHandle psoHandle) noexcept
+{
+    BRE_CHECK_MSG(mPSOs.Remove(psoHandle) != nullptr, L"Pipeline state object handle is not valid");
+}
+
+void
+PSOManager::ReleaseRemovedPSOs(FenceTimeline& fenceTimeline,
+                               const std::uint64_t fenceValue) noexcept
+{
+    const auto isComplete = [&fenceTimeline](const std::uint64_t value) {
+        return fenceTimeline.IsComplete(value);
+    };
+    mPSOs.ReleaseRemovedItems(fenceValue, isComplete, [](ID3D12PipelineState& pso) {
+        pso.Release();
+    });
+}
 }
\ No newline at end of file
@@ -2,11 +2,13 @@
 
 #include <d3d12.h>
 #include <mutex>
-#include <tbb/concurrent_unordered_set.h>
 
 #include <DXUtils/D3DFactory.h>
+#include <Utils\SlotMap.h>
 
 namespace BRE {
+class FenceTimeline;
+
 ///
 /// @brief Responsible to create pipeline state objects
 ///
@@ -62,19 +64,57 @@ public:
     ///
     /// @brief Create graphics pipeline state object
     /// @param psoCreationData Pipeline state object creation data. It must be valid
+    /// @param psoHandle If it is not nullptr, then it is filled with the handle of the pipeline state object,
+    /// that can be used to remove it with RemovePSO().
     /// @return Pipeline state object
     ///
-    static ID3D12PipelineState& CreateGraphicsPSO(const PSOManager::PSOCreationData& psoCreationData) noexcept;
+    static ID3D12PipelineState& CreateGraphicsPSO(const PSOManager::PSOCreationData& psoCreationData,
+                                                  SlotMapHandle* psoHandle = nullptr) noexcept;
+
+    ///
+    /// @brief Get a pipeline state object
+    ///
+    /// This method is thread safe and does not lock.
+    ///
+    /// @param psoHandle Pipeline state object handle returned by CreateGraphicsPSO()
+    /// @return The pipeline state object, or nullptr if it was removed.
+    ///
+    static ID3D12PipelineState* GetPSO(const SlotMapHandle psoHandle) noexcept;
+
+    ///
+    /// @brief Remove a pipeline state object
+    ///
+    /// The pipeline state object is not released immediately, because command lists in flight
+    /// can still use it. It is released once the GPU finishes the frame where it was removed
+    /// (see ReleaseRemovedPSOs()). This method is thread safe.
+    ///
+    /// @param psoHandle Pipeline state object handle returned by CreateGraphicsPSO()
+    ///
+    static void RemovePSO(const SlotMapHandle psoHandle) noexcept;
+
+    ///
+    /// @brief Release removed pipeline state objects at a frame boundary.
+    ///
+    /// Pipeline state objects removed since the last call are tagged with @p fenceValue, and
+    /// removed pipeline state objects whose fence value already completed are released.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void ReleaseRemovedPSOs(FenceTimeline& fenceTimeline,
+                                   const std::uint64_t fenceValue) noexcept;
 
 private:
     ///
     /// @brief Create graphics pipeline state object by descriptor
     /// @param psoDescriptor Graphics pipeline state object descriptor
+    /// @param psoHandle If it is not nullptr, then it is filled with the handle of the pipeline state object.
     /// @return Pipeline state object
     ///
-    static ID3D12PipelineState& CreateGraphicsPSOByDescriptor(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDescriptor) noexcept;
+    static ID3D12PipelineState& CreateGraphicsPSOByDescriptor(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDescriptor,
+                                                              SlotMapHandle* psoHandle) noexcept;
 
-    static tbb::concurrent_unordered_set<ID3D12PipelineState*> mPSOs;
+    static SlotMap<ID3D12PipelineState> mPSOs;
 
     static std::mutex mMutex;
 };
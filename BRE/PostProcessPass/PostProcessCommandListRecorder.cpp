@@ -48,17 +48,18 @@ PostProcessCommandListRecorder::InitSharedPSOAndRootSignature() noexcept
 }
 
 void
-PostProcessCommandListRecorder::Init(const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView) noexcept
+PostProcessCommandListRecorder::Init(const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView) noexcept
 {
     BRE_ASSERT(IsDataValid() == false);
 
-    mInputColorBufferShaderResourceView = inputColorBufferShaderResourceView;
+    mInputColorBufferStagingShaderResourceView = inputColorBufferStagingShaderResourceView;
 
     BRE_ASSERT(IsDataValid());
 }
 
 std::uint32_t
-PostProcessCommandListRecorder::RecordAndPushCommandLists(const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView) noexcept
+PostProcessCommandListRecorder::RecordAndPushCommandLists(const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView,
+                                                          const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
@@ -73,14 +74,18 @@ PostProcessCommandListRecorder::RecordAndPushCommandLists(const D3D12_CPU_DESCRI
     ID3D12DescriptorHeap* heaps[] = { &CbvSrvUavDescriptorManager::GetDescriptorHeap() };
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
 
+    // The input table is built in the transient descriptor ring of the current frame
+    const D3D12_GPU_DESCRIPTOR_HANDLE inputColorBufferDescriptorTable =
+        CbvSrvUavDescriptorManager::CreateTransientDescriptorTable(&mInputColorBufferStagingShaderResourceView, 1U);
+
     commandList.SetGraphicsRootSignature(sRootSignature);
-    commandList.SetGraphicsRootDescriptorTable(0U, mInputColorBufferShaderResourceView);
+    commandList.SetGraphicsRootDescriptorTable(0U, inputColorBufferDescriptorTable);
 
     commandList.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
@@ -88,7 +93,7 @@ PostProcessCommandListRecorder::RecordAndPushCommandLists(const D3D12_CPU_DESCRI
 bool
 PostProcessCommandListRecorder::IsDataValid() const noexcept
 {
-    const bool result = mInputColorBufferShaderResourceView.ptr != 0UL;
+    const bool result = mInputColorBufferStagingShaderResourceView.ptr != 0UL;
 
     return result;
 }
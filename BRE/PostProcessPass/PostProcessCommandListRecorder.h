@@ -3,7 +3,6 @@
 #include <CommandManager\CommandListPerFrame.h>
 
 struct D3D12_CPU_DESCRIPTOR_HANDLE;
-struct D3D12_GPU_DESCRIPTOR_HANDLE;
 struct ID3D12Resource;
 
 namespace BRE {
@@ -31,9 +30,10 @@ public:
     ///
     /// InitSharedPSOAndRootSignature() must be called before
     ///
-    /// @param inputColorBufferShaderResourceView Shader resource view to the input color buffer
+    /// @param inputColorBufferStagingShaderResourceView Staging shader resource view to the input color buffer.
+    /// It is copied into a transient descriptor table each frame.
     ///
-    void Init(const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView) noexcept;
+    void Init(const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView) noexcept;
 
     ///
     /// @brief Records and pushes command lists to CommandListExecutor
@@ -41,9 +41,11 @@ public:
     /// Init() must be called first
     ///
     /// @param outputColorBufferRenderTargetView Render target view to the output color buffer
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists(const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView) noexcept;
+    std::uint32_t RecordAndPushCommandLists(const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView,
+                                            const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used with assertions
@@ -54,6 +56,6 @@ public:
 private:
     CommandListPerFrame mCommandListPerFrame;
 
-    D3D12_GPU_DESCRIPTOR_HANDLE mInputColorBufferShaderResourceView{ 0UL };
+    D3D12_CPU_DESCRIPTOR_HANDLE mInputColorBufferStagingShaderResourceView{ 0UL };
 };
 }
\ No newline at end of file
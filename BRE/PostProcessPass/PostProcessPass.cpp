@@ -13,7 +13,7 @@ using namespace DirectX;
 namespace BRE {
 void
 PostProcessPass::Init(ID3D12Resource& inputColorBuffer,
-                      const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView) noexcept
+                      const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView) noexcept
 {
     BRE_ASSERT(IsDataValid() == false);
 
@@ -21,14 +21,15 @@ PostProcessPass::Init(ID3D12Resource& inputColorBuffer,
 
     PostProcessCommandListRecorder::InitSharedPSOAndRootSignature();
 
-    mCommandListRecorder.Init(inputColorBufferShaderResourceView);
+    mCommandListRecorder.Init(inputColorBufferStagingShaderResourceView);
 
     BRE_ASSERT(IsDataValid());
 }
 
 std::uint32_t
 PostProcessPass::Execute(ID3D12Resource& frameBuffer,
-                         const D3D12_CPU_DESCRIPTOR_HANDLE& frameBufferRenderTargetView) noexcept
+                         const D3D12_CPU_DESCRIPTOR_HANDLE& frameBufferRenderTargetView,
+                         tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(frameBufferRenderTargetView.ptr != 0UL);
@@ -36,8 +37,13 @@ PostProcessPass::Execute(ID3D12Resource& frameBuffer,
     std::uint32_t commandListCount = 0U;
 
     commandListCount += RecordAndPushPrePassCommandLists(frameBuffer);
-        
-    commandListCount += mCommandListRecorder.RecordAndPushCommandLists(frameBufferRenderTargetView);
+
+    const std::uint32_t commandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(1U);
+    const D3D12_CPU_DESCRIPTOR_HANDLE renderTargetView(frameBufferRenderTargetView);
+    recordingTaskGroup.run([this, renderTargetView, commandListSlot]() {
+        mCommandListRecorder.RecordAndPushCommandLists(renderTargetView, commandListSlot);
+    });
+    ++commandListCount;
 
     return commandListCount;
 }
@@ -58,15 +64,15 @@ PostProcessPass::RecordAndPushPrePassCommandLists(ID3D12Resource& frameBuffer) n
 
     D3D12_RESOURCE_BARRIER barriers[2U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*mInputColorBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mInputColorBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mInputColorBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(frameBuffer) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(frameBuffer,
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
+    if (ResourceStateManager::TransitionResourceIfNeeded(frameBuffer,
+                                                         D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
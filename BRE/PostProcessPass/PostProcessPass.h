@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tbb/task_group.h>
+
 #include <CommandManager\CommandListPerFrame.h>
 #include <PostProcessPass\PostProcessCommandListRecorder.h>
 
@@ -19,23 +21,28 @@ public:
     ///
     /// @brief Initializes post process pass
     /// @param inputColorBuffer Input color buffer to apply post processing 
-    /// @param inputColorBufferShaderResourceView Shader resource view to the input color buffer
+    /// @param inputColorBufferStagingShaderResourceView Staging shader resource view to the input color buffer
     ///
     void Init(ID3D12Resource& inputColorBuffer,
-              const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView) noexcept;
+              const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView) noexcept;
 
     ///
     /// @brief Executes the pass
     ///
     /// Init() must be called first. This method can record and
-    /// push command lists to the CommandListExecutor.
+    /// push command lists to the CommandListExecutor. Barrier command lists are
+    /// recorded by the calling thread, in pass order, and the other command lists
+    /// are recorded by tasks run in @p recordingTaskGroup.
     ///
     /// @param frameBuffer Frame buffer
     /// @param renderTargetView Render target view to the frame buffer
+    /// @param recordingTaskGroup Task group where recording tasks are run. The caller must wait for it
+    /// before waiting for the execution of the recorded command lists.
     /// @return The number of recorded command lists.
     ///
     std::uint32_t Execute(ID3D12Resource& frameBuffer,
-                          const D3D12_CPU_DESCRIPTOR_HANDLE& frameBufferRenderTargetView) noexcept;
+                          const D3D12_CPU_DESCRIPTOR_HANDLE& frameBufferRenderTargetView,
+                          tbb::task_group& recordingTaskGroup) noexcept;
 
 private:
     ///
@@ -41,9 +41,10 @@ public:
     ///
     /// Init() must be called first.
     ///
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists() noexcept;
+    std::uint32_t RecordAndPushCommandLists(const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
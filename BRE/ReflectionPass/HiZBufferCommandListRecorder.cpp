@@ -63,7 +63,7 @@ HiZBufferCommandListRecorder::Init(const D3D12_GPU_DESCRIPTOR_HANDLE& upperLevel
 }
 
 std::uint32_t
-HiZBufferCommandListRecorder::RecordAndPushCommandLists() noexcept
+HiZBufferCommandListRecorder::RecordAndPushCommandLists(const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
@@ -85,7 +85,7 @@ HiZBufferCommandListRecorder::RecordAndPushCommandLists() noexcept
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
@@ -7,11 +7,51 @@
 #include <DescriptorManager\RenderTargetDescriptorManager.h>
 #include <DXUtils\D3DFactory.h>
 #include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\TransientResourceManager.h>
 #include <ResourceStateManager\ResourceStateManager.h>
-#include <ShaderUtils\CBuffers.h>
 #include <Utils\DebugUtils.h>
 
 namespace BRE {
+void
+ReflectionPass::DeclareTransientResources(const std::uint32_t passIndex) noexcept
+{
+    const std::uint32_t numMipLevels = _countof(mHierZBufferMipLevelRenderTargetViews);
+    BRE_ASSERT(numMipLevels == _countof(mVisibilityBufferMipLevelRenderTargetViews));
+
+    // Declare hier z buffer
+    D3D12_RESOURCE_DESC resourceDescriptor = D3DFactory::GetResourceDescriptor(ApplicationSettings::sWindowWidth,
+                                                                               ApplicationSettings::sWindowHeight,
+                                                                               DXGI_FORMAT_R32G32_FLOAT,
+                                                                               D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET,
+                                                                               D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+                                                                               D3D12_TEXTURE_LAYOUT_UNKNOWN,
+                                                                               numMipLevels);
+
+    D3D12_CLEAR_VALUE clearValue{ resourceDescriptor.Format, 0.0f, 0.0f, 0.0f, 0.0f };
+
+    mHierZBufferId = TransientResourceManager::DeclareResource(resourceDescriptor,
+                                                               D3D12_RESOURCE_STATE_COMMON,
+                                                               &clearValue,
+                                                               L"Hier Z Buffer",
+                                                               ResourceManager::ResourceStateTrackingType::SUBRESOURCE_TRACKING,
+                                                               MemoryBudget::Category::HI_Z_BUFFERS,
+                                                               passIndex,
+                                                               passIndex);
+
+    // Declare visibility buffer
+    resourceDescriptor.Format = DXGI_FORMAT_R8_UNORM;
+    clearValue = D3D12_CLEAR_VALUE{ resourceDescriptor.Format, 1.0f, 1.0f, 1.0f, 1.0f };
+
+    mVisibilityBufferId = TransientResourceManager::DeclareResource(resourceDescriptor,
+                                                                    D3D12_RESOURCE_STATE_COMMON,
+                                                                    &clearValue,
+                                                                    L"Visibility Buffer",
+                                                                    ResourceManager::ResourceStateTrackingType::SUBRESOURCE_TRACKING,
+                                                                    MemoryBudget::Category::HI_Z_BUFFERS,
+                                                                    passIndex,
+                                                                    passIndex);
+}
+
 void
 ReflectionPass::Init(ID3D12Resource& depthBuffer) noexcept
 {
@@ -44,7 +84,8 @@ ReflectionPass::Init(ID3D12Resource& depthBuffer) noexcept
 }
 
 std::uint32_t
-ReflectionPass::Execute(const FrameCBuffer& frameCBuffer) noexcept
+ReflectionPass::Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                        tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
 
@@ -52,9 +93,10 @@ ReflectionPass::Execute(const FrameCBuffer& frameCBuffer) noexcept
 
     commandListCount += RecordAndPushPrePassCommandLists();
 
-    commandListCount += RecordAndPushHierZBufferCommandLists();
+    commandListCount += RecordAndPushHierZBufferCommandLists(recordingTaskGroup);
 
-    commandListCount += RecordAndPushVisibilityBufferCommandLists(frameCBuffer);
+    commandListCount += RecordAndPushVisibilityBufferCommandLists(frameCBufferGpuAddress,
+                                                                  recordingTaskGroup);
 
     return commandListCount;
 }
@@ -67,28 +109,12 @@ ReflectionPass::InitHierZBuffer() noexcept
     const std::uint32_t numMipLevels = _countof(mHierZBufferMipLevelRenderTargetViews);
     BRE_ASSERT(numMipLevels == _countof(mHierZBufferMipLevelShaderResourceViews));
 
-    const DXGI_FORMAT bufferFormat = DXGI_FORMAT_R32G32_FLOAT;
-
-    // Create hier z buffer     
-    const D3D12_HEAP_PROPERTIES heapProperties = D3DFactory::GetHeapProperties();
-    const D3D12_RESOURCE_DESC resourceDescriptor = D3DFactory::GetResourceDescriptor(ApplicationSettings::sWindowWidth,
-                                                                                     ApplicationSettings::sWindowHeight,
-                                                                                     bufferFormat,
-                                                                                     D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET,
-                                                                                     D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-                                                                                     D3D12_TEXTURE_LAYOUT_UNKNOWN,
-                                                                                     numMipLevels);
-
-    D3D12_CLEAR_VALUE clearValue{ resourceDescriptor.Format, 0.0f, 0.0f, 0.0f, 0.0f};
-
-    mHierZBuffer = &ResourceManager::CreateCommittedResource(heapProperties,
-                                                             D3D12_HEAP_FLAG_NONE,
-                                                             resourceDescriptor,
-                                                             D3D12_RESOURCE_STATE_COMMON,
-                                                             &clearValue,
-                                                             L"Hier Z Buffer",
-                                                             ResourceManager::ResourceStateTrackingType::SUBRESOURCE_TRACKING);
-    
+    // Get hier z buffer
+    mHierZBuffer = &TransientResourceManager::GetResource(mHierZBufferId);
+    BRE_ASSERT(mHierZBuffer->GetDesc().MipLevels == numMipLevels);
+
+    const DXGI_FORMAT bufferFormat = mHierZBuffer->GetDesc().Format;
+
     // Create shader resource views to each mip levels of the hier z buffer
     // Create render target views to each mip levels of the hier z buffer
     for (std::uint32_t i = 0U; i < numMipLevels; ++i) {
@@ -134,27 +160,11 @@ ReflectionPass::InitVisibilityBuffer() noexcept
     const std::uint32_t numMipLevels = _countof(mVisibilityBufferMipLevelRenderTargetViews);
     BRE_ASSERT(numMipLevels == _countof(mVisibilityBufferMipLevelShaderResourceViews));
 
-    const DXGI_FORMAT bufferFormat = DXGI_FORMAT_R8_UNORM;
-
-    // Create visibility buffer     
-    const D3D12_HEAP_PROPERTIES heapProperties = D3DFactory::GetHeapProperties();
-    const D3D12_RESOURCE_DESC resourceDescriptor = D3DFactory::GetResourceDescriptor(ApplicationSettings::sWindowWidth,
-                                                                                     ApplicationSettings::sWindowHeight,
-                                                                                     bufferFormat,
-                                                                                     D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET,
-                                                                                     D3D12_RESOURCE_DIMENSION_TEXTURE2D,
-                                                                                     D3D12_TEXTURE_LAYOUT_UNKNOWN,
-                                                                                     numMipLevels);
+    // Get visibility buffer
+    mVisibilityBuffer = &TransientResourceManager::GetResource(mVisibilityBufferId);
+    BRE_ASSERT(mVisibilityBuffer->GetDesc().MipLevels == numMipLevels);
 
-    D3D12_CLEAR_VALUE clearValue{ resourceDescriptor.Format, 1.0f, 1.0f, 1.0f, 1.0f };
-
-    mVisibilityBuffer = &ResourceManager::CreateCommittedResource(heapProperties,
-                                                                  D3D12_HEAP_FLAG_NONE,
-                                                                  resourceDescriptor,
-                                                                  D3D12_RESOURCE_STATE_COMMON,
-                                                                  &clearValue,
-                                                                  L"Visibility Buffer",
-                                                                  ResourceManager::ResourceStateTrackingType::SUBRESOURCE_TRACKING);
+    const DXGI_FORMAT bufferFormat = mVisibilityBuffer->GetDesc().Format;
 
     // Create shader resource views to each mip levels of the visibility buffer
     // Create render target views to each mip levels of the visibility buffer
@@ -226,24 +236,24 @@ ReflectionPass::RecordAndPushPrePassCommandLists() noexcept
     D3D12_RESOURCE_BARRIER barriers[numMipLevels * 2 + 1U];
     std::uint32_t barrierCount = 0UL;
     for (std::uint32_t i = 0U; i < numMipLevels; ++i) {
-        if (ResourceStateManager::GetSubresourceState(*mHierZBuffer, i) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-            barriers[barrierCount] = ResourceStateManager::ChangeSubresourceStateAndGetBarrier(*mHierZBuffer,
-                                                                                               i,
-                                                                                               D3D12_RESOURCE_STATE_RENDER_TARGET);
+        if (ResourceStateManager::TransitionSubresourceIfNeeded(*mHierZBuffer,
+                                                                i,
+                                                                D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                                barriers[barrierCount])) {
             ++barrierCount;
         }
 
-        if (ResourceStateManager::GetSubresourceState(*mVisibilityBuffer, i) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-            barriers[barrierCount] = ResourceStateManager::ChangeSubresourceStateAndGetBarrier(*mVisibilityBuffer,
-                                                                                               i,
-                                                                                               D3D12_RESOURCE_STATE_RENDER_TARGET);
+        if (ResourceStateManager::TransitionSubresourceIfNeeded(*mVisibilityBuffer,
+                                                                i,
+                                                                D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                                barriers[barrierCount])) {
             ++barrierCount;
         }
     }
 
-    if (ResourceStateManager::GetResourceState(*mDepthBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mDepthBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mDepthBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
@@ -276,26 +286,38 @@ ReflectionPass::RecordAndPushPrePassCommandLists() noexcept
 }
 
 std::uint32_t 
-ReflectionPass::RecordAndPushHierZBufferCommandLists() noexcept
+ReflectionPass::RecordAndPushHierZBufferCommandLists(tbb::task_group& recordingTaskGroup) noexcept
 {
-    std::uint32_t commandListCount = 0U;
-
-    commandListCount += mCopyDepthBufferToHiZBufferMipLevel0CommandListRecorder.RecordAndPushCommandLists();
-
-    for (std::uint32_t i = 0U; i < _countof(mHiZBufferCommandListRecorders); ++i) {
-        commandListCount += mHiZBufferCommandListRecorders[i].RecordAndPushCommandLists();
+    const std::uint32_t hiZBufferRecorderCount = _countof(mHiZBufferCommandListRecorders);
+    const std::uint32_t commandListCount = 1U + hiZBufferRecorderCount;
+    const std::uint32_t firstCommandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(commandListCount);
+
+    recordingTaskGroup.run([this, firstCommandListSlot]() {
+        mCopyDepthBufferToHiZBufferMipLevel0CommandListRecorder.RecordAndPushCommandLists(firstCommandListSlot);
+    });
+
+    for (std::uint32_t i = 0U; i < hiZBufferRecorderCount; ++i) {
+        const std::uint32_t commandListSlot = firstCommandListSlot + 1U + i;
+        recordingTaskGroup.run([this, i, commandListSlot]() {
+            mHiZBufferCommandListRecorders[i].RecordAndPushCommandLists(commandListSlot);
+        });
     }
 
     return commandListCount;
 }
 
 std::uint32_t
-ReflectionPass::RecordAndPushVisibilityBufferCommandLists(const FrameCBuffer& frameCBuffer) noexcept
+ReflectionPass::RecordAndPushVisibilityBufferCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                                          tbb::task_group& recordingTaskGroup) noexcept
 {
-    std::uint32_t commandListCount = 0U;
-
-    for (std::uint32_t i = 0U; i < _countof(mVisibilityBufferCommandListRecorders); ++i) {
-        commandListCount += mVisibilityBufferCommandListRecorders[i].RecordAndPushCommandLists(frameCBuffer);
+    const std::uint32_t commandListCount = _countof(mVisibilityBufferCommandListRecorders);
+    const std::uint32_t firstCommandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(commandListCount);
+
+    for (std::uint32_t i = 0U; i < commandListCount; ++i) {
+        const std::uint32_t commandListSlot = firstCommandListSlot + i;
+        recordingTaskGroup.run([this, frameCBufferGpuAddress, i, commandListSlot]() {
+            mVisibilityBufferCommandListRecorders[i].RecordAndPushCommandLists(frameCBufferGpuAddress, commandListSlot);
+        });
     }
 
     return commandListCount;
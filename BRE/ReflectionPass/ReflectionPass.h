@@ -1,13 +1,13 @@
 #pragma once
 
+#include <tbb/task_group.h>
+
 #include <CommandManager\CommandListPerFrame.h>
 #include <ReflectionPass\CopyResourcesCommandListRecorder.h>
 #include <ReflectionPass\HiZBufferCommandListRecorder.h>
 #include <ReflectionPass\VisibilityBufferCommandListRecorder.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Pass responsible to apply hi-Z screen space cone-traced reflections
 /// 
@@ -20,8 +20,17 @@ public:
     ReflectionPass(ReflectionPass&&) = delete;
     ReflectionPass& operator=(ReflectionPass&&) = delete;
 
+    ///
+    /// @brief Declares the hierarchy z buffer and the visibility buffer in the TransientResourceManager
+    /// @param passIndex Index of this pass in the frame
+    ///
+    void DeclareTransientResources(const std::uint32_t passIndex) noexcept;
+
     ///
     /// @brief Initializes the pass
+    ///
+    /// DeclareTransientResources() must be called first, and then TransientResourceManager::CreateResources().
+    ///
     /// @param depthBuffer Depth buffer
     ///
     void Init(ID3D12Resource& depthBuffer) noexcept;
@@ -30,12 +39,17 @@ public:
     /// @brief Executes the pass
     ///
     /// Init() must be called first. This method can record and
-    /// push command lists to the CommandListExecutor.
+    /// push command lists to the CommandListExecutor. Barrier command lists are
+    /// recorded by the calling thread, in pass order, and the other command lists
+    /// are recorded by tasks run in @p recordingTaskGroup.
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param recordingTaskGroup Task group where recording tasks are run. The caller must wait for it
+    /// before waiting for the execution of the recorded command lists.
     /// @return The number of recorded command lists.
     ///
-    std::uint32_t Execute(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                          tbb::task_group& recordingTaskGroup) noexcept;
 
 private:
     ///
@@ -64,22 +78,29 @@ private:
     ///
     /// @brief Records command lists related with hi-z buffer and
     /// pushes them to the CommandListExecutor
+    /// @param recordingTaskGroup Task group where recording tasks are run
+    /// @return The number of recorded command lists
     ///
-    std::uint32_t RecordAndPushHierZBufferCommandLists() noexcept;
+    std::uint32_t RecordAndPushHierZBufferCommandLists(tbb::task_group& recordingTaskGroup) noexcept;
 
     ///
     /// @brief Records command lists related with the visibility buffer and
     /// pushes them to the CommandListExecutor
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param recordingTaskGroup Task group where recording tasks are run
+    /// @return The number of recorded command lists
     ///
-    std::uint32_t RecordAndPushVisibilityBufferCommandLists(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t RecordAndPushVisibilityBufferCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                                            tbb::task_group& recordingTaskGroup) noexcept;
 
     CommandListPerFrame mPrePassCommandListPerFrame;
 
+    std::uint32_t mHierZBufferId{ 0U };
     ID3D12Resource* mHierZBuffer{ nullptr };
     D3D12_CPU_DESCRIPTOR_HANDLE mHierZBufferMipLevelRenderTargetViews[10U]{ 0UL };
     D3D12_GPU_DESCRIPTOR_HANDLE mHierZBufferMipLevelShaderResourceViews[10U]{ 0UL };
 
+    std::uint32_t mVisibilityBufferId{ 0U };
     ID3D12Resource* mVisibilityBuffer{ nullptr };
     D3D12_CPU_DESCRIPTOR_HANDLE mVisibilityBufferMipLevelRenderTargetViews[10U]{ 0UL };
     D3D12_GPU_DESCRIPTOR_HANDLE mVisibilityBufferMipLevelShaderResourceViews[10U]{ 0UL };
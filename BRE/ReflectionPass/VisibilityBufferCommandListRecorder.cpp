@@ -9,7 +9,6 @@
 #include <ResourceManager/UploadBufferManager.h>
 #include <RootSignatureManager\RootSignatureManager.h>
 #include <ShaderManager\ShaderManager.h>
-#include <ShaderUtils\CBuffers.h>
 #include <Utils/DebugUtils.h>
 
 using namespace DirectX;
@@ -71,16 +70,13 @@ VisibilityBufferCommandListRecorder::Init(const D3D12_GPU_DESCRIPTOR_HANDLE& upp
 }
 
 std::uint32_t
-VisibilityBufferCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept
+VisibilityBufferCommandListRecorder::RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                                               const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
     BRE_ASSERT(sRootSignature != nullptr);
 
-    // Update frame constants
-    UploadBuffer& uploadFrameCBuffer(mFrameUploadCBufferPerFrame.GetNextFrameCBuffer());
-    uploadFrameCBuffer.CopyData(0U, &frameCBuffer, sizeof(frameCBuffer));
-
     ID3D12GraphicsCommandList& commandList = mCommandListPerFrame.ResetCommandListWithNextCommandAllocator(sPSO);
 
     commandList.RSSetViewports(1U, &ApplicationSettings::sScreenViewport);
@@ -91,17 +87,16 @@ VisibilityBufferCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffe
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
 
     commandList.SetGraphicsRootSignature(sRootSignature);
-    const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuVAddress(uploadFrameCBuffer.GetResource().GetGPUVirtualAddress());
     commandList.SetGraphicsRootDescriptorTable(0U, mUpperLevelHiZBufferShaderResourceView);
     commandList.SetGraphicsRootDescriptorTable(1U, mLowerLevelHiZBufferShaderResourceView);
     commandList.SetGraphicsRootDescriptorTable(2U, mUpperLevelHiZBufferShaderResourceView);
-    commandList.SetGraphicsRootConstantBufferView(3U, frameCBufferGpuVAddress);
+    commandList.SetGraphicsRootConstantBufferView(3U, frameCBufferGpuAddress);
 
     commandList.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
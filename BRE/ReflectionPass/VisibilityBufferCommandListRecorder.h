@@ -2,12 +2,10 @@
 
 #include <DirectXMath.h>
 
+#include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandListPerFrame.h>
-#include <ResourceManager\FrameUploadCBufferPerFrame.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible to record command lists to update a level
 /// in the visibility buffer.
@@ -50,10 +48,12 @@ public:
     ///
     /// Init() must be called first.
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                            const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
@@ -64,8 +64,6 @@ public:
 private:
     CommandListPerFrame mCommandListPerFrame;
 
-    FrameUploadCBufferPerFrame mFrameUploadCBufferPerFrame;
-
     D3D12_GPU_DESCRIPTOR_HANDLE mUpperLevelHiZBufferShaderResourceView{ 0UL };
     D3D12_GPU_DESCRIPTOR_HANDLE mLowerLevelHiZBufferShaderResourceView{ 0UL };
     D3D12_GPU_DESCRIPTOR_HANDLE mUpperLevelVisibilityBufferShaderResourceView{ 0UL };
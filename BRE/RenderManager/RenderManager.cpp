@@ -2,8 +2,10 @@
 
 #include <DirectXColors.h>
 #include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
 
 #include <CommandListExecutor/CommandListExecutor.h>
+#include <CommandManager/CommandListPool.h>
 #include <CommandManager/CommandQueueManager.h>
 #include <CommandManager/FenceManager.h>
 #include <DescriptorManager\CbvSrvUavDescriptorManager.h>
@@ -13,9 +15,17 @@
 #include <DXUtils\D3DFactory.h>
 #include <Input/Keyboard.h>
 #include <Input/Mouse.h>
+#include <ModelManager\ModelManager.h>
+#include <PSOManager\PSOManager.h>
+#include <ResourceManager\FrameUploadRing.h>
+#include <ResourceManager\MemoryBudget.h>
 #include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\StagingBufferManager.h>
+#include <ResourceManager\TransientResourceManager.h>
+#include <ResourceManager\UploadBufferManager.h>
 #include <ResourceStateManager\ResourceStateManager.h>
 #include <Scene/Scene.h>
+#include <ShaderManager\ShaderManager.h>
 
 using namespace DirectX;
 
@@ -153,35 +163,28 @@ RenderManager::Create(Scene& scene) noexcept
 {
     BRE_ASSERT(sRenderManager == nullptr);
 
-    tbb::empty_task* parent{ new (tbb::task::allocate_root()) tbb::empty_task };
-    // Reference count is 2: 1 parent task + 1 master render task
-    parent->set_ref_count(2);
-
-    sRenderManager = new (parent->allocate_child()) RenderManager(scene);
+    sRenderManager = new RenderManager(scene);
     return *sRenderManager;
 }
 
 RenderManager::RenderManager(Scene& scene)
-    : mGeometryPass(scene.GetGeometryCommandListRecorders())
+    : mFenceTimeline(FenceManager::CreateFence(0U, D3D12_FENCE_FLAG_NONE))
+    , mGeometryPass(scene.GetGeometryCommandListRecorders())
     , mCamera(scene.GetCamera())
 {
-    mFence = &FenceManager::CreateFence(0U, D3D12_FENCE_FLAG_NONE);
-
     CreateFrameBuffersAndRenderTargetViews();
 
     CreateDepthStencilBufferAndView();
 
-    CreateIntermediateColorBufferAndViews(D3D12_RESOURCE_STATE_RENDER_TARGET,
-                                          L"Intermediate Color Buffer 1",
-                                          mIntermediateColorBuffer1,
-                                          mIntermediateColorBuffer1RenderTargetView,
-                                          mIntermediateColorBuffer1ShaderResourceView);
+    CreateTransientResources();
+
+    CreateIntermediateColorBufferViews(*mIntermediateColorBuffer1,
+                                       mIntermediateColorBuffer1RenderTargetView,
+                                       mIntermediateColorBuffer1StagingShaderResourceView);
 
-    CreateIntermediateColorBufferAndViews(D3D12_RESOURCE_STATE_RENDER_TARGET,
-                                          L"Intermediate Color Buffer 2",
-                                          mIntermediateColorBuffer2,
-                                          mIntermediateColorBuffer2RenderTargetView,
-                                          mIntermediateColorBuffer2ShaderResourceView);
+    CreateIntermediateColorBufferViews(*mIntermediateColorBuffer2,
+                                       mIntermediateColorBuffer2RenderTargetView,
+                                       mIntermediateColorBuffer2StagingShaderResourceView);
 
     mCamera.SetFrustum(ApplicationSettings::sVerticalFieldOfView,
                        ApplicationSettings::GetAspectRatio(),
@@ -203,8 +206,31 @@ RenderManager::RenderManager(Scene& scene)
 
     InitPasses(scene);
 
-    // Spawns master render task
-    parent()->spawn(*this);
+    // Starts master render and update threads
+    mUpdateThread = std::thread(&RenderManager::UpdateLoop, this);
+    mThread = std::thread(&RenderManager::RenderLoop, this);
+}
+
+void
+RenderManager::CreateTransientResources() noexcept
+{
+    // Lifetimes are the ranges of passes that write or read each buffer.
+    mGeometryPass.DeclareTransientResources(GEOMETRY_PASS, ENVIRONMENT_LIGHT_PASS);
+    mAmbientOcclusionPass.DeclareTransientResources(AMBIENT_OCCLUSION_PASS, ENVIRONMENT_LIGHT_PASS);
+    mReflectionPass.DeclareTransientResources(REFLECTION_PASS);
+
+    const std::uint32_t intermediateColorBuffer1Id = DeclareIntermediateColorBuffer(L"Intermediate Color Buffer 1",
+                                                                                    ENVIRONMENT_LIGHT_PASS,
+                                                                                    TONE_MAPPING_PASS);
+
+    const std::uint32_t intermediateColorBuffer2Id = DeclareIntermediateColorBuffer(L"Intermediate Color Buffer 2",
+                                                                                    TONE_MAPPING_PASS,
+                                                                                    POST_PROCESS_PASS);
+
+    TransientResourceManager::CreateResources();
+
+    mIntermediateColorBuffer1 = &TransientResourceManager::GetResource(intermediateColorBuffer1Id);
+    mIntermediateColorBuffer2 = &TransientResourceManager::GetResource(intermediateColorBuffer2Id);
 }
 
 void
@@ -243,57 +269,44 @@ RenderManager::InitPasses(Scene& scene) noexcept
                      mDepthBufferRenderTargetView);
 
     mToneMappingPass.Init(*mIntermediateColorBuffer1,
-                          mIntermediateColorBuffer1ShaderResourceView,
+                          mIntermediateColorBuffer1StagingShaderResourceView,
                           *mIntermediateColorBuffer2,
                           mIntermediateColorBuffer2RenderTargetView);
 
     mPostProcessPass.Init(*mIntermediateColorBuffer2,
-                          mIntermediateColorBuffer2ShaderResourceView);
-
-    // Initialize fence values for all frames to the same number.
-    const std::uint64_t count{ _countof(mFenceValueByQueuedFrameIndex) };
-    for (std::uint64_t i = 0UL; i < count; ++i) {
-        mFenceValueByQueuedFrameIndex[i] = mCurrentFenceValue;
-    }
+                          mIntermediateColorBuffer2StagingShaderResourceView);
 }
 
 void
 RenderManager::Terminate() noexcept
 {
+    // Lock before notify so threads waiting for the queued constant buffer
+    // cannot miss the wake up
+    mQueuedFrameCBufferMutex.lock();
     mTerminate = true;
-    parent()->wait_for_all();
+    mQueuedFrameCBufferMutex.unlock();
+    mQueuedFrameCBufferCondition.notify_all();
+
+    BRE_ASSERT(mThread.joinable());
+    mThread.join();
+
+    BRE_ASSERT(mUpdateThread.joinable());
+    mUpdateThread.join();
 }
 
-tbb::task*
-RenderManager::execute()
+void
+RenderManager::RenderLoop() noexcept
 {
-    while (!mTerminate) {
-        mTimer.Tick();
-        UpdateCameraAndFrameCBuffer(mTimer.GetDeltaTimeInSeconds(),
-                                    mCamera,
-                                    mFrameCBuffer);
-
-        std::uint32_t commandListCount = 0U;
-        CommandListExecutor::Get().ResetExecutedCommandListCount();
-
-        commandListCount += RecordAndPushPrePassCommandLists();
-
-        commandListCount += mGeometryPass.Execute(mFrameCBuffer);
-        commandListCount += mAmbientOcclusionPass.Execute(mFrameCBuffer);
-        commandListCount += mEnvironmentLightPass.Execute(mFrameCBuffer);
-        commandListCount += mReflectionPass.Execute(mFrameCBuffer);
-        commandListCount += mSkyBoxPass.Execute(mFrameCBuffer);
-        commandListCount += mToneMappingPass.Execute();
-        commandListCount += mPostProcessPass.Execute(*GetCurrentFrameBuffer(),
-                                                     GetCurrentFrameBufferRenderTargetView());
-
-        commandListCount += RecordAndPushPostPassCommandLists();
-
-        // Wait until all previous tasks command lists are executed
-        while (CommandListExecutor::Get().GetExecutedCommandListCount() < commandListCount) {
-            Sleep(0U);
-        }
+    if (ApplicationSettings::sRenderManagerThreadAffinityMask != 0UL) {
+        SetThreadAffinityMask(GetCurrentThread(),
+                              static_cast<DWORD_PTR>(ApplicationSettings::sRenderManagerThreadAffinityMask));
+    }
 
+    // While a frame is recorded, submitted and presented, the update thread
+    // updates the camera and constant buffer of the next frame.
+    FrameCBuffer frameCBuffer;
+    while (TakeFrameCBuffer(frameCBuffer)) {
+        RecordAndSubmitFrame(frameCBuffer);
         PresentCurrentFrameAndBeginNextFrame();
     }
 
@@ -301,38 +314,126 @@ RenderManager::execute()
     // and waits until all GPU command lists are properly executed.
     CommandListExecutor::Get().Terminate();
     FlushCommandQueue();
+}
 
-    return nullptr;
+void
+RenderManager::UpdateLoop() noexcept
+{
+    do {
+        UpdateFrame();
+    } while (QueueFrameCBuffer(mFrameCBuffer));
 }
 
-std::uint32_t
-RenderManager::RecordAndPushPrePassCommandLists() noexcept
+void
+RenderManager::UpdateFrame() noexcept
 {
-    ID3D12GraphicsCommandList& commandList = mPrePassCommandListPerFrame.ResetCommandListWithNextCommandAllocator(nullptr);
+    mTimer.Tick();
+    UpdateCameraAndFrameCBuffer(mTimer.GetDeltaTimeInSeconds(),
+                                mCamera,
+                                mFrameCBuffer);
+}
 
-    D3D12_RESOURCE_BARRIER barriers[4U];
-    std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*GetCurrentFrameBuffer()) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*GetCurrentFrameBuffer(),
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
-        ++barrierCount;
+bool
+RenderManager::QueueFrameCBuffer(const FrameCBuffer& frameCBuffer) noexcept
+{
+    std::unique_lock<std::mutex> lock(mQueuedFrameCBufferMutex);
+    mQueuedFrameCBufferCondition.wait(lock, [this]() {
+        return mIsFrameCBufferQueued == false || mTerminate;
+    });
+
+    if (mTerminate) {
+        return false;
     }
 
-    if (ResourceStateManager::GetResourceState(*mIntermediateColorBuffer1) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mIntermediateColorBuffer1,
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
-        ++barrierCount;
+    mQueuedFrameCBuffer = frameCBuffer;
+    mIsFrameCBufferQueued = true;
+    lock.unlock();
+    mQueuedFrameCBufferCondition.notify_all();
+
+    return true;
+}
+
+bool
+RenderManager::TakeFrameCBuffer(FrameCBuffer& frameCBuffer) noexcept
+{
+    std::unique_lock<std::mutex> lock(mQueuedFrameCBufferMutex);
+    mQueuedFrameCBufferCondition.wait(lock, [this]() {
+        return mIsFrameCBufferQueued || mTerminate;
+    });
+
+    if (mTerminate) {
+        return false;
     }
 
-    if (ResourceStateManager::GetResourceState(*mIntermediateColorBuffer2) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mIntermediateColorBuffer2,
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
+    frameCBuffer = mQueuedFrameCBuffer;
+    mIsFrameCBufferQueued = false;
+    lock.unlock();
+    mQueuedFrameCBufferCondition.notify_all();
+
+    return true;
+}
+
+void
+RenderManager::RecordAndSubmitFrame(const FrameCBuffer& frameCBuffer) noexcept
+{
+    std::uint32_t commandListCount = 0U;
+    CommandListExecutor::Get().ResetExecutedCommandListCount();
+
+    // The constant buffer per frame is uploaded once, and all the passes
+    // read it from the same GPU address.
+    const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress =
+        FrameUploadRing::UploadConstantBuffer(&frameCBuffer, sizeof(frameCBuffer));
+
+    commandListCount += RecordAndPushPrePassCommandLists();
+
+    // Passes record their barrier command lists in this thread, in pass order,
+    // because they depend on the resource states left by previous passes.
+    // The remaining command lists are recorded in parallel by tasks. Each of them
+    // was assigned a CommandListExecutor slot, so they are still executed in pass order.
+    // Before each pass, transient resources that start their lifetime in it are
+    // prepared, because they share memory with resources of other passes.
+    tbb::task_group recordingTaskGroup;
+    commandListCount += RecordAndPushTransientResourceCommandLists(GEOMETRY_PASS);
+    commandListCount += mGeometryPass.Execute(frameCBufferGpuAddress, recordingTaskGroup);
+    commandListCount += RecordAndPushTransientResourceCommandLists(AMBIENT_OCCLUSION_PASS);
+    commandListCount += mAmbientOcclusionPass.Execute(frameCBufferGpuAddress, recordingTaskGroup);
+    commandListCount += RecordAndPushTransientResourceCommandLists(ENVIRONMENT_LIGHT_PASS);
+    commandListCount += mEnvironmentLightPass.Execute(frameCBufferGpuAddress, recordingTaskGroup);
+    commandListCount += RecordAndPushTransientResourceCommandLists(REFLECTION_PASS);
+    commandListCount += mReflectionPass.Execute(frameCBufferGpuAddress, recordingTaskGroup);
+    commandListCount += RecordAndPushTransientResourceCommandLists(SKY_BOX_PASS);
+    commandListCount += mSkyBoxPass.Execute(frameCBufferGpuAddress, recordingTaskGroup);
+    commandListCount += RecordAndPushTransientResourceCommandLists(TONE_MAPPING_PASS);
+    commandListCount += mToneMappingPass.Execute(recordingTaskGroup);
+    commandListCount += RecordAndPushTransientResourceCommandLists(POST_PROCESS_PASS);
+    commandListCount += mPostProcessPass.Execute(*GetCurrentFrameBuffer(),
+                                                 GetCurrentFrameBufferRenderTargetView(),
+                                                 recordingTaskGroup);
+
+    commandListCount += RecordAndPushPostPassCommandLists();
+
+    recordingTaskGroup.wait();
+
+    // Wait until all previous tasks command lists are executed
+    CommandListExecutor::Get().WaitForExecutedCommandListCount(commandListCount);
+}
+
+std::uint32_t
+RenderManager::RecordAndPushPrePassCommandLists() noexcept
+{
+    ID3D12GraphicsCommandList& commandList = mPrePassCommandListPerFrame.ResetCommandListWithNextCommandAllocator(nullptr);
+
+    D3D12_RESOURCE_BARRIER barriers[2U];
+    std::uint32_t barrierCount = 0UL;
+    if (ResourceStateManager::TransitionResourceIfNeeded(*GetCurrentFrameBuffer(),
+                                                         D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mDepthBuffer) != D3D12_RESOURCE_STATE_DEPTH_WRITE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mDepthBuffer,
-                                                                                        D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mDepthBuffer,
+                                                         D3D12_RESOURCE_STATE_DEPTH_WRITE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
@@ -345,16 +446,6 @@ RenderManager::RecordAndPushPrePassCommandLists() noexcept
                                       0U,
                                       nullptr);
 
-    commandList.ClearRenderTargetView(mIntermediateColorBuffer1RenderTargetView,
-                                      Colors::Black,
-                                      0U,
-                                      nullptr);
-
-    commandList.ClearRenderTargetView(mIntermediateColorBuffer2RenderTargetView,
-                                      Colors::Black,
-                                      0U,
-                                      nullptr);
-
     commandList.ClearDepthStencilView(mDepthBufferRenderTargetView,
                                       D3D12_CLEAR_FLAG_DEPTH,
                                       1.0f,
@@ -368,14 +459,63 @@ RenderManager::RecordAndPushPrePassCommandLists() noexcept
     return 1U;
 }
 
+std::uint32_t
+RenderManager::RecordAndPushTransientResourceCommandLists(const std::uint32_t passIndex) noexcept
+{
+    BRE_ASSERT(passIndex < PASS_COUNT);
+
+    // Intermediate color buffers are cleared by the first pass that uses them, because
+    // their content is undefined after other aliased resources used their memory.
+    ID3D12Resource* colorBufferToClear = nullptr;
+    D3D12_CPU_DESCRIPTOR_HANDLE colorBufferToClearRenderTargetView{ 0UL };
+    if (passIndex == ENVIRONMENT_LIGHT_PASS) {
+        colorBufferToClear = mIntermediateColorBuffer1;
+        colorBufferToClearRenderTargetView = mIntermediateColorBuffer1RenderTargetView;
+    } else if (passIndex == TONE_MAPPING_PASS) {
+        colorBufferToClear = mIntermediateColorBuffer2;
+        colorBufferToClearRenderTargetView = mIntermediateColorBuffer2RenderTargetView;
+    }
+
+    const std::vector<D3D12_RESOURCE_BARRIER>& aliasingBarriers = TransientResourceManager::GetAliasingBarriers(passIndex);
+    if (aliasingBarriers.empty() && colorBufferToClear == nullptr) {
+        return 0U;
+    }
+
+    ID3D12GraphicsCommandList& commandList = mTransientResourceCommandListPerFrame.ResetCommandListWithNextCommandAllocator(nullptr);
+
+    if (aliasingBarriers.empty() == false) {
+        commandList.ResourceBarrier(static_cast<std::uint32_t>(aliasingBarriers.size()),
+                                    aliasingBarriers.data());
+    }
+
+    if (colorBufferToClear != nullptr) {
+        D3D12_RESOURCE_BARRIER barrier{};
+        if (ResourceStateManager::TransitionResourceIfNeeded(*colorBufferToClear,
+                                                             D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                             barrier)) {
+            commandList.ResourceBarrier(1U, &barrier);
+        }
+
+        commandList.ClearRenderTargetView(colorBufferToClearRenderTargetView,
+                                          Colors::Black,
+                                          0U,
+                                          nullptr);
+    }
+
+    BRE_CHECK_HR(commandList.Close());
+    CommandListExecutor::Get().PushCommandList(commandList);
+
+    return 1U;
+}
+
 std::uint32_t
 RenderManager::RecordAndPushPostPassCommandLists() noexcept
 {
     D3D12_RESOURCE_BARRIER barriers[4U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*GetCurrentFrameBuffer()) != D3D12_RESOURCE_STATE_PRESENT) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*GetCurrentFrameBuffer(),
-                                                                                        D3D12_RESOURCE_STATE_PRESENT);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*GetCurrentFrameBuffer(),
+                                                         D3D12_RESOURCE_STATE_PRESENT,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
@@ -416,6 +556,10 @@ RenderManager::CreateFrameBuffersAndRenderTargetViews() noexcept
 
         ResourceStateManager::AddFullResourceTracking(*mFrameBuffers[i],
                                                       D3D12_RESOURCE_STATE_PRESENT);
+
+        MemoryBudget::AddResourceAllocation(*mFrameBuffers[i],
+                                            MemoryBudget::Category::FRAME_BUFFERS,
+                                            MemoryBudget::MemoryPool::VIDEO_MEMORY);
     }
 }
 
@@ -440,7 +584,8 @@ RenderManager::CreateDepthStencilBufferAndView() noexcept
                                                              D3D12_RESOURCE_STATE_DEPTH_WRITE,
                                                              &clearValue,
                                                              L"Depth Stencil Buffer",
-                                                             ResourceManager::ResourceStateTrackingType::FULL_TRACKING);
+                                                             ResourceManager::ResourceStateTrackingType::FULL_TRACKING,
+                                                             MemoryBudget::Category::DEPTH_STENCIL_BUFFERS);
 
     // Create descriptor to mip level 0 of entire resource using the format of the resource.
     D3D12_DEPTH_STENCIL_VIEW_DESC depthStencilViewDesc = {};
@@ -450,12 +595,10 @@ RenderManager::CreateDepthStencilBufferAndView() noexcept
     DepthStencilDescriptorManager::CreateDepthStencilView(*mDepthBuffer, depthStencilViewDesc, &mDepthBufferRenderTargetView);
 }
 
-void
-RenderManager::CreateIntermediateColorBufferAndViews(const D3D12_RESOURCE_STATES initialState,
-                                                     const wchar_t* resourceName,
-                                                     ID3D12Resource* &buffer,
-                                                     D3D12_CPU_DESCRIPTOR_HANDLE& renderTargetView,
-                                                     D3D12_GPU_DESCRIPTOR_HANDLE& shaderResourceView) noexcept
+std::uint32_t
+RenderManager::DeclareIntermediateColorBuffer(const wchar_t* resourceName,
+                                              const std::uint32_t firstPassIndex,
+                                              const std::uint32_t lastPassIndex) noexcept
 {
     BRE_ASSERT(resourceName != nullptr);
 
@@ -465,44 +608,47 @@ RenderManager::CreateIntermediateColorBufferAndViews(const D3D12_RESOURCE_STATES
                                                                                      ApplicationSettings::sColorBufferFormat,
                                                                                      D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET);
 
-    // Create buffer
-    const D3D12_HEAP_PROPERTIES heapProperties = D3DFactory::GetHeapProperties();
     D3D12_CLEAR_VALUE clearValue = { resourceDescriptor.Format, 0.0f, 0.0f, 0.0f, 1.0f };
-    buffer = &ResourceManager::CreateCommittedResource(heapProperties,
-                                                       D3D12_HEAP_FLAG_NONE,
-                                                       resourceDescriptor,
-                                                       initialState,
-                                                       &clearValue,
-                                                       resourceName,
-                                                       ResourceManager::ResourceStateTrackingType::FULL_TRACKING);
+    return TransientResourceManager::DeclareResource(resourceDescriptor,
+                                                     D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                     &clearValue,
+                                                     resourceName,
+                                                     ResourceManager::ResourceStateTrackingType::FULL_TRACKING,
+                                                     MemoryBudget::Category::INTERMEDIATE_BUFFERS,
+                                                     firstPassIndex,
+                                                     lastPassIndex);
+}
 
+void
+RenderManager::CreateIntermediateColorBufferViews(ID3D12Resource& buffer,
+                                                  D3D12_CPU_DESCRIPTOR_HANDLE& renderTargetView,
+                                                  D3D12_CPU_DESCRIPTOR_HANDLE& stagingShaderResourceView) noexcept
+{
     // Create render target view
     D3D12_RENDER_TARGET_VIEW_DESC rtvDescriptor{};
     rtvDescriptor.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
-    rtvDescriptor.Format = resourceDescriptor.Format;
-    RenderTargetDescriptorManager::CreateRenderTargetView(*buffer,
+    rtvDescriptor.Format = buffer.GetDesc().Format;
+    RenderTargetDescriptorManager::CreateRenderTargetView(buffer,
                                                           rtvDescriptor,
                                                           &renderTargetView);
 
-    // Create shader resource view
+    // Create staging shader resource view
     D3D12_SHADER_RESOURCE_VIEW_DESC srvDescriptor{};
     srvDescriptor.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
     srvDescriptor.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
     srvDescriptor.Texture2D.MostDetailedMip = 0;
     srvDescriptor.Texture2D.ResourceMinLODClamp = 0.0f;
-    srvDescriptor.Format = buffer->GetDesc().Format;
-    srvDescriptor.Texture2D.MipLevels = buffer->GetDesc().MipLevels;
-    shaderResourceView = CbvSrvUavDescriptorManager::CreateShaderResourceView(*buffer,
-                                                                              srvDescriptor);
+    srvDescriptor.Format = buffer.GetDesc().Format;
+    srvDescriptor.Texture2D.MipLevels = buffer.GetDesc().MipLevels;
+    stagingShaderResourceView = CbvSrvUavDescriptorManager::CreateStagingShaderResourceView(buffer,
+                                                                                            srvDescriptor);
 }
 
 void
 RenderManager::FlushCommandQueue() noexcept
 {
-    ++mCurrentFenceValue;
-    CommandListExecutor::Get().SignalFenceAndWaitForCompletion(*mFence,
-                                                               mCurrentFenceValue,
-                                                               mCurrentFenceValue);
+    const std::uint64_t fenceValue = mFenceTimeline.Signal(CommandListExecutor::Get().GetCommandQueue());
+    mFenceTimeline.WaitForValue(fenceValue);
 }
 
 void
@@ -521,14 +667,38 @@ RenderManager::PresentCurrentFrameAndBeginNextFrame() noexcept
     // Add an instruction to the command queue to set a new fence point. Because we 
     // are on the GPU time line, the new fence point won't be set until the GPU finishes
     // processing all the commands prior to this Signal().
-    mFenceValueByQueuedFrameIndex[mCurrentQueuedFrameIndex] = ++mCurrentFenceValue;
+    const std::uint64_t frameFenceValue = mFenceTimeline.Signal(CommandListExecutor::Get().GetCommandQueue());
+    mFenceValueByQueuedFrameIndex[mCurrentQueuedFrameIndex] = frameFenceValue;
+
+    // All the command lists of this frame were executed, so their command allocators
+    // and the descriptors freed during the frame can be recycled once the GPU reaches
+    // the new fence point.
+    CommandListPool::ReleaseCommandLists(mFenceTimeline, frameFenceValue);
+    CbvSrvUavDescriptorManager::RecycleFreedDescriptors(mFenceTimeline, frameFenceValue);
+
+    // The same applies to the models, resources, upload buffers, shaders and pipeline
+    // state objects removed during the frame.
+    ModelManager::ReleaseRemovedModels(mFenceTimeline, frameFenceValue);
+    PSOManager::ReleaseRemovedPSOs(mFenceTimeline, frameFenceValue);
+    ResourceManager::ReleaseRemovedResources(mFenceTimeline, frameFenceValue);
+    ShaderManager::ReleaseRemovedShaderBlobs(mFenceTimeline, frameFenceValue);
+    UploadBufferManager::ReleaseRemovedUploadBuffers(mFenceTimeline, frameFenceValue);
+
+    CbvSrvUavDescriptorManager::ReturnUnusedDescriptors();
     mCurrentQueuedFrameIndex = (mCurrentQueuedFrameIndex + 1U) % ApplicationSettings::sQueuedFrameCount;
     const std::uint64_t oldestFence{ mFenceValueByQueuedFrameIndex[mCurrentQueuedFrameIndex] };
 
     // If we executed command lists for all queued frames, then we need to wait
     // at least 1 of them to be completed, before continue recording command lists. 
-    CommandListExecutor::Get().SignalFenceAndWaitForCompletion(*mFence,
-                                                               mCurrentFenceValue,
-                                                               oldestFence);
+    mFenceTimeline.WaitForValue(oldestFence);
+
+    // The transient descriptors and the upload ring partition of the next frame
+    // were used by the oldest frame, which is already completed.
+    CbvSrvUavDescriptorManager::RecycleTransientDescriptors(mFenceTimeline, frameFenceValue);
+    FrameUploadRing::EndFrame(mFenceTimeline, frameFenceValue);
+
+    // Upload buffers of copies submitted while rendering (for example, streamed
+    // resources) are released when their copies complete. It does not block.
+    StagingBufferManager::ReleaseCompletedBuffers();
 }
 }
\ No newline at end of file
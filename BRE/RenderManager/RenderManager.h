@@ -1,13 +1,17 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <d3d12.h>
 #include <dxgi1_4.h>
-#include <tbb/task.h>
+#include <mutex>
+#include <thread>
 #include <wrl.h>
 
 #include <AmbientOcclusionPass\AmbientOcclusionPass.h>
 #include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandListPerFrame.h>
+#include <CommandManager\FenceTimeline.h>
 #include <Camera/Camera.h>
 #include <EnvironmentLightPass\EnvironmentLightPass.h>
 #include <GeometryPass\GeometryPass.h>
@@ -25,16 +29,20 @@ class Scene;
 ///
 /// @brief Responsible to initialize passes (geometry, light, skybox, etc) based on a Scene.
 ///
+/// The render loop runs on its own thread (not on a TBB worker), so the whole TBB pool
+/// is available to record command lists. The camera and the constant buffer of the next
+/// frame are updated in another dedicated thread, while the current frame is recorded.
 /// Steps:
-/// - Use RenderManager::Create() to create and spawn and instance. 
-/// - When you want to terminate this task, you should call RenderManager::Terminate()
+/// - Use RenderManager::Create() to create an instance and start its render thread. 
+/// - When you want to terminate the render thread, you should call RenderManager::Terminate()
 ///
-class RenderManager : public tbb::task {
+class RenderManager {
 public:
     ///
     /// @brief Creates a RenderManager
     ///
-    /// This mtehod must be called once.
+    /// This mtehod must be called once. The render thread is pinned according
+    /// ApplicationSettings::sRenderManagerThreadAffinityMask.
     ///
     /// @param scene Scene to create the RenderManager
     /// @return Render manager
@@ -50,20 +58,89 @@ public:
     ///
     /// @brief Terminate render manager
     ///
+    /// It waits until the render and update threads finish.
+    ///
     void Terminate() noexcept;
 
 private:
     explicit RenderManager(Scene& scene);
 
     ///
-    /// @brief Executes the tbb task.
+    /// @brief Renders frames until Terminate() is called.
+    ///
+    /// This method runs in the render thread.
+    ///
+    void RenderLoop() noexcept;
+
+    ///
+    /// @brief Updates frames and hands their constant buffers to the render thread,
+    /// until Terminate() is called.
+    ///
+    /// This method runs in the update thread.
+    ///
+    void UpdateLoop() noexcept;
+
+    ///
+    /// @brief Updates timer, camera and the constant buffer of the next frame
+    ///
+    /// This method runs in the update thread.
+    ///
+    void UpdateFrame() noexcept;
+
+    ///
+    /// @brief Queues the constant buffer of the next frame for the render thread
+    ///
+    /// It waits until the render thread takes the previously queued constant buffer,
+    /// so the update is at most one frame ahead of the recording.
     ///
-    /// This method is called when tbb::task is spawned
+    /// @param frameCBuffer Constant buffer of the frame
+    /// @return False if Terminate() was called while waiting
     ///
-    tbb::task* execute() final override;
+    bool QueueFrameCBuffer(const FrameCBuffer& frameCBuffer) noexcept;
+
+    ///
+    /// @brief Takes the queued constant buffer of the next frame
+    ///
+    /// It waits until the update thread queues it.
+    ///
+    /// @param frameCBuffer Output constant buffer of the frame
+    /// @return False if Terminate() was called while waiting
+    ///
+    bool TakeFrameCBuffer(FrameCBuffer& frameCBuffer) noexcept;
+
+    ///
+    /// @brief Records and pushes all the command lists of a frame, and waits
+    /// until they are executed.
+    ///
+    /// This method runs in the render thread.
+    ///
+    /// @param frameCBuffer Constant buffer of the frame
+    ///
+    void RecordAndSubmitFrame(const FrameCBuffer& frameCBuffer) noexcept;
 
     static RenderManager* sRenderManager;
 
+    // Indices of the passes in the frame. They define the lifetimes
+    // of the resources of the TransientResourceManager.
+    enum PassIndex {
+        GEOMETRY_PASS = 0U,
+        AMBIENT_OCCLUSION_PASS,
+        ENVIRONMENT_LIGHT_PASS,
+        REFLECTION_PASS,
+        SKY_BOX_PASS,
+        TONE_MAPPING_PASS,
+        POST_PROCESS_PASS,
+        PASS_COUNT
+    };
+
+    ///
+    /// @brief Declares the transient resources of the passes and of the intermediate
+    /// color buffers, and creates them in the TransientResourceManager
+    ///
+    /// It must be called before InitPasses().
+    ///
+    void CreateTransientResources() noexcept;
+
     ///
     /// @brief Initialize passes
     /// @param scene Scene to initialize passes
@@ -81,18 +158,29 @@ private:
     void CreateDepthStencilBufferAndView() noexcept;
 
     ///
-    /// @brief Creates intermediate color buffer, shader resource views, and render target views.
-    /// @param initialState Initial state of the buffers
+    /// @brief Declares an intermediate color buffer in the TransientResourceManager
     /// @param resourceName Resource name
-    /// @param buffer Output color buffer
+    /// @param firstPassIndex Index of the first pass that uses the buffer
+    /// @param lastPassIndex Index of the last pass that uses the buffer
+    /// @return The resource identifier
+    ///
+    std::uint32_t DeclareIntermediateColorBuffer(const wchar_t* resourceName,
+                                                 const std::uint32_t firstPassIndex,
+                                                 const std::uint32_t lastPassIndex) noexcept;
+
+    ///
+    /// @brief Creates intermediate color buffer shader resource view and render target view.
+    ///
+    /// The shader resource view is a staging view. Passes that read the buffer copy it
+    /// into a transient descriptor table each frame.
+    ///
+    /// @param buffer Color buffer
     /// @param renderTargetView Output render target view
-    /// @param shaderResourceView Output shader resource view
+    /// @param stagingShaderResourceView Output staging shader resource view
     ///
-    void CreateIntermediateColorBufferAndViews(const D3D12_RESOURCE_STATES initialState,
-                                               const wchar_t* resourceName,
-                                               ID3D12Resource* &buffer,
-                                               D3D12_CPU_DESCRIPTOR_HANDLE& renderTargetView,
-                                               D3D12_GPU_DESCRIPTOR_HANDLE& shaderResourceView) noexcept;
+    void CreateIntermediateColorBufferViews(ID3D12Resource& buffer,
+                                            D3D12_CPU_DESCRIPTOR_HANDLE& renderTargetView,
+                                            D3D12_CPU_DESCRIPTOR_HANDLE& stagingShaderResourceView) noexcept;
 
     ///
     /// @brief Get current frame buffer
@@ -120,6 +208,17 @@ private:
     ///
     std::uint32_t RecordAndPushPrePassCommandLists() noexcept;
 
+    ///
+    /// @brief Records the command lists that prepare the transient resources
+    /// whose lifetimes start in a pass, and pushes them to the CommandListExecutor.
+    ///
+    /// They are the aliasing barriers, and the clear of the intermediate color buffers.
+    ///
+    /// @param passIndex Index of the pass. It must be recorded before the pass.
+    /// @return The number of recorded command lists
+    ///
+    std::uint32_t RecordAndPushTransientResourceCommandLists(const std::uint32_t passIndex) noexcept;
+
     ///
     /// @brief Records post pass command lists and pushes them to 
     /// the CommandListExecutor.
@@ -140,10 +239,9 @@ private:
     Microsoft::WRL::ComPtr<IDXGISwapChain3> mSwapChain{ nullptr };
 
     // Fences data for synchronization purposes.
-    ID3D12Fence* mFence{ nullptr };
+    FenceTimeline mFenceTimeline;
     std::uint32_t mCurrentQueuedFrameIndex{ 0U };
     std::uint64_t mFenceValueByQueuedFrameIndex[ApplicationSettings::sQueuedFrameCount]{ 0UL };
-    std::uint64_t mCurrentFenceValue{ 0UL };
 
     // Passes
     GeometryPass mGeometryPass;
@@ -156,6 +254,7 @@ private:
 
     CommandListPerFrame mPrePassCommandListPerFrame;
     CommandListPerFrame mPostPassCommandListPerFrame;
+    CommandListPerFrame mTransientResourceCommandListPerFrame;
 
     ID3D12Resource* mFrameBuffers[ApplicationSettings::sSwapChainBufferCount]{ nullptr };
     D3D12_CPU_DESCRIPTOR_HANDLE mFrameBufferRenderTargetViews[ApplicationSettings::sSwapChainBufferCount]{ 0UL };
@@ -166,20 +265,31 @@ private:
 
     // Buffers used for intermediate computations.
     // They are used as render targets (light pass) or pixel shader resources (post processing passes)
+    // They are transient resources, so their memory is shared with other buffers that are not used at the same time.
     ID3D12Resource* mIntermediateColorBuffer1{ nullptr };
-    D3D12_GPU_DESCRIPTOR_HANDLE mIntermediateColorBuffer1ShaderResourceView{ 0UL };
+    D3D12_CPU_DESCRIPTOR_HANDLE mIntermediateColorBuffer1StagingShaderResourceView{ 0UL };
     D3D12_CPU_DESCRIPTOR_HANDLE mIntermediateColorBuffer1RenderTargetView{ 0UL };
     ID3D12Resource* mIntermediateColorBuffer2{ nullptr };
-    D3D12_GPU_DESCRIPTOR_HANDLE mIntermediateColorBuffer2ShaderResourceView{ 0UL };
+    D3D12_CPU_DESCRIPTOR_HANDLE mIntermediateColorBuffer2StagingShaderResourceView{ 0UL };
     D3D12_CPU_DESCRIPTOR_HANDLE mIntermediateColorBuffer2RenderTargetView{ 0UL };
 
-    // We cache it here, as is is used by most passes.
+    // Only used by the update thread
     FrameCBuffer mFrameCBuffer;
-
     Camera mCamera;
     Timer mTimer;
 
-    // When it is true, master render thread is destroyed.
-    bool mTerminate{ false };
+    // Constant buffer handed from the update thread to the render thread.
+    // There is a single slot, so the update thread never runs more than
+    // one frame ahead.
+    FrameCBuffer mQueuedFrameCBuffer;
+    bool mIsFrameCBufferQueued{ false };
+    std::mutex mQueuedFrameCBufferMutex;
+    std::condition_variable mQueuedFrameCBufferCondition;
+
+    std::thread mThread;
+    std::thread mUpdateThread;
+
+    // When it is true, master render and update threads are destroyed.
+    std::atomic<bool> mTerminate{ false };
 };
 }
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "BuddyAllocator.h"
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+namespace {
+///
+/// @brief Checks if a value is a power of two
+/// @param value Value
+/// @return True if @p value is a power of two
+///
+bool
+IsPowerOfTwo(const std::uint64_t value) noexcept
+{
+    return value > 0UL && (value & (value - 1UL)) == 0UL;
+}
+}
+
+BuddyAllocator::BuddyAllocator(const std::uint64_t size,
+                               const std::uint64_t minBlockSize)
+    : mSize(size)
+    , mMinBlockSize(minBlockSize)
+{
+    BRE_ASSERT(IsPowerOfTwo(size));
+    BRE_ASSERT(IsPowerOfTwo(minBlockSize));
+    BRE_ASSERT(minBlockSize <= size);
+
+    mFreeBlocksByOrder.resize(GetOrder(size) + 1U);
+    mFreeBlocksByOrder.back().insert(0UL);
+}
+
+std::uint64_t
+BuddyAllocator::Allocate(const std::uint64_t size,
+                         const std::uint64_t alignment) noexcept
+{
+    BRE_ASSERT(size > 0UL);
+    BRE_ASSERT(IsPowerOfTwo(alignment));
+
+    std::uint64_t blockSize = mMinBlockSize < alignment ? alignment : mMinBlockSize;
+    while (blockSize < size && blockSize < mSize) {
+        blockSize <<= 1UL;
+    }
+
+    if (blockSize < size || blockSize > mSize) {
+        return sInvalidOffset;
+    }
+
+    // Find the smallest free block that fits
+    const std::uint32_t order = GetOrder(blockSize);
+    std::uint32_t freeBlockOrder = order;
+    while (freeBlockOrder < mFreeBlocksByOrder.size() && mFreeBlocksByOrder[freeBlockOrder].empty()) {
+        ++freeBlockOrder;
+    }
+
+    if (freeBlockOrder == mFreeBlocksByOrder.size()) {
+        return sInvalidOffset;
+    }
+
+    std::set<std::uint64_t>& freeBlocks = mFreeBlocksByOrder[freeBlockOrder];
+    const std::uint64_t offset = *freeBlocks.begin();
+    freeBlocks.erase(freeBlocks.begin());
+
+    // Split the block until it has the requested order. The second half
+    // of each split is a free buddy.
+    while (freeBlockOrder > order) {
+        --freeBlockOrder;
+        mFreeBlocksByOrder[freeBlockOrder].insert(offset + (mMinBlockSize << freeBlockOrder));
+    }
+
+    Allocation allocation;
+    allocation.mSize = size;
+    allocation.mOrder = order;
+    mAllocations[offset] = allocation;
+
+    mAllocatedSize += size;
+    mAllocatedBlockSize += blockSize;
+    if (mAllocatedBlockSize > mMaxAllocatedBlockSize) {
+        mMaxAllocatedBlockSize = mAllocatedBlockSize;
+    }
+
+    return offset;
+}
+
+void
+BuddyAllocator::Free(const std::uint64_t offset) noexcept
+{
+    std::unordered_map<std::uint64_t, Allocation>::iterator allocationIt = mAllocations.find(offset);
+    BRE_ASSERT(allocationIt != mAllocations.end());
+
+    std::uint32_t order = allocationIt->second.mOrder;
+    mAllocatedSize -= allocationIt->second.mSize;
+    mAllocatedBlockSize -= mMinBlockSize << order;
+    mAllocations.erase(allocationIt);
+
+    // Merge with the buddy while it is free
+    std::uint64_t blockOffset = offset;
+    const std::uint32_t maxOrder = static_cast<std::uint32_t>(mFreeBlocksByOrder.size()) - 1U;
+    while (order < maxOrder) {
+        const std::uint64_t buddyOffset = blockOffset ^ (mMinBlockSize << order);
+        std::set<std::uint64_t>::iterator buddyIt = mFreeBlocksByOrder[order].find(buddyOffset);
+        if (buddyIt == mFreeBlocksByOrder[order].end()) {
+            break;
+        }
+
+        mFreeBlocksByOrder[order].erase(buddyIt);
+        blockOffset = blockOffset < buddyOffset ? blockOffset : buddyOffset;
+        ++order;
+    }
+
+    mFreeBlocksByOrder[order].insert(blockOffset);
+}
+
+BuddyAllocator::Statistics
+BuddyAllocator::GetStatistics() const noexcept
+{
+    Statistics statistics;
+    statistics.mSize = mSize;
+    statistics.mAllocatedSize = mAllocatedSize;
+    statistics.mAllocatedBlockSize = mAllocatedBlockSize;
+    statistics.mMaxAllocatedBlockSize = mMaxAllocatedBlockSize;
+    statistics.mAllocationCount = static_cast<std::uint32_t>(mAllocations.size());
+
+    const std::uint32_t orderCount = static_cast<std::uint32_t>(mFreeBlocksByOrder.size());
+    for (std::uint32_t order = 0U; order < orderCount; ++order) {
+        if (mFreeBlocksByOrder[order].empty() == false) {
+            statistics.mFreeBlockCount += static_cast<std::uint32_t>(mFreeBlocksByOrder[order].size());
+            statistics.mLargestFreeBlockSize = mMinBlockSize << order;
+        }
+    }
+
+    return statistics;
+}
+
+float
+BuddyAllocator::GetUtilization() const noexcept
+{
+    return static_cast<float>(mAllocatedSize) / mSize;
+}
+
+float
+BuddyAllocator::GetFragmentation() const noexcept
+{
+    const std::uint64_t freeSize = mSize - mAllocatedBlockSize;
+    if (freeSize == 0UL) {
+        return 0.0f;
+    }
+
+    const Statistics statistics = GetStatistics();
+    return 1.0f - static_cast<float>(statistics.mLargestFreeBlockSize) / freeSize;
+}
+
+std::uint32_t
+BuddyAllocator::GetOrder(const std::uint64_t blockSize) const noexcept
+{
+    BRE_ASSERT(IsPowerOfTwo(blockSize));
+    BRE_ASSERT(blockSize >= mMinBlockSize);
+
+    std::uint32_t order = 0U;
+    while ((mMinBlockSize << order) < blockSize) {
+        ++order;
+    }
+
+    return order;
+}
+}
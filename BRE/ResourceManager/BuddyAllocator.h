@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace BRE {
+///
+/// @brief Buddy allocator of memory blocks in a heap.
+///
+/// The heap is split into blocks whose sizes are powers of two, from the minimum block size
+/// to the heap size. A block is always placed at a multiple of its size, so an allocation is
+/// aligned to any power of two not greater than its block size. Free() merges a block with its
+/// buddy while the buddy is free.
+/// It works over byte offsets (not over the heap), so it does not depend on the device.
+/// It is not thread safe.
+///
+class BuddyAllocator {
+public:
+    ///
+    /// @brief Allocator statistics
+    ///
+    /// mAllocatedSize is the sum of the requested sizes, and mAllocatedBlockSize is the sum
+    /// of the sizes of the blocks that hold them (their difference is internal waste).
+    ///
+    struct Statistics {
+        std::uint64_t mSize{ 0UL };
+        std::uint64_t mAllocatedSize{ 0UL };
+        std::uint64_t mAllocatedBlockSize{ 0UL };
+        std::uint64_t mMaxAllocatedBlockSize{ 0UL };
+        std::uint64_t mLargestFreeBlockSize{ 0UL };
+        std::uint32_t mAllocationCount{ 0U };
+        std::uint32_t mFreeBlockCount{ 0U };
+    };
+
+    // Offset returned by Allocate() when there is no free block that fits.
+    static const std::uint64_t sInvalidOffset{ 0xFFFFFFFFFFFFFFFFUL };
+
+    ///
+    /// @brief BuddyAllocator constructor
+    /// @param size The size in bytes of the heap. It must be a power of two.
+    /// @param minBlockSize The size in bytes of the smallest block. It must be a power of two,
+    /// not greater than @p size.
+    ///
+    BuddyAllocator(const std::uint64_t size,
+                   const std::uint64_t minBlockSize);
+
+    ~BuddyAllocator() = default;
+    BuddyAllocator(const BuddyAllocator&) = delete;
+    const BuddyAllocator& operator=(const BuddyAllocator&) = delete;
+    BuddyAllocator(BuddyAllocator&&) = default;
+    BuddyAllocator& operator=(BuddyAllocator&&) = default;
+
+    ///
+    /// @brief Allocate a block
+    /// @param size The number of bytes. It must be greater than zero.
+    /// @param alignment Alignment of the offset. It must be a power of two.
+    /// @return The offset of the block, or sInvalidOffset if there is not a free block that fits.
+    ///
+    std::uint64_t Allocate(const std::uint64_t size,
+                           const std::uint64_t alignment) noexcept;
+
+    ///
+    /// @brief Free a block allocated with Allocate()
+    /// @param offset The offset returned by Allocate()
+    ///
+    void Free(const std::uint64_t offset) noexcept;
+
+    ///
+    /// @brief Get statistics
+    /// @return Statistics
+    ///
+    Statistics GetStatistics() const noexcept;
+
+    ///
+    /// @brief Get the utilization of the heap
+    /// @return The requested bytes divided by the heap size, from 0.0 to 1.0
+    ///
+    float GetUtilization() const noexcept;
+
+    ///
+    /// @brief Get the fragmentation of free memory
+    /// @return 0.0 if all the free memory is in a single block, and it approaches 1.0
+    /// as free memory is split into smaller blocks.
+    ///
+    float GetFragmentation() const noexcept;
+
+private:
+    ///
+    /// @brief Get the order of a block size
+    /// @param blockSize Block size. It must be a power of two, not less than the minimum block size.
+    /// @return The order. The minimum block size has order zero.
+    ///
+    std::uint32_t GetOrder(const std::uint64_t blockSize) const noexcept;
+
+    struct Allocation {
+        std::uint64_t mSize{ 0UL };
+        std::uint32_t mOrder{ 0U };
+    };
+
+    // Offsets of free blocks, by order
+    std::vector<std::set<std::uint64_t>> mFreeBlocksByOrder;
+
+    // Allocations by offset
+    std::unordered_map<std::uint64_t, Allocation> mAllocations;
+
+    std::uint64_t mSize{ 0UL };
+    std::uint64_t mMinBlockSize{ 0UL };
+    std::uint64_t mAllocatedSize{ 0UL };
+    std::uint64_t mAllocatedBlockSize{ 0UL };
+    std::uint64_t mMaxAllocatedBlockSize{ 0UL };
+};
+}
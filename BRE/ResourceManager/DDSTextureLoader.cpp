@@ -25,6 +25,8 @@
 
 #include "DDSTextureLoader.h" 
 
+#include <ResourceManager\ResourceHeapAllocator.h>
+
 using namespace Microsoft::WRL;
 
 #if !defined(NO_D3D11_DEBUG_NAME) && ( defined(_DEBUG) || defined(PROFILE) )
@@ -1117,6 +1119,19 @@ static HRESULT CreateD3DResources(_In_ ID3D11Device* d3dDevice,
     return hr;
 }
 
+//--------------------------------------------------------------------------------------
+// Releases a texture created by CreateD3DResources12(). Placed textures also free
+// their ResourceHeapAllocator heap memory.
+//--------------------------------------------------------------------------------------
+static void ReleaseTexture12(ComPtr<ID3D12Resource>& texture) noexcept
+{
+    if (texture != nullptr && ResourceHeapAllocator::ReleasePlacedResource(*texture.Get())) {
+        texture.Detach();
+    } else {
+        texture = nullptr;
+    }
+}
+
 static HRESULT CreateD3DResources12(
     ID3D12Device* device,
     ID3D12GraphicsCommandList* commandList,
@@ -1160,15 +1175,25 @@ static HRESULT CreateD3DResources12(
         texDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
         texDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
+        // The texture is placed in a ResourceHeapAllocator heap. It is only a committed
+        // resource if it cannot be placed.
         CD3DX12_HEAP_PROPERTIES heapProps(D3D12_HEAP_TYPE_DEFAULT);
-        hr = device->CreateCommittedResource(
-            &heapProps,
-            D3D12_HEAP_FLAG_NONE,
-            &texDesc,
-            D3D12_RESOURCE_STATE_COMMON,
-            nullptr,
-            IID_PPV_ARGS(&texture)
-        );
+        texture.Attach(ResourceHeapAllocator::CreatePlacedResource(heapProps,
+                                                                   texDesc,
+                                                                   D3D12_RESOURCE_STATE_COMMON,
+                                                                   nullptr));
+        if (texture != nullptr) {
+            hr = S_OK;
+        } else {
+            hr = device->CreateCommittedResource(
+                &heapProps,
+                D3D12_HEAP_FLAG_NONE,
+                &texDesc,
+                D3D12_RESOURCE_STATE_COMMON,
+                nullptr,
+                IID_PPV_ARGS(&texture)
+            );
+        }
 
         if (FAILED(hr)) {
             texture = nullptr;
@@ -1187,17 +1212,14 @@ static HRESULT CreateD3DResources12(
                 nullptr,
                 IID_PPV_ARGS(&textureUploadHeap));
             if (FAILED(hr)) {
-                texture = nullptr;
+                ReleaseTexture12(texture);
                 return hr;
             } else {
-                CD3DX12_RESOURCE_BARRIER resBarrier = CD3DX12_RESOURCE_BARRIER::Transition(texture.Get(), D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST);
-                commandList->ResourceBarrier(1, &resBarrier);
-
+                // There are no barriers, so the command list can be a COPY one. The texture is
+                // implicitly promoted from COMMON to COPY_DEST, and to shader resource states
+                // when shaders read it later.
                 // Use Heap-allocating UpdateSubresources implementation for variable number of subresources (which is the case for textures).
                 UpdateSubresources(commandList, texture.Get(), textureUploadHeap.Get(), 0, 0, num2DSubresources, initData);
-
-                resBarrier = CD3DX12_RESOURCE_BARRIER::Transition(texture.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
-                commandList->ResourceBarrier(1, &resBarrier);
             }
         }
     } break;
@@ -0,0 +1,81 @@
+#include "FrameUploadRing.h"
+
+#include <ApplicationSettings\ApplicationSettings.h>
+#include <CommandManager\FenceTimeline.h>
+#include <ResourceManager\UploadBufferManager.h>
+#include <Utils\DebugUtils.h>
+#include <Utils\MemoryUtils.h>
+
+namespace BRE {
+std::unique_ptr<UploadRingAllocator> FrameUploadRing::mUploadRingAllocator;
+UploadBuffer* FrameUploadRing::mUploadBuffer{ nullptr };
+
+void
+FrameUploadRing::Init(const std::size_t sizePerFrame) noexcept
+{
+    BRE_ASSERT(sizePerFrame > 0UL);
+    BRE_ASSERT(mUploadRingAllocator.get() == nullptr);
+
+    // Partitions begin at the placement alignment, so any alignment up to it
+    // relative to a partition is also an alignment of the GPU address.
+    const std::size_t alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    const std::size_t alignedSizePerFrame = (sizePerFrame + alignment - 1UL) & ~(alignment - 1UL);
+
+    mUploadBuffer = &UploadBufferManager::CreateUploadBuffer(alignedSizePerFrame,
+                                                             ApplicationSettings::sQueuedFrameCount);
+    mUploadRingAllocator.reset(new UploadRingAllocator(alignedSizePerFrame,
+                                                       ApplicationSettings::sQueuedFrameCount));
+}
+
+FrameUploadRing::Allocation
+FrameUploadRing::Allocate(const std::size_t size,
+                          const std::size_t alignment) noexcept
+{
+    BRE_ASSERT(mUploadRingAllocator.get() != nullptr);
+    BRE_ASSERT(alignment <= D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT);
+
+    Allocation allocation;
+    const std::size_t offset = mUploadRingAllocator->Allocate(size, alignment);
+    if (offset == UploadRingAllocator::sInvalidOffset) {
+        return allocation;
+    }
+
+    allocation.mCpuAddress = mUploadBuffer->GetMappedData() + offset;
+    allocation.mGpuAddress = mUploadBuffer->GetResource().GetGPUVirtualAddress() + offset;
+
+    return allocation;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS
+FrameUploadRing::UploadConstantBuffer(const void* sourceData,
+                                      const std::size_t sourceDataSize) noexcept
+{
+    BRE_ASSERT(sourceData != nullptr);
+
+    const Allocation allocation = Allocate(UploadBuffer::GetRoundedConstantBufferSizeInBytes(sourceDataSize));
+    BRE_CHECK_MSG(allocation.mCpuAddress != nullptr,
+                  L"Frame upload ring is full. Increase its size per frame");
+    MemoryUtils::CopyToWriteCombinedMemory(allocation.mCpuAddress, sourceData, sourceDataSize);
+
+    return allocation.mGpuAddress;
+}
+
+void
+FrameUploadRing::EndFrame(FenceTimeline& fenceTimeline,
+                          const std::uint64_t fenceValue) noexcept
+{
+    BRE_ASSERT(mUploadRingAllocator.get() != nullptr);
+
+    const std::uint64_t nextFrameFenceValue = mUploadRingAllocator->EndFrame(fenceValue);
+    if (nextFrameFenceValue > 0UL) {
+        fenceTimeline.WaitForValue(nextFrameFenceValue);
+    }
+}
+
+UploadRingAllocator::Statistics
+FrameUploadRing::GetStatistics() noexcept
+{
+    BRE_ASSERT(mUploadRingAllocator.get() != nullptr);
+    return mUploadRingAllocator->GetStatistics();
+}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <d3d12.h>
+#include <memory>
+
+#include <ResourceManager\UploadRingAllocator.h>
+
+namespace BRE {
+class FenceTimeline;
+class UploadBuffer;
+
+///
+/// @brief Upload memory for data that lives a single frame (for example, constant buffers per frame)
+///
+/// It is a single persistently mapped upload buffer with a partition per queued frame,
+/// sub-allocated with UploadRingAllocator. The partition of a frame is reset when
+/// the GPU finishes that frame, so allocations must not be used after the frame
+/// where they were done.
+///
+class FrameUploadRing {
+public:
+    FrameUploadRing() = delete;
+    ~FrameUploadRing() = delete;
+    FrameUploadRing(const FrameUploadRing&) = delete;
+    const FrameUploadRing& operator=(const FrameUploadRing&) = delete;
+    FrameUploadRing(FrameUploadRing&&) = delete;
+    FrameUploadRing& operator=(FrameUploadRing&&) = delete;
+
+    ///
+    /// @brief Allocation in the ring
+    ///
+    struct Allocation {
+        void* mCpuAddress{ nullptr };
+        D3D12_GPU_VIRTUAL_ADDRESS mGpuAddress{ 0UL };
+    };
+
+    ///
+    /// @brief Initializes the ring
+    ///
+    /// @param sizePerFrame The size in bytes of the partition of each queued frame.
+    /// It is rounded up to a multiple of D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT.
+    ///
+    static void Init(const std::size_t sizePerFrame) noexcept;
+
+    ///
+    /// @brief Allocate upload memory for the current frame
+    ///
+    /// This method is thread safe and lock free.
+    ///
+    /// @param size The number of bytes. It must be greater than zero.
+    /// @param alignment Alignment of the GPU address. It must be a power of two,
+    /// not greater than D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT.
+    /// @return The allocation. Its addresses are null if the partition of
+    /// the current frame is full (see GetStatistics()).
+    ///
+    static Allocation Allocate(const std::size_t size,
+                               const std::size_t alignment = D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT) noexcept;
+
+    ///
+    /// @brief Allocate a constant buffer for the current frame and copy data into it
+    ///
+    /// This method is thread safe and lock free.
+    ///
+    /// @param sourceData Data to copy. It must not be nullptr.
+    /// @param sourceDataSize Size in bytes of the data. It must be greater than zero.
+    /// @return The GPU address of the constant buffer
+    ///
+    static D3D12_GPU_VIRTUAL_ADDRESS UploadConstantBuffer(const void* sourceData,
+                                                          const std::size_t sourceDataSize) noexcept;
+
+    ///
+    /// @brief End the current frame and begin the next one
+    ///
+    /// The partition of the next frame is reset, after waiting for the frame that used it.
+    /// It must be called once per frame, when there are no threads recording command lists.
+    ///
+    /// @param fenceTimeline Timeline where @p fenceValue was signaled
+    /// @param fenceValue Fence value signaled at the end of the current frame
+    ///
+    static void EndFrame(FenceTimeline& fenceTimeline,
+                         const std::uint64_t fenceValue) noexcept;
+
+    ///
+    /// @brief Get statistics
+    ///
+    /// mMaxAllocatedSizePerFrame can be used to size the ring, and mOverflowCount
+    /// is the number of allocations that did not fit.
+    ///
+    /// @return Statistics
+    ///
+    static UploadRingAllocator::Statistics GetStatistics() noexcept;
+
+private:
+    static std::unique_ptr<UploadRingAllocator> mUploadRingAllocator;
+    static UploadBuffer* mUploadBuffer;
+};
+}
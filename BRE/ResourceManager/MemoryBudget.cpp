@@ -0,0 +1,254 @@
+#include "MemoryBudget.h"
+
+#include <fstream>
+
+#include <DirectXManager\DirectXManager.h>
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+namespace {
+const char* sCategoryNames[] = {
+    "GBuffers",
+    "IntermediateBuffers",
+    "DepthStencilBuffers",
+    "HiZBuffers",
+    "FrameBuffers",
+    "TransientHeaps",
+    "Textures",
+    "ModelBuffers",
+    "UploadBuffers",
+    "StagingBuffers",
+    "DescriptorHeaps",
+    "Shaders",
+};
+
+static_assert(sizeof(sCategoryNames) / sizeof(sCategoryNames[0]) == static_cast<std::size_t>(MemoryBudget::Category::COUNT),
+              "There must be a name per category");
+
+///
+/// @brief Writes a row of the budget table
+/// @param stream Output stream
+/// @param name Row name
+/// @param usage Usage
+///
+void
+WriteCsvRow(std::ostream& stream,
+            const char* name,
+            const MemoryBudget::Usage& usage) noexcept
+{
+    stream << name << ","
+        << usage.mVideoMemorySize << ","
+        << usage.mSystemMemorySize << ","
+        << usage.mPlacedSize << ","
+        << usage.mPeakSize << ","
+        << usage.mBudget << ","
+        << usage.mAllocationCount << "\n";
+}
+}
+
+std::unordered_map<const void*, MemoryBudget::Allocation> MemoryBudget::mAllocations;
+MemoryBudget::Usage MemoryBudget::mUsageByCategory[static_cast<std::size_t>(Category::COUNT)];
+std::uint64_t MemoryBudget::mTotalPeakSize{ 0UL };
+std::mutex MemoryBudget::mMutex;
+
+void
+MemoryBudget::Clear() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mAllocations.clear();
+    for (Usage& usage : mUsageByCategory) {
+        usage = Usage();
+    }
+    mTotalPeakSize = 0UL;
+}
+
+void
+MemoryBudget::AddAllocation(const void* allocation,
+                            const Category category,
+                            const MemoryPool memoryPool,
+                            const std::uint64_t size) noexcept
+{
+    BRE_ASSERT(allocation != nullptr);
+    BRE_ASSERT(category < Category::COUNT);
+
+    const Allocation newAllocation{ category, memoryPool, size };
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    const bool isInserted = mAllocations.insert(std::make_pair(allocation, newAllocation)).second;
+    BRE_CHECK_MSG(isInserted, L"Allocation is already registered in the memory budget");
+    UpdateUsage(newAllocation, true);
+}
+
+void
+MemoryBudget::AddResourceAllocation(ID3D12Resource& resource,
+                                    const Category category,
+                                    const MemoryPool memoryPool) noexcept
+{
+    const D3D12_RESOURCE_DESC resourceDescriptor = resource.GetDesc();
+    const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo =
+        DirectXManager::GetDevice().GetResourceAllocationInfo(0U, 1U, &resourceDescriptor);
+
+    AddAllocation(&resource, category, memoryPool, allocationInfo.SizeInBytes);
+}
+
+void
+MemoryBudget::AddDescriptorHeapAllocation(ID3D12DescriptorHeap& descriptorHeap) noexcept
+{
+    const D3D12_DESCRIPTOR_HEAP_DESC descriptorHeapDescriptor = descriptorHeap.GetDesc();
+    const std::uint64_t descriptorSize = DirectXManager::GetDescriptorHandleIncrementSize(descriptorHeapDescriptor.Type);
+    const MemoryPool memoryPool = (descriptorHeapDescriptor.Flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE) != 0
+        ? MemoryPool::VIDEO_MEMORY
+        : MemoryPool::SYSTEM_MEMORY;
+
+    AddAllocation(&descriptorHeap,
+                  Category::DESCRIPTOR_HEAPS,
+                  memoryPool,
+                  descriptorSize * descriptorHeapDescriptor.NumDescriptors);
+}
+
+void
+MemoryBudget::RemoveAllocation(const void* allocation) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    const auto it = mAllocations.find(allocation);
+    if (it != mAllocations.end()) {
+        UpdateUsage(it->second, false);
+        mAllocations.erase(it);
+    }
+}
+
+MemoryBudget::MemoryPool
+MemoryBudget::GetMemoryPool(const D3D12_HEAP_TYPE heapType) noexcept
+{
+    return heapType == D3D12_HEAP_TYPE_UPLOAD || heapType == D3D12_HEAP_TYPE_READBACK
+        ? MemoryPool::SYSTEM_MEMORY
+        : MemoryPool::VIDEO_MEMORY;
+}
+
+void
+MemoryBudget::SetBudget(const Category category,
+                        const std::uint64_t budget) noexcept
+{
+    BRE_ASSERT(category < Category::COUNT);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mUsageByCategory[static_cast<std::size_t>(category)].mBudget = budget;
+}
+
+MemoryBudget::Usage
+MemoryBudget::GetUsage(const Category category) noexcept
+{
+    BRE_ASSERT(category < Category::COUNT);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mUsageByCategory[static_cast<std::size_t>(category)];
+}
+
+MemoryBudget::Usage
+MemoryBudget::GetTotalUsage() noexcept
+{
+    Usage totalUsage;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (const Usage& usage : mUsageByCategory) {
+        totalUsage.mVideoMemorySize += usage.mVideoMemorySize;
+        totalUsage.mSystemMemorySize += usage.mSystemMemorySize;
+        totalUsage.mPlacedSize += usage.mPlacedSize;
+        totalUsage.mBudget += usage.mBudget;
+        totalUsage.mAllocationCount += usage.mAllocationCount;
+    }
+    totalUsage.mPeakSize = mTotalPeakSize;
+
+    return totalUsage;
+}
+
+bool
+MemoryBudget::IsOverBudget(const Category category) noexcept
+{
+    const Usage usage = GetUsage(category);
+
+    return usage.mBudget > 0UL && usage.mVideoMemorySize + usage.mSystemMemorySize > usage.mBudget;
+}
+
+const char*
+MemoryBudget::GetCategoryName(const Category category) noexcept
+{
+    BRE_ASSERT(category < Category::COUNT);
+    return sCategoryNames[static_cast<std::size_t>(category)];
+}
+
+void
+MemoryBudget::WriteCsv(std::ostream& stream) noexcept
+{
+    stream << "Category,VideoMemoryBytes,SystemMemoryBytes,PlacedBytes,PeakBytes,BudgetBytes,AllocationCount\n";
+
+    for (std::size_t i = 0UL; i < static_cast<std::size_t>(Category::COUNT); ++i) {
+        const Category category = static_cast<Category>(i);
+        WriteCsvRow(stream, GetCategoryName(category), GetUsage(category));
+    }
+
+    WriteCsvRow(stream, "Total", GetTotalUsage());
+}
+
+bool
+MemoryBudget::WriteCsvFile(const char* filename) noexcept
+{
+    BRE_ASSERT(filename != nullptr);
+
+    std::ofstream file(filename);
+    if (file.is_open() == false) {
+        return false;
+    }
+
+    WriteCsv(file);
+
+    return file.good();
+}
+
+void
+MemoryBudget::UpdateUsage(const Allocation& allocation,
+                          const bool isAdded) noexcept
+{
+    Usage& usage = mUsageByCategory[static_cast<std::size_t>(allocation.mCategory)];
+
+    std::uint64_t* size{ nullptr };
+    switch (allocation.mMemoryPool) {
+    case MemoryPool::VIDEO_MEMORY:
+        size = &usage.mVideoMemorySize;
+        break;
+    case MemoryPool::SYSTEM_MEMORY:
+        size = &usage.mSystemMemorySize;
+        break;
+    case MemoryPool::PLACED:
+        size = &usage.mPlacedSize;
+        break;
+    default:
+        BRE_ASSERT(false && "Unknown MemoryPool");
+        return;
+    };
+
+    if (isAdded) {
+        *size += allocation.mSize;
+        ++usage.mAllocationCount;
+    } else {
+        BRE_ASSERT(*size >= allocation.mSize);
+        BRE_ASSERT(usage.mAllocationCount > 0U);
+        *size -= allocation.mSize;
+        --usage.mAllocationCount;
+    }
+
+    // Placed sizes are already included in the size of their heaps
+    if (allocation.mMemoryPool == MemoryPool::PLACED) {
+        return;
+    }
+
+    const std::uint64_t categorySize = usage.mVideoMemorySize + usage.mSystemMemorySize;
+    usage.mPeakSize = categorySize > usage.mPeakSize ? categorySize : usage.mPeakSize;
+
+    std::uint64_t totalSize = 0UL;
+    for (const Usage& categoryUsage : mUsageByCategory) {
+        totalSize += categoryUsage.mVideoMemorySize + categoryUsage.mSystemMemorySize;
+    }
+    mTotalPeakSize = totalSize > mTotalPeakSize ? totalSize : mTotalPeakSize;
+}
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+
+namespace BRE {
+///
+/// @brief Accounts the memory allocated by each subsystem, and compares it with its budget
+///
+/// Each allocation is registered with a category, a memory pool and its size, and it is
+/// identified by its address (the resource, heap or blob), so it can be unregistered when
+/// it is released. Sizes of GPU resources are the ones reported by
+/// ID3D12Device::GetResourceAllocationInfo(), so they include alignment and padding.
+///
+/// Resources placed in heaps that are already registered (like aliased transient resources)
+/// are registered in the PLACED pool, so their sizes are reported but they are not included
+/// in the totals.
+///
+class MemoryBudget {
+public:
+    enum class Category {
+        G_BUFFERS = 0,
+        INTERMEDIATE_BUFFERS,
+        DEPTH_STENCIL_BUFFERS,
+        HI_Z_BUFFERS,
+        FRAME_BUFFERS,
+        TRANSIENT_HEAPS,
+        TEXTURES,
+        MODEL_BUFFERS,
+        UPLOAD_BUFFERS,
+        STAGING_BUFFERS,
+        DESCRIPTOR_HEAPS,
+        SHADERS,
+        COUNT
+    };
+
+    enum class MemoryPool {
+        VIDEO_MEMORY = 0,
+        SYSTEM_MEMORY,
+        PLACED,
+    };
+
+    ///
+    /// @brief Memory usage of a category
+    ///
+    struct Usage {
+        std::uint64_t mVideoMemorySize{ 0UL };
+        std::uint64_t mSystemMemorySize{ 0UL };
+        std::uint64_t mPlacedSize{ 0UL };
+        // Peak of video plus system memory size
+        std::uint64_t mPeakSize{ 0UL };
+        // Zero if there is no budget
+        std::uint64_t mBudget{ 0UL };
+        std::uint32_t mAllocationCount{ 0U };
+    };
+
+    MemoryBudget() = delete;
+    ~MemoryBudget() = delete;
+    MemoryBudget(const MemoryBudget&) = delete;
+    const MemoryBudget& operator=(const MemoryBudget&) = delete;
+    MemoryBudget(MemoryBudget&&) = delete;
+    MemoryBudget& operator=(MemoryBudget&&) = delete;
+
+    ///
+    /// @brief Unregisters all the allocations, and resets peaks and budgets
+    ///
+    static void Clear() noexcept;
+
+    ///
+    /// @brief Registers an allocation
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param allocation Address that identifies the allocation. It must not be registered.
+    /// @param category Category
+    /// @param memoryPool Memory pool
+    /// @param size Size in bytes
+    ///
+    static void AddAllocation(const void* allocation,
+                              const Category category,
+                              const MemoryPool memoryPool,
+                              const std::uint64_t size) noexcept;
+
+    ///
+    /// @brief Registers a GPU resource, with the size returned by GetResourceAllocationInfo()
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param resource Resource. It must not be registered.
+    /// @param category Category
+    /// @param memoryPool Memory pool
+    ///
+    static void AddResourceAllocation(ID3D12Resource& resource,
+                                      const Category category,
+                                      const MemoryPool memoryPool) noexcept;
+
+    ///
+    /// @brief Registers a descriptor heap as MemoryBudget::Category::DESCRIPTOR_HEAPS
+    ///
+    /// Its size is the number of descriptors by the descriptor size. Shader visible heaps
+    /// are registered in video memory, and the rest in system memory. This method is thread safe.
+    ///
+    /// @param descriptorHeap Descriptor heap. It must not be registered.
+    ///
+    static void AddDescriptorHeapAllocation(ID3D12DescriptorHeap& descriptorHeap) noexcept;
+
+    ///
+    /// @brief Unregisters an allocation
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param allocation Address passed to AddAllocation() or AddResourceAllocation().
+    /// If it is not registered, then nothing is done.
+    ///
+    static void RemoveAllocation(const void* allocation) noexcept;
+
+    ///
+    /// @brief Get the memory pool of resources in a heap
+    /// @param heapType Heap type
+    /// @return SYSTEM_MEMORY for upload and readback heaps. Otherwise, VIDEO_MEMORY.
+    ///
+    static MemoryPool GetMemoryPool(const D3D12_HEAP_TYPE heapType) noexcept;
+
+    ///
+    /// @brief Set the budget of a category
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param category Category
+    /// @param budget Budget in bytes, for video plus system memory. Zero means no budget.
+    ///
+    static void SetBudget(const Category category,
+                          const std::uint64_t budget) noexcept;
+
+    ///
+    /// @brief Get the memory usage of a category
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param category Category
+    /// @return Usage
+    ///
+    static Usage GetUsage(const Category category) noexcept;
+
+    ///
+    /// @brief Get the memory usage of all the categories
+    ///
+    /// This method is thread safe.
+    ///
+    /// @return Usage. Its peak is the peak of the total, not the sum of peaks.
+    ///
+    static Usage GetTotalUsage() noexcept;
+
+    ///
+    /// @brief Checks if a category exceeds its budget
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param category Category
+    /// @return True if the category has a budget and its video plus system memory size exceeds it
+    ///
+    static bool IsOverBudget(const Category category) noexcept;
+
+    ///
+    /// @brief Get the name of a category
+    /// @param category Category
+    /// @return Name
+    ///
+    static const char* GetCategoryName(const Category category) noexcept;
+
+    ///
+    /// @brief Writes the budget table in CSV format
+    ///
+    /// There is a row per category, and a last row with the totals.
+    /// This method is thread safe.
+    ///
+    /// @param stream Output stream
+    ///
+    static void WriteCsv(std::ostream& stream) noexcept;
+
+    ///
+    /// @brief Writes the budget table in a CSV file
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param filename Filename. It must not be nullptr.
+    /// @return True if the file was written
+    ///
+    static bool WriteCsvFile(const char* filename) noexcept;
+
+private:
+    struct Allocation {
+        Category mCategory{ Category::COUNT };
+        MemoryPool mMemoryPool{ MemoryPool::VIDEO_MEMORY };
+        std::uint64_t mSize{ 0UL };
+    };
+
+    ///
+    /// @brief Updates the usage of the category of an allocation. The mutex must be locked.
+    /// @param allocation Allocation
+    /// @param isAdded True if the allocation is added, false if it is removed
+    ///
+    static void UpdateUsage(const Allocation& allocation,
+                            const bool isAdded) noexcept;
+
+    static std::unordered_map<const void*, Allocation> mAllocations;
+    static Usage mUsageByCategory[static_cast<std::size_t>(Category::COUNT)];
+    static std::uint64_t mTotalPeakSize;
+
+    static std::mutex mMutex;
+};
+}
@@ -0,0 +1,203 @@
+#include "ResourceHeapAllocator.h"
+
+#include <DirectXManager/DirectXManager.h>
+#include <DXUtils\D3DFactory.h>
+#include <Utils/DebugUtils.h>
+
+namespace BRE {
+std::vector<ResourceHeapAllocator::Heap> ResourceHeapAllocator::mHeapsByGroup[sHeapGroupCount];
+std::unordered_map<ID3D12Resource*, ResourceHeapAllocator::Placement> ResourceHeapAllocator::mPlacementByResource;
+std::uint64_t ResourceHeapAllocator::mHeapSize{ 0UL };
+std::mutex ResourceHeapAllocator::mMutex;
+
+void
+ResourceHeapAllocator::Init(const std::uint64_t heapSize) noexcept
+{
+    BRE_ASSERT(mHeapSize == 0UL);
+    BRE_ASSERT(heapSize >= D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT);
+    BRE_ASSERT((heapSize & (heapSize - 1UL)) == 0UL);
+
+    mHeapSize = heapSize;
+}
+
+void
+ResourceHeapAllocator::Clear() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (std::vector<Heap>& heaps : mHeapsByGroup) {
+        for (Heap& heap : heaps) {
+            BRE_ASSERT(heap.mHeap != nullptr);
+            heap.mHeap->Release();
+        }
+
+        heaps.clear();
+    }
+
+    mPlacementByResource.clear();
+}
+
+ID3D12Resource*
+ResourceHeapAllocator::CreatePlacedResource(const D3D12_HEAP_PROPERTIES& heapProperties,
+                                            const D3D12_RESOURCE_DESC& resourceDescriptor,
+                                            const D3D12_RESOURCE_STATES& resourceStates,
+                                            const D3D12_CLEAR_VALUE* clearValue) noexcept
+{
+    BRE_ASSERT(mHeapSize > 0UL);
+
+    std::uint32_t heapTypeIndex = 0U;
+    switch (heapProperties.Type) {
+    case D3D12_HEAP_TYPE_DEFAULT:
+        heapTypeIndex = 0U;
+        break;
+    case D3D12_HEAP_TYPE_UPLOAD:
+        heapTypeIndex = 1U;
+        break;
+    case D3D12_HEAP_TYPE_READBACK:
+        heapTypeIndex = 2U;
+        break;
+    default:
+        return nullptr;
+    }
+
+    ResourceCategory resourceCategory = ResourceCategory::OTHER_TEXTURES;
+    D3D12_HEAP_FLAGS heapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+    if (resourceDescriptor.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER) {
+        resourceCategory = ResourceCategory::BUFFERS;
+        heapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+    } else if ((resourceDescriptor.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0U) {
+        resourceCategory = ResourceCategory::RENDER_TARGET_OR_DEPTH_STENCIL_TEXTURES;
+        heapFlags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+    }
+
+    ID3D12Device& device = DirectXManager::GetDevice();
+    const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo = device.GetResourceAllocationInfo(0U,
+                                                                                           1U,
+                                                                                           &resourceDescriptor);
+    if (allocationInfo.SizeInBytes > mHeapSize ||
+        allocationInfo.Alignment > D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT) {
+        return nullptr;
+    }
+
+    const std::uint32_t heapGroupIndex =
+        heapTypeIndex * static_cast<std::uint32_t>(ResourceCategory::COUNT) + static_cast<std::uint32_t>(resourceCategory);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::vector<Heap>& heaps = mHeapsByGroup[heapGroupIndex];
+    Heap* heap{ nullptr };
+    std::uint64_t offset = BuddyAllocator::sInvalidOffset;
+    for (Heap& currentHeap : heaps) {
+        offset = currentHeap.mBuddyAllocator->Allocate(allocationInfo.SizeInBytes, allocationInfo.Alignment);
+        if (offset != BuddyAllocator::sInvalidOffset) {
+            heap = &currentHeap;
+            break;
+        }
+    }
+
+    // All the heaps of the group are full, so we create a new one.
+    if (heap == nullptr) {
+        D3D12_HEAP_DESC heapDescriptor = {};
+        heapDescriptor.SizeInBytes = mHeapSize;
+        heapDescriptor.Properties = D3DFactory::GetHeapProperties(heapProperties.Type);
+        heapDescriptor.Alignment = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDescriptor.Flags = heapFlags;
+
+        Heap newHeap;
+        BRE_CHECK_HR(device.CreateHeap(&heapDescriptor, IID_PPV_ARGS(&newHeap.mHeap)));
+        newHeap.mBuddyAllocator.reset(new BuddyAllocator(mHeapSize,
+                                                         D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT));
+        heaps.push_back(std::move(newHeap));
+
+        heap = &heaps.back();
+        offset = heap->mBuddyAllocator->Allocate(allocationInfo.SizeInBytes, allocationInfo.Alignment);
+        BRE_ASSERT(offset != BuddyAllocator::sInvalidOffset);
+    }
+
+    ID3D12Resource* resource{ nullptr };
+    BRE_CHECK_HR(device.CreatePlacedResource(heap->mHeap,
+                                             offset,
+                                             &resourceDescriptor,
+                                             resourceStates,
+                                             clearValue,
+                                             IID_PPV_ARGS(&resource)));
+
+    Placement placement;
+    placement.mHeapGroupIndex = heapGroupIndex;
+    placement.mHeapIndex = static_cast<std::uint32_t>(heap - heaps.data());
+    placement.mOffset = offset;
+    mPlacementByResource[resource] = placement;
+
+    return resource;
+}
+
+bool
+ResourceHeapAllocator::ReleasePlacedResource(ID3D12Resource& resource) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const std::unordered_map<ID3D12Resource*, Placement>::iterator it = mPlacementByResource.find(&resource);
+    if (it == mPlacementByResource.end()) {
+        return false;
+    }
+
+    const Placement& placement = it->second;
+    BRE_ASSERT(placement.mHeapIndex < mHeapsByGroup[placement.mHeapGroupIndex].size());
+    Heap& heap = mHeapsByGroup[placement.mHeapGroupIndex][placement.mHeapIndex];
+
+    resource.Release();
+    heap.mBuddyAllocator->Free(placement.mOffset);
+    mPlacementByResource.erase(it);
+
+    return true;
+}
+
+ResourceHeapAllocator::Statistics
+ResourceHeapAllocator::GetStatistics() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Statistics statistics;
+    for (const std::vector<Heap>& heaps : mHeapsByGroup) {
+        for (const Heap& heap : heaps) {
+            const BuddyAllocator::Statistics heapStatistics = heap.mBuddyAllocator->GetStatistics();
+            statistics.mHeapSize += heapStatistics.mSize;
+            statistics.mAllocatedSize += heapStatistics.mAllocatedSize;
+            statistics.mAllocatedBlockSize += heapStatistics.mAllocatedBlockSize;
+            statistics.mAllocationCount += heapStatistics.mAllocationCount;
+            statistics.mFreeBlockCount += heapStatistics.mFreeBlockCount;
+            ++statistics.mHeapCount;
+        }
+    }
+
+    return statistics;
+}
+
+float
+ResourceHeapAllocator::GetUtilization() noexcept
+{
+    const Statistics statistics = GetStatistics();
+    if (statistics.mHeapSize == 0UL) {
+        return 0.0f;
+    }
+
+    return static_cast<float>(statistics.mAllocatedSize) / statistics.mHeapSize;
+}
+
+float
+ResourceHeapAllocator::GetFragmentation() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    float fragmentation = 0.0f;
+    for (const std::vector<Heap>& heaps : mHeapsByGroup) {
+        for (const Heap& heap : heaps) {
+            const float heapFragmentation = heap.mBuddyAllocator->GetFragmentation();
+            if (heapFragmentation > fragmentation) {
+                fragmentation = heapFragmentation;
+            }
+        }
+    }
+
+    return fragmentation;
+}
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <ResourceManager\BuddyAllocator.h>
+
+namespace BRE {
+///
+/// @brief Creates placed resources in large heaps
+///
+/// Heaps are grouped by heap type (default, upload and readback) and by resource category
+/// (buffers, render target or depth stencil textures, and other textures), because
+/// resource heap tier 1 hardware cannot mix categories in the same heap.
+/// Each heap is sub-allocated with a BuddyAllocator of D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT
+/// (64 KB) blocks, and heaps are aligned to D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT (4 MB),
+/// so multisampled textures can be placed too. A new heap is created when the heaps of a group
+/// are full.
+///
+class ResourceHeapAllocator {
+public:
+    ///
+    /// @brief Allocator statistics, for all the heaps
+    ///
+    struct Statistics {
+        std::uint64_t mHeapSize{ 0UL };
+        std::uint64_t mAllocatedSize{ 0UL };
+        std::uint64_t mAllocatedBlockSize{ 0UL };
+        std::uint32_t mHeapCount{ 0U };
+        std::uint32_t mAllocationCount{ 0U };
+        std::uint32_t mFreeBlockCount{ 0U };
+    };
+
+    ResourceHeapAllocator() = delete;
+    ~ResourceHeapAllocator() = delete;
+    ResourceHeapAllocator(const ResourceHeapAllocator&) = delete;
+    const ResourceHeapAllocator& operator=(const ResourceHeapAllocator&) = delete;
+    ResourceHeapAllocator(ResourceHeapAllocator&&) = delete;
+    ResourceHeapAllocator& operator=(ResourceHeapAllocator&&) = delete;
+
+    ///
+    /// @brief Initializes the allocator
+    /// @param heapSize The size in bytes of each heap. It must be a power of two,
+    /// not less than D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT.
+    ///
+    static void Init(const std::uint64_t heapSize) noexcept;
+
+    ///
+    /// @brief Releases all the heaps
+    ///
+    /// Resources placed in the heaps must be released first.
+    ///
+    static void Clear() noexcept;
+
+    ///
+    /// @brief Creates a placed resource
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param heapProperties Heap properties. Only D3D12_HEAP_TYPE_DEFAULT, D3D12_HEAP_TYPE_UPLOAD
+    /// and D3D12_HEAP_TYPE_READBACK heaps are supported.
+    /// @param resourceDescriptor Resource descriptor
+    /// @param resourceStates Initial resource states
+    /// @param clearValue Clear value
+    /// @return The resource, or nullptr if it cannot be placed (unsupported heap properties,
+    /// or it is larger than a heap). In that case, the caller should create a committed resource.
+    ///
+    static ID3D12Resource* CreatePlacedResource(const D3D12_HEAP_PROPERTIES& heapProperties,
+                                                const D3D12_RESOURCE_DESC& resourceDescriptor,
+                                                const D3D12_RESOURCE_STATES& resourceStates,
+                                                const D3D12_CLEAR_VALUE* clearValue) noexcept;
+
+    ///
+    /// @brief Releases a placed resource and frees its heap memory
+    ///
+    /// The GPU must not be using it. This method is thread safe.
+    ///
+    /// @param resource Resource
+    /// @return True if @p resource was created by CreatePlacedResource(). Otherwise, false,
+    /// and it is not released.
+    ///
+    static bool ReleasePlacedResource(ID3D12Resource& resource) noexcept;
+
+    ///
+    /// @brief Get statistics
+    ///
+    /// This method is thread safe.
+    ///
+    /// @return Statistics
+    ///
+    static Statistics GetStatistics() noexcept;
+
+    ///
+    /// @brief Get the utilization of the heaps
+    ///
+    /// This method is thread safe.
+    ///
+    /// @return The requested bytes divided by the size of all the heaps, from 0.0 to 1.0
+    ///
+    static float GetUtilization() noexcept;
+
+    ///
+    /// @brief Get the fragmentation of free memory
+    ///
+    /// This method is thread safe.
+    ///
+    /// @return The greatest fragmentation of a heap. See BuddyAllocator::GetFragmentation()
+    ///
+    static float GetFragmentation() noexcept;
+
+private:
+    enum class ResourceCategory {
+        BUFFERS = 0,
+        RENDER_TARGET_OR_DEPTH_STENCIL_TEXTURES,
+        OTHER_TEXTURES,
+        COUNT
+    };
+
+    struct Heap {
+        ID3D12Heap* mHeap{ nullptr };
+        std::unique_ptr<BuddyAllocator> mBuddyAllocator;
+    };
+
+    struct Placement {
+        std::uint32_t mHeapGroupIndex{ 0U };
+        std::uint32_t mHeapIndex{ 0U };
+        std::uint64_t mOffset{ 0UL };
+    };
+
+    // Heap groups are indexed by heap type (default, upload, readback) and resource category
+    static const std::uint32_t sHeapTypeCount{ 3U };
+    static const std::uint32_t sHeapGroupCount{ sHeapTypeCount * static_cast<std::uint32_t>(ResourceCategory::COUNT) };
+
+    static std::vector<Heap> mHeapsByGroup[sHeapGroupCount];
+    static std::unordered_map<ID3D12Resource*, Placement> mPlacementByResource;
+    static std::uint64_t mHeapSize;
+
+    static std::mutex mMutex;
+};
+}
@@ -1,33 +1,126 @@
 #include "ResourceManager.h"
 
+#include <DescriptorManager\BindlessTextureTable.h>
 #include <DirectXManager/DirectXManager.h>
 #include <DXUtils\D3DFactory.h>
 #include <ResourceManager\DDSTextureLoader.h>
+#include <ResourceManager\ResourceHeapAllocator.h>
+#include <ResourceManager\StagingBufferManager.h>
 #include <ResourceStateManager\ResourceStateManager.h>
 #include <ApplicationSettings\ApplicationSettings.h>
+#include <CommandManager\FenceTimeline.h>
 #include <Utils/DebugUtils.h>
 #include <Utils\StringUtils.h>
 
 namespace BRE {
-tbb::concurrent_unordered_set<ID3D12Resource*> ResourceManager::mResources;
+namespace {
+///
+/// @brief Creates a placed resource in a ResourceHeapAllocator heap, or a committed
+/// resource if it cannot be placed.
+/// @param heapProperties Heap properties
+/// @param heapFlags Heap flags. Resources are only placed if they are D3D12_HEAP_FLAG_NONE.
+/// @param resourceDescriptor Resource descriptor
+/// @param resourceStates Resource states
+/// @param clearValue Clear value
+/// @param mutex Mutex that guards committed resources creation
+/// @return The resource
+///
+ID3D12Resource*
+CreateResource(const D3D12_HEAP_PROPERTIES& heapProperties,
+               const D3D12_HEAP_FLAGS& heapFlags,
+               const D3D12_RESOURCE_DESC& resourceDescriptor,
+               const D3D12_RESOURCE_STATES& resourceStates,
+               const D3D12_CLEAR_VALUE* clearValue,
+               std::mutex& mutex) noexcept
+{
+    ID3D12Resource* resource{ nullptr };
+    if (heapFlags == D3D12_HEAP_FLAG_NONE) {
+        resource = ResourceHeapAllocator::CreatePlacedResource(heapProperties,
+                                                               resourceDescriptor,
+                                                               resourceStates,
+                                                               clearValue);
+    }
+
+    if (resource == nullptr) {
+        mutex.lock();
+        BRE_CHECK_HR(DirectXManager::GetDevice().CreateCommittedResource(&heapProperties,
+                                                                         heapFlags,
+                                                                         &resourceDescriptor,
+                                                                         resourceStates,
+                                                                         clearValue,
+                                                                         IID_PPV_ARGS(&resource)));
+        mutex.unlock();
+    }
+
+    BRE_ASSERT(resource != nullptr);
+
+    return resource;
+}
+
+///
+/// @brief Registers the resource in the ResourceStateManager, if it needs tracking
+/// @param resource Resource
+/// @param resourceStates Current resource states
+/// @param resourceStateTrackingType Resource state tracking type
+///
+void
+AddResourceStateTracking(ID3D12Resource& resource,
+                         const D3D12_RESOURCE_STATES& resourceStates,
+                         const ResourceManager::ResourceStateTrackingType resourceStateTrackingType) noexcept
+{
+    switch (resourceStateTrackingType) {
+    case ResourceManager::ResourceStateTrackingType::FULL_TRACKING:
+        ResourceStateManager::AddFullResourceTracking(resource,
+                                                      resourceStates);
+        break;
+    case ResourceManager::ResourceStateTrackingType::NO_TRACKING:
+        break;
+    case ResourceManager::ResourceStateTrackingType::SUBRESOURCE_TRACKING:
+        ResourceStateManager::AddSubresourceTracking(resource,
+                                                     resourceStates);
+        break;
+    default:
+        BRE_ASSERT(false && "Unknown ResourceStateTrackingType");
+        break;
+    };
+}
+
+///
+/// @brief Releases a removed resource, and frees its heap memory if it was placed
+/// in a ResourceHeapAllocator heap
+/// @param resource Resource
+///
+void
+ReleaseRemovedResource(ID3D12Resource& resource) noexcept
+{
+    ResourceStateManager::RemoveResourceTracking(resource);
+    BindlessTextureTable::RemoveTexture(resource);
+    MemoryBudget::RemoveAllocation(&resource);
+    if (ResourceHeapAllocator::ReleasePlacedResource(resource) == false) {
+        resource.Release();
+    }
+}
+}
+
+SlotMap<ID3D12Resource> ResourceManager::mResources;
 std::mutex ResourceManager::mMutex;
 
 void
 ResourceManager::Clear() noexcept
 {
-    for (ID3D12Resource* resource : mResources) {
-        BRE_ASSERT(resource != nullptr);
-        resource->Release();
-    }
+    mResources.Clear([](ID3D12Resource& resource) {
+        resource.Release();
+    });
 
-    mResources.clear();
+    // Heaps must be released after the resources placed in them
+    ResourceHeapAllocator::Clear();
 }
 
 ID3D12Resource&
 ResourceManager::LoadTextureFromFile(const char* textureFilename,
                                      ID3D12GraphicsCommandList& commandList,
-                                     ID3D12Resource* &uploadBuffer,
-                                     const wchar_t* resourceName) noexcept
+                                     const wchar_t* resourceName,
+                                     SlotMapHandle* resourceHandle) noexcept
 {
     ID3D12Resource* resource{ nullptr };
 
@@ -45,12 +138,18 @@ ResourceManager::LoadTextureFromFile(const char* textureFilename,
                                                      uploadBufferPtr));
     mMutex.unlock();
 
-    uploadBuffer = uploadBufferPtr.Detach();
+    StagingBufferManager::AddBuffer(commandList, *uploadBufferPtr.Detach());
 
     resource = resourcePtr.Detach();
 
     BRE_ASSERT(resource != nullptr);
-    mResources.insert(resource);
+    MemoryBudget::AddResourceAllocation(*resource,
+                                        MemoryBudget::Category::TEXTURES,
+                                        MemoryBudget::MemoryPool::VIDEO_MEMORY);
+    const SlotMapHandle handle = mResources.Insert(*resource);
+    if (resourceHandle != nullptr) {
+        *resourceHandle = handle;
+    }
 
     if (resourceName != nullptr) {
         resource->SetName(resourceName);
@@ -63,8 +162,9 @@ ID3D12Resource&
 ResourceManager::CreateDefaultBuffer(const void* sourceData,
                                      const std::size_t sourceDataSize,
                                      ID3D12GraphicsCommandList& commandList,
-                                     ID3D12Resource* &uploadBuffer,
-                                     const wchar_t* resourceName) noexcept
+                                     const wchar_t* resourceName,
+                                     const MemoryBudget::Category memoryCategory,
+                                     SlotMapHandle* resourceHandle) noexcept
 {
     BRE_ASSERT(sourceData != nullptr);
     BRE_ASSERT(sourceDataSize > 0);
@@ -85,22 +185,23 @@ ResourceManager::CreateDefaultBuffer(const void* sourceData,
                                                                                      D3D12_RESOURCE_DIMENSION_BUFFER,
                                                                                      D3D12_TEXTURE_LAYOUT_ROW_MAJOR);
 
-    mMutex.lock();
-    BRE_CHECK_HR(DirectXManager::GetDevice().CreateCommittedResource(&heapProperties,
-                                                                     D3D12_HEAP_FLAG_NONE,
-                                                                     &resourceDescriptor,
-                                                                     D3D12_RESOURCE_STATE_COMMON,
-                                                                     nullptr,
-                                                                     IID_PPV_ARGS(&resource)));
+    resource = CreateResource(heapProperties,
+                              D3D12_HEAP_FLAG_NONE,
+                              resourceDescriptor,
+                              D3D12_RESOURCE_STATE_COMMON,
+                              nullptr,
+                              mMutex);
 
     // In order to copy CPU memory data into our default buffer, we need to create
-    // an intermediate upload heap. 
+    // an intermediate upload heap. It is owned by the StagingBufferManager.
+    ID3D12Resource* uploadBuffer{ nullptr };
     heapProperties = D3DFactory::GetHeapProperties(D3D12_HEAP_TYPE_UPLOAD,
                                                    D3D12_CPU_PAGE_PROPERTY_UNKNOWN,
                                                    D3D12_MEMORY_POOL_UNKNOWN,
                                                    1U,
                                                    1U);
 
+    mMutex.lock();
     BRE_CHECK_HR(DirectXManager::GetDevice().CreateCommittedResource(&heapProperties,
                                                                      D3D12_HEAP_FLAG_NONE,
                                                                      &resourceDescriptor,
@@ -118,11 +219,8 @@ ResourceManager::CreateDefaultBuffer(const void* sourceData,
     // Schedule to copy the data to the default buffer resource. At a high level, the helper function UpdateSubresources
     // will copy the CPU memory into the intermediate upload heap.  Then, using ID3D12CommandList::CopySubresourceRegion,
     // the intermediate upload heap data will be copied to mBuffer.
-    D3D12_RESOURCE_BARRIER resourceBarrier = D3DFactory::GetTransitionResourceBarrier(*resource,
-                                                                                      D3D12_RESOURCE_STATE_COMMON,
-                                                                                      D3D12_RESOURCE_STATE_COPY_DEST); 
-    commandList.ResourceBarrier(1, &resourceBarrier);
-
+    // There are no barriers, so the command list can be a COPY one: buffers are implicitly
+    // promoted from COMMON to COPY_DEST, and to read states when they are used later.
     UpdateSubresources<1>(&commandList, 
                           resource, 
                           uploadBuffer, 
@@ -131,13 +229,16 @@ ResourceManager::CreateDefaultBuffer(const void* sourceData,
                           1,
                           &subResourceData);
 
-    resourceBarrier = D3DFactory::GetTransitionResourceBarrier(*resource,
-                                                               D3D12_RESOURCE_STATE_COPY_DEST,
-                                                               D3D12_RESOURCE_STATE_GENERIC_READ);
-    commandList.ResourceBarrier(1, &resourceBarrier);
+    StagingBufferManager::AddBuffer(commandList, *uploadBuffer);
 
     BRE_ASSERT(resource != nullptr);
-    mResources.insert(resource);
+    MemoryBudget::AddResourceAllocation(*resource,
+                                        memoryCategory,
+                                        MemoryBudget::MemoryPool::VIDEO_MEMORY);
+    const SlotMapHandle handle = mResources.Insert(*resource);
+    if (resourceHandle != nullptr) {
+        *resourceHandle = handle;
+    }
 
     if (resourceName != nullptr) {
         resource->SetName(resourceName);
@@ -153,37 +254,71 @@ ResourceManager::CreateCommittedResource(const D3D12_HEAP_PROPERTIES& heapProper
                                          const D3D12_RESOURCE_STATES& resourceStates,
                                          const D3D12_CLEAR_VALUE* clearValue,
                                          const wchar_t* resourceName,
-                                         const ResourceStateTrackingType resourceStateTrackingType) noexcept
+                                         const ResourceStateTrackingType resourceStateTrackingType,
+                                         const MemoryBudget::Category memoryCategory,
+                                         SlotMapHandle* resourceHandle) noexcept
+{
+    ID3D12Resource* resource = CreateResource(heapProperties,
+                                              heapFlags,
+                                              resourceDescriptor,
+                                              resourceStates,
+                                              clearValue,
+                                              mMutex);
+
+    AddResourceStateTracking(*resource,
+                             resourceStates,
+                             resourceStateTrackingType);
+
+    BRE_ASSERT(resource != nullptr);
+    MemoryBudget::AddResourceAllocation(*resource,
+                                        memoryCategory,
+                                        MemoryBudget::GetMemoryPool(heapProperties.Type));
+    const SlotMapHandle handle = mResources.Insert(*resource);
+    if (resourceHandle != nullptr) {
+        *resourceHandle = handle;
+    }
+
+    if (resourceName != nullptr) {
+        resource->SetName(resourceName);
+    }
+
+    return *resource;
+}
+
+ID3D12Resource&
+ResourceManager::CreatePlacedResource(ID3D12Heap& heap,
+                                      const std::uint64_t heapOffset,
+                                      const D3D12_RESOURCE_DESC& resourceDescriptor,
+                                      const D3D12_RESOURCE_STATES& resourceStates,
+                                      const D3D12_CLEAR_VALUE* clearValue,
+                                      const wchar_t* resourceName,
+                                      const ResourceStateTrackingType resourceStateTrackingType,
+                                      const MemoryBudget::Category memoryCategory,
+                                      SlotMapHandle* resourceHandle) noexcept
 {
     ID3D12Resource* resource{ nullptr };
 
     mMutex.lock();
-    BRE_CHECK_HR(DirectXManager::GetDevice().CreateCommittedResource(&heapProperties,
-                                                                     heapFlags,
-                                                                     &resourceDescriptor,
-                                                                     resourceStates,
-                                                                     clearValue,
-                                                                     IID_PPV_ARGS(&resource)));
+    BRE_CHECK_HR(DirectXManager::GetDevice().CreatePlacedResource(&heap,
+                                                                  heapOffset,
+                                                                  &resourceDescriptor,
+                                                                  resourceStates,
+                                                                  clearValue,
+                                                                  IID_PPV_ARGS(&resource)));
     mMutex.unlock();
 
-    switch (resourceStateTrackingType) {
-    case ResourceStateTrackingType::FULL_TRACKING:
-        ResourceStateManager::AddFullResourceTracking(*resource,
-                                                      resourceStates);
-        break;
-    case ResourceStateTrackingType::NO_TRACKING:
-        break;
-    case ResourceStateTrackingType::SUBRESOURCE_TRACKING:
-        ResourceStateManager::AddSubresourceTracking(*resource,
-                                                     resourceStates);
-        break;
-    default:
-        BRE_ASSERT(false && "Unknown ResourceStateTrackingType");
-        break;
-    };
+    AddResourceStateTracking(*resource,
+                             resourceStates,
+                             resourceStateTrackingType);
 
     BRE_ASSERT(resource != nullptr);
-    mResources.insert(resource);
+    MemoryBudget::AddResourceAllocation(*resource,
+                                        memoryCategory,
+                                        MemoryBudget::MemoryPool::PLACED);
+    const SlotMapHandle handle = mResources.Insert(*resource);
+    if (resourceHandle != nullptr) {
+        *resourceHandle = handle;
+    }
 
     if (resourceName != nullptr) {
         resource->SetName(resourceName);
@@ -191,4 +326,26 @@ ResourceManager::CreateCommittedResource(const D3D12_HEAP_PROPERTIES& heapProper
 
     return *resource;
 }
+
+ID3D12Resource*
+ResourceManager::GetResource(const SlotMapHandle resourceHandle) noexcept
+{
+    return mResources.Get(resourceHandle);
+}
+
+void
+ResourceManager::RemoveResource(const SlotMapHandle resourceHandle) noexcept
+{
+    BRE_CHECK_MSG(mResources.Remove(resourceHandle) != nullptr, L"Resource handle is not valid");
+}
+
+void
+ResourceManager::ReleaseRemovedResources(FenceTimeline& fenceTimeline,
+                                         const std::uint64_t fenceValue) noexcept
+{
+    const auto isComplete = [&fenceTimeline](const std::uint64_t value) {
+        return fenceTimeline.IsComplete(value);
+    };
+    mResources.ReleaseRemovedItems(fenceValue, isComplete, ReleaseRemovedResource);
+}
 }
\ No newline at end of file
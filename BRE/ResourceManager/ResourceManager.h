@@ -2,14 +2,19 @@
 
 #include <d3d12.h>
 #include <mutex>
-#include <tbb/concurrent_unordered_set.h>
 
+#include <ResourceManager\MemoryBudget.h>
 #include <ResourceManager/UploadBuffer.h>
+#include <Utils\SlotMap.h>
 
 namespace BRE {
+class FenceTimeline;
+
 ///
 /// @brief Responsible to create textures, buffers and resources.
 ///
+/// Resources are identified by SlotMap handles, so they can be removed one by one.
+///
 class ResourceManager {
 public:
     ///
@@ -43,48 +48,66 @@ public:
 
     ///
     /// @brief Loads texture from file
+    ///
+    /// The texture is placed in a ResourceHeapAllocator heap, unless it does not fit
+    /// in a heap. It is registered in the MemoryBudget as a texture.
+    ///
     /// @param textureFilename Texture filename. Must be not nullptr
     /// @param commandList Command list used to upload texture content to GPU.
     /// It must be executed after this function call to upload texture content to GPU.
-    /// It must be in recording state before calling this method.
-    /// @param uploadBuffer Upload buffer to upload the texture content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadBuffer after it knows the copy has been executed.
+    /// It must be in recording state before calling this method. The upload buffer of the copy is added
+    /// to the StagingBufferManager with this command list. No barriers are recorded, so it can be
+    /// a COPY command list. The texture is left in COMMON state.
     /// @param resourceName Resource name. If it is nullptr, then it will have the default name.
+    /// @param resourceHandle If it is not nullptr, then it is filled with the handle of the resource,
+    /// that can be used to remove it with RemoveResource().
     ///
     static ID3D12Resource& LoadTextureFromFile(const char* textureFilename,
                                                ID3D12GraphicsCommandList& commandList,
-                                               ID3D12Resource* &uploadBuffer,
-                                               const wchar_t* resourceName) noexcept;
+                                               const wchar_t* resourceName,
+                                               SlotMapHandle* resourceHandle = nullptr) noexcept;
 
     ///
     /// @brief Creates default buffer
+    ///
+    /// The default buffer is placed in a ResourceHeapAllocator heap.
+    ///
     /// @param sourceData Source data for the buffer
     /// @param sourceDataSize Source data size for the buffer
     /// @param commandList Command list used to upload buffer content to GPU.
     /// It must be executed after this function call to upload buffer content to GPU.
-    /// It must be in recording state before calling this method.
-    /// @param uploadBuffer Upload buffer to upload the buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadBuffer after it knows the copy has been executed.
+    /// It must be in recording state before calling this method. The upload buffer of the copy is added
+    /// to the StagingBufferManager with this command list. No barriers are recorded, so it can be
+    /// a COPY command list. The buffer is left in COMMON state.
     /// @param resourceName Resource name. If it is nullptr, then it will have the default name.
+    /// @param memoryCategory Category of the buffer in the MemoryBudget
+    /// @param resourceHandle If it is not nullptr, then it is filled with the handle of the resource,
+    /// that can be used to remove it with RemoveResource().
     ///
     static ID3D12Resource& CreateDefaultBuffer(const void* sourceData,
                                                const std::size_t sourceDataSize,
                                                ID3D12GraphicsCommandList& commandList,
-                                               ID3D12Resource* &uploadBuffer,
-                                               const wchar_t* resourceName) noexcept;
+                                               const wchar_t* resourceName,
+                                               const MemoryBudget::Category memoryCategory,
+                                               SlotMapHandle* resourceHandle = nullptr) noexcept;
 
     ///
     /// @brief Creates committed resource
+    ///
+    /// If @p heapFlags is D3D12_HEAP_FLAG_NONE, the resource is placed in a ResourceHeapAllocator
+    /// heap instead, unless it does not fit in a heap.
+    ///
     /// @param heapProperties Heap properties
     /// @param heapFlags Heap flags
     /// @param resourceDescriptor Resource descriptor
     /// @param resourceStates Resource states
     /// @param clearValue Clear value
     /// @param resourceName Resource name. If it is nullptr, then it will have the default name.
+    /// @param resourceStateTrackingType Resource state tracking type
+    /// @param memoryCategory Category of the resource in the MemoryBudget. Its memory pool
+    /// depends on the heap type.
+    /// @param resourceHandle If it is not nullptr, then it is filled with the handle of the resource,
+    /// that can be used to remove it with RemoveResource().
     ///
     static ID3D12Resource& CreateCommittedResource(const D3D12_HEAP_PROPERTIES& heapProperties,
                                                    const D3D12_HEAP_FLAGS& heapFlags,
@@ -92,10 +115,72 @@ public:
                                                    const D3D12_RESOURCE_STATES& resourceStates,
                                                    const D3D12_CLEAR_VALUE* clearValue,
                                                    const wchar_t* resourceName,
-                                                   const ResourceStateTrackingType resourceStateTrackingType) noexcept;
+                                                   const ResourceStateTrackingType resourceStateTrackingType,
+                                                   const MemoryBudget::Category memoryCategory,
+                                                   SlotMapHandle* resourceHandle = nullptr) noexcept;
+
+    ///
+    /// @brief Creates placed resource
+    ///
+    /// The caller owns the heap, and it must release it after Clear().
+    ///
+    /// @param heap Heap where the resource is placed
+    /// @param heapOffset Offset in bytes of the resource in the heap
+    /// @param resourceDescriptor Resource descriptor
+    /// @param resourceStates Resource states
+    /// @param clearValue Clear value
+    /// @param resourceName Resource name. If it is nullptr, then it will have the default name.
+    /// @param resourceStateTrackingType Resource state tracking type
+    /// @param memoryCategory Category of the resource in the MemoryBudget. It is registered in
+    /// the PLACED memory pool, because the memory is accounted by the owner of the heap.
+    /// @param resourceHandle If it is not nullptr, then it is filled with the handle of the resource,
+    /// that can be used to remove it with RemoveResource().
+    ///
+    static ID3D12Resource& CreatePlacedResource(ID3D12Heap& heap,
+                                                const std::uint64_t heapOffset,
+                                                const D3D12_RESOURCE_DESC& resourceDescriptor,
+                                                const D3D12_RESOURCE_STATES& resourceStates,
+                                                const D3D12_CLEAR_VALUE* clearValue,
+                                                const wchar_t* resourceName,
+                                                const ResourceStateTrackingType resourceStateTrackingType,
+                                                const MemoryBudget::Category memoryCategory,
+                                                SlotMapHandle* resourceHandle = nullptr) noexcept;
+
+    ///
+    /// @brief Get a resource
+    ///
+    /// This method is thread safe and does not lock.
+    ///
+    /// @param resourceHandle Resource handle returned by a creation method
+    /// @return The resource, or nullptr if it was removed.
+    ///
+    static ID3D12Resource* GetResource(const SlotMapHandle resourceHandle) noexcept;
+
+    ///
+    /// @brief Remove a resource
+    ///
+    /// The resource is not released immediately, because command lists in flight can still
+    /// use it. It is released once the GPU finishes the frame where it was removed
+    /// (see ReleaseRemovedResources()). This method is thread safe.
+    ///
+    /// @param resourceHandle Resource handle returned by a creation method
+    ///
+    static void RemoveResource(const SlotMapHandle resourceHandle) noexcept;
+
+    ///
+    /// @brief Release removed resources at a frame boundary.
+    ///
+    /// Resources removed since the last call are tagged with @p fenceValue, and
+    /// removed resources whose fence value already completed are released.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void ReleaseRemovedResources(FenceTimeline& fenceTimeline,
+                                        const std::uint64_t fenceValue) noexcept;
 
 private:
-    static tbb::concurrent_unordered_set<ID3D12Resource*> mResources;
+    static SlotMap<ID3D12Resource> mResources;
 
     static std::mutex mMutex;
 };
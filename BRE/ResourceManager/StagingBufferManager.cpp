@@ -0,0 +1,104 @@
+#include "StagingBufferManager.h"
+
+#include <algorithm>
+
+#include <CommandListExecutor\CommandListExecutor.h>
+#include <ResourceManager\MemoryBudget.h>
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+std::vector<StagingBufferManager::StagingBuffer> StagingBufferManager::mStagingBuffers;
+StagingBufferManager::Statistics StagingBufferManager::mStatistics;
+std::mutex StagingBufferManager::mMutex;
+
+void
+StagingBufferManager::Clear() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (StagingBuffer& stagingBuffer : mStagingBuffers) {
+        BRE_ASSERT(stagingBuffer.mBuffer != nullptr);
+        stagingBuffer.mBuffer->Release();
+    }
+
+    mStagingBuffers.clear();
+    mStatistics = Statistics();
+}
+
+void
+StagingBufferManager::AddBuffer(const ID3D12GraphicsCommandList& commandList,
+                                ID3D12Resource& uploadBuffer) noexcept
+{
+    // Upload buffers are always buffers, so their width is their size.
+    StagingBuffer stagingBuffer;
+    stagingBuffer.mBuffer = &uploadBuffer;
+    stagingBuffer.mCommandList = &commandList;
+    stagingBuffer.mSize = uploadBuffer.GetDesc().Width;
+
+    MemoryBudget::AddResourceAllocation(uploadBuffer,
+                                        MemoryBudget::Category::STAGING_BUFFERS,
+                                        MemoryBudget::MemoryPool::SYSTEM_MEMORY);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mStagingBuffers.push_back(stagingBuffer);
+
+    mStatistics.mResidentSize += stagingBuffer.mSize;
+    mStatistics.mPeakResidentSize = std::max(mStatistics.mPeakResidentSize, mStatistics.mResidentSize);
+    ++mStatistics.mResidentBufferCount;
+}
+
+void
+StagingBufferManager::SetSubmissionFence(const ID3D12GraphicsCommandList& commandList,
+                                         const SubmissionFence& submissionFence) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (StagingBuffer& stagingBuffer : mStagingBuffers) {
+        if (stagingBuffer.mIsSubmitted == false && stagingBuffer.mCommandList == &commandList) {
+            stagingBuffer.mSubmissionFence = submissionFence;
+            stagingBuffer.mIsSubmitted = true;
+        }
+    }
+}
+
+std::uint32_t
+StagingBufferManager::ReleaseCompletedBuffers() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::uint32_t releasedBufferCount = 0U;
+    std::size_t i = 0UL;
+    while (i < mStagingBuffers.size()) {
+        StagingBuffer& stagingBuffer = mStagingBuffers[i];
+        if (stagingBuffer.mIsSubmitted == false ||
+            CommandListExecutor::Get().IsComplete(stagingBuffer.mSubmissionFence) == false) {
+            ++i;
+            continue;
+        }
+
+        BRE_ASSERT(stagingBuffer.mBuffer != nullptr);
+        MemoryBudget::RemoveAllocation(stagingBuffer.mBuffer);
+        stagingBuffer.mBuffer->Release();
+
+        BRE_ASSERT(mStatistics.mResidentSize >= stagingBuffer.mSize);
+        mStatistics.mResidentSize -= stagingBuffer.mSize;
+        mStatistics.mReleasedSize += stagingBuffer.mSize;
+        --mStatistics.mResidentBufferCount;
+        ++releasedBufferCount;
+
+        // Order does not matter, so the last buffer fills the gap.
+        stagingBuffer = mStagingBuffers.back();
+        mStagingBuffers.pop_back();
+    }
+
+    return releasedBufferCount;
+}
+
+StagingBufferManager::Statistics
+StagingBufferManager::GetStatistics() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStatistics;
+}
+}
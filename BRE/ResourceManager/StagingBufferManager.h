@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <mutex>
+#include <vector>
+
+#include <CommandListExecutor\CommandQueueSubmitter.h>
+
+namespace BRE {
+///
+/// @brief Owns the upload buffers used to copy data into default buffers and textures.
+///
+/// An upload buffer is added together with the command list that records its copy.
+/// When that command list is submitted, its buffers are tracked by the fence of the
+/// submission, and they are released once the submission completes in the GPU.
+/// All the methods are thread safe.
+///
+class StagingBufferManager {
+public:
+    ///
+    /// @brief Staging memory statistics
+    ///
+    /// mResidentSize is the size of the buffers that are not released yet,
+    /// and mPeakResidentSize is its maximum value.
+    ///
+    struct Statistics {
+        std::uint64_t mResidentSize{ 0UL };
+        std::uint64_t mPeakResidentSize{ 0UL };
+        std::uint64_t mReleasedSize{ 0UL };
+        std::uint32_t mResidentBufferCount{ 0U };
+    };
+
+    StagingBufferManager() = delete;
+    ~StagingBufferManager() = delete;
+    StagingBufferManager(const StagingBufferManager&) = delete;
+    const StagingBufferManager& operator=(const StagingBufferManager&) = delete;
+    StagingBufferManager(StagingBufferManager&&) = delete;
+    StagingBufferManager& operator=(StagingBufferManager&&) = delete;
+
+    ///
+    /// @brief Releases all the upload buffers
+    ///
+    /// The GPU must not be using them.
+    ///
+    static void Clear() noexcept;
+
+    ///
+    /// @brief Add an upload buffer
+    /// @param commandList Command list that records the copy from @p uploadBuffer.
+    /// It must be in recording state.
+    /// @param uploadBuffer Upload buffer. Its ownership is transferred to this class.
+    ///
+    static void AddBuffer(const ID3D12GraphicsCommandList& commandList,
+                          ID3D12Resource& uploadBuffer) noexcept;
+
+    ///
+    /// @brief Set the submission fence of the upload buffers added with a command list
+    ///
+    /// It must be called after @p commandList is submitted, and before it is reset.
+    ///
+    /// @param commandList Command list
+    /// @param submissionFence Fence of the submission of @p commandList
+    ///
+    static void SetSubmissionFence(const ID3D12GraphicsCommandList& commandList,
+                                   const SubmissionFence& submissionFence) noexcept;
+
+    ///
+    /// @brief Releases the upload buffers whose submissions completed in the GPU
+    ///
+    /// It does not block.
+    ///
+    /// @return The number of released upload buffers
+    ///
+    static std::uint32_t ReleaseCompletedBuffers() noexcept;
+
+    ///
+    /// @brief Get statistics
+    /// @return Statistics
+    ///
+    static Statistics GetStatistics() noexcept;
+
+private:
+    struct StagingBuffer {
+        ID3D12Resource* mBuffer{ nullptr };
+        const ID3D12GraphicsCommandList* mCommandList{ nullptr };
+        SubmissionFence mSubmissionFence;
+        std::uint64_t mSize{ 0UL };
+        bool mIsSubmitted{ false };
+    };
+
+    static std::vector<StagingBuffer> mStagingBuffers;
+    static Statistics mStatistics;
+    static std::mutex mMutex;
+};
+}
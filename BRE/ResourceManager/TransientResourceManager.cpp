@@ -0,0 +1,167 @@
+#include "TransientResourceManager.h"
+
+#include <DirectXManager/DirectXManager.h>
+#include <DXUtils\D3DFactory.h>
+#include <Utils/DebugUtils.h>
+
+namespace BRE {
+std::vector<TransientResourceManager::ResourceDeclaration> TransientResourceManager::mResourceDeclarations;
+std::vector<ID3D12Resource*> TransientResourceManager::mResources;
+std::vector<std::vector<D3D12_RESOURCE_BARRIER>> TransientResourceManager::mAliasingBarriersByPass;
+TransientResourceManager::Statistics TransientResourceManager::mStatistics;
+ID3D12Heap* TransientResourceManager::mHeap{ nullptr };
+
+void
+TransientResourceManager::Clear() noexcept
+{
+    if (mHeap != nullptr) {
+        mHeap->Release();
+        mHeap = nullptr;
+    }
+
+    mResourceDeclarations.clear();
+    mResources.clear();
+    mAliasingBarriersByPass.clear();
+    mStatistics = Statistics();
+}
+
+std::uint32_t
+TransientResourceManager::DeclareResource(const D3D12_RESOURCE_DESC& resourceDescriptor,
+                                          const D3D12_RESOURCE_STATES& resourceStates,
+                                          const D3D12_CLEAR_VALUE* clearValue,
+                                          const wchar_t* resourceName,
+                                          const ResourceManager::ResourceStateTrackingType resourceStateTrackingType,
+                                          const MemoryBudget::Category memoryCategory,
+                                          const std::uint32_t firstPassIndex,
+                                          const std::uint32_t lastPassIndex) noexcept
+{
+    BRE_ASSERT(mHeap == nullptr);
+    BRE_ASSERT((resourceDescriptor.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0U);
+    BRE_ASSERT(firstPassIndex <= lastPassIndex);
+
+    ResourceDeclaration resourceDeclaration;
+    resourceDeclaration.mResourceDescriptor = resourceDescriptor;
+    resourceDeclaration.mResourceStates = resourceStates;
+    if (clearValue != nullptr) {
+        resourceDeclaration.mClearValue = *clearValue;
+        resourceDeclaration.mHasClearValue = true;
+    }
+    if (resourceName != nullptr) {
+        resourceDeclaration.mResourceName = resourceName;
+    }
+    resourceDeclaration.mResourceStateTrackingType = resourceStateTrackingType;
+    resourceDeclaration.mMemoryCategory = memoryCategory;
+    resourceDeclaration.mFirstPassIndex = firstPassIndex;
+    resourceDeclaration.mLastPassIndex = lastPassIndex;
+    mResourceDeclarations.push_back(resourceDeclaration);
+
+    return static_cast<std::uint32_t>(mResourceDeclarations.size() - 1UL);
+}
+
+void
+TransientResourceManager::CreateResources() noexcept
+{
+    BRE_ASSERT(mHeap == nullptr);
+    BRE_ASSERT(mResourceDeclarations.empty() == false);
+
+    ID3D12Device& device = DirectXManager::GetDevice();
+
+    // Compute heap offsets from resources sizes and lifetimes
+    TransientResourcePlanner transientResourcePlanner;
+    std::uint64_t heapAlignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+    std::uint32_t passCount = 0U;
+    for (const ResourceDeclaration& resourceDeclaration : mResourceDeclarations) {
+        const D3D12_RESOURCE_ALLOCATION_INFO allocationInfo =
+            device.GetResourceAllocationInfo(0U, 1U, &resourceDeclaration.mResourceDescriptor);
+        transientResourcePlanner.AddResource(allocationInfo.SizeInBytes,
+                                             allocationInfo.Alignment,
+                                             resourceDeclaration.mFirstPassIndex,
+                                             resourceDeclaration.mLastPassIndex);
+
+        if (allocationInfo.Alignment > heapAlignment) {
+            heapAlignment = allocationInfo.Alignment;
+        }
+
+        if (resourceDeclaration.mLastPassIndex + 1U > passCount) {
+            passCount = resourceDeclaration.mLastPassIndex + 1U;
+        }
+    }
+    transientResourcePlanner.Solve();
+
+    // Create the heap
+    D3D12_HEAP_DESC heapDescriptor = {};
+    heapDescriptor.SizeInBytes = (transientResourcePlanner.GetHeapSize() + heapAlignment - 1UL) & ~(heapAlignment - 1UL);
+    heapDescriptor.Properties = D3DFactory::GetHeapProperties();
+    heapDescriptor.Alignment = heapAlignment;
+    heapDescriptor.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+    BRE_CHECK_HR(device.CreateHeap(&heapDescriptor, IID_PPV_ARGS(&mHeap)));
+    MemoryBudget::AddAllocation(mHeap,
+                                MemoryBudget::Category::TRANSIENT_HEAPS,
+                                MemoryBudget::MemoryPool::VIDEO_MEMORY,
+                                heapDescriptor.SizeInBytes);
+
+    // Create the resources and the aliasing barriers of their first passes
+    mAliasingBarriersByPass.resize(passCount);
+    const std::uint32_t resourceCount = static_cast<std::uint32_t>(mResourceDeclarations.size());
+    for (std::uint32_t i = 0U; i < resourceCount; ++i) {
+        const ResourceDeclaration& resourceDeclaration = mResourceDeclarations[i];
+        ID3D12Resource& resource =
+            ResourceManager::CreatePlacedResource(*mHeap,
+                                                  transientResourcePlanner.GetOffset(i),
+                                                  resourceDeclaration.mResourceDescriptor,
+                                                  resourceDeclaration.mResourceStates,
+                                                  resourceDeclaration.mHasClearValue ? &resourceDeclaration.mClearValue : nullptr,
+                                                  resourceDeclaration.mResourceName.empty() ? nullptr : resourceDeclaration.mResourceName.c_str(),
+                                                  resourceDeclaration.mResourceStateTrackingType,
+                                                  resourceDeclaration.mMemoryCategory);
+        mResources.push_back(&resource);
+
+        if (transientResourcePlanner.IsAliased(i)) {
+            // The resource before is not specified, because it can be any of the
+            // resources that share memory with this one.
+            D3D12_RESOURCE_BARRIER aliasingBarrier{};
+            aliasingBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+            aliasingBarrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            aliasingBarrier.Aliasing.pResourceBefore = nullptr;
+            aliasingBarrier.Aliasing.pResourceAfter = &resource;
+            mAliasingBarriersByPass[resourceDeclaration.mFirstPassIndex].push_back(aliasingBarrier);
+
+            ++mStatistics.mAliasedResourceCount;
+        }
+    }
+
+    mStatistics.mHeapSize = heapDescriptor.SizeInBytes;
+    mStatistics.mResourceSize = transientResourcePlanner.GetResourceSize();
+    mStatistics.mResourceCount = resourceCount;
+}
+
+ID3D12Resource&
+TransientResourceManager::GetResource(const std::uint32_t resourceId) noexcept
+{
+    BRE_ASSERT(resourceId < mResources.size());
+    BRE_ASSERT(mResources[resourceId] != nullptr);
+
+    return *mResources[resourceId];
+}
+
+const std::vector<D3D12_RESOURCE_BARRIER>&
+TransientResourceManager::GetAliasingBarriers(const std::uint32_t passIndex) noexcept
+{
+    BRE_ASSERT(mHeap != nullptr);
+
+    static const std::vector<D3D12_RESOURCE_BARRIER> sNoAliasingBarriers;
+    if (passIndex >= mAliasingBarriersByPass.size()) {
+        return sNoAliasingBarriers;
+    }
+
+    return mAliasingBarriersByPass[passIndex];
+}
+
+TransientResourceManager::Statistics
+TransientResourceManager::GetStatistics() noexcept
+{
+    BRE_ASSERT(mHeap != nullptr);
+
+    return mStatistics;
+}
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <d3d12.h>
+#include <string>
+#include <vector>
+
+#include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\TransientResourcePlanner.h>
+
+namespace BRE {
+///
+/// @brief Creates render targets that are only used during a part of the frame,
+/// and aliases the ones whose lifetimes do not overlap in the same heap.
+///
+/// Resources are first declared with the range of passes where they are used,
+/// and then all of them are created at once with CreateResources(). The offsets in
+/// the heap are computed with TransientResourcePlanner.
+/// The first use of an aliased resource in a frame must be preceded by the barriers
+/// returned by GetAliasingBarriers(), and it must initialize the whole resource
+/// (a clear, a discard or a full copy), because its content is undefined.
+///
+class TransientResourceManager {
+public:
+    ///
+    /// @brief Transient resources statistics
+    ///
+    struct Statistics {
+        std::uint64_t mHeapSize{ 0UL };
+        std::uint64_t mResourceSize{ 0UL };
+        std::uint32_t mResourceCount{ 0U };
+        std::uint32_t mAliasedResourceCount{ 0U };
+    };
+
+    TransientResourceManager() = delete;
+    ~TransientResourceManager() = delete;
+    TransientResourceManager(const TransientResourceManager&) = delete;
+    const TransientResourceManager& operator=(const TransientResourceManager&) = delete;
+    TransientResourceManager(TransientResourceManager&&) = delete;
+    TransientResourceManager& operator=(TransientResourceManager&&) = delete;
+
+    ///
+    /// @brief Releases the heap
+    ///
+    /// It must be called after ResourceManager::Clear()
+    ///
+    static void Clear() noexcept;
+
+    ///
+    /// @brief Declares a transient resource
+    ///
+    /// It must be called before CreateResources().
+    ///
+    /// @param resourceDescriptor Resource descriptor. It must be a render target or depth stencil texture.
+    /// @param resourceStates Initial resource states
+    /// @param clearValue Clear value. It can be nullptr.
+    /// @param resourceName Resource name. If it is nullptr, then it will have the default name.
+    /// @param resourceStateTrackingType Resource state tracking type
+    /// @param memoryCategory Category of the resource in the MemoryBudget. The heap is registered
+    /// as a transient heap, so the resource is registered in the PLACED memory pool.
+    /// @param firstPassIndex Index of the first pass of the frame that uses the resource
+    /// @param lastPassIndex Index of the last pass of the frame that uses the resource
+    /// @return The resource identifier
+    ///
+    static std::uint32_t DeclareResource(const D3D12_RESOURCE_DESC& resourceDescriptor,
+                                         const D3D12_RESOURCE_STATES& resourceStates,
+                                         const D3D12_CLEAR_VALUE* clearValue,
+                                         const wchar_t* resourceName,
+                                         const ResourceManager::ResourceStateTrackingType resourceStateTrackingType,
+                                         const MemoryBudget::Category memoryCategory,
+                                         const std::uint32_t firstPassIndex,
+                                         const std::uint32_t lastPassIndex) noexcept;
+
+    ///
+    /// @brief Creates the heap and all the declared resources
+    ///
+    static void CreateResources() noexcept;
+
+    ///
+    /// @brief Get a resource
+    ///
+    /// CreateResources() must be called first.
+    ///
+    /// @param resourceId Identifier returned by DeclareResource()
+    /// @return The resource
+    ///
+    static ID3D12Resource& GetResource(const std::uint32_t resourceId) noexcept;
+
+    ///
+    /// @brief Get the aliasing barriers of a pass
+    ///
+    /// CreateResources() must be called first.
+    ///
+    /// @param passIndex Pass index
+    /// @return The aliasing barriers of the aliased resources whose first pass is @p passIndex.
+    /// It is empty if there are none.
+    ///
+    static const std::vector<D3D12_RESOURCE_BARRIER>& GetAliasingBarriers(const std::uint32_t passIndex) noexcept;
+
+    ///
+    /// @brief Get statistics
+    ///
+    /// CreateResources() must be called first.
+    ///
+    /// @return Statistics
+    ///
+    static Statistics GetStatistics() noexcept;
+
+private:
+    struct ResourceDeclaration {
+        D3D12_RESOURCE_DESC mResourceDescriptor{};
+        D3D12_RESOURCE_STATES mResourceStates{ D3D12_RESOURCE_STATE_COMMON };
+        D3D12_CLEAR_VALUE mClearValue{};
+        bool mHasClearValue{ false };
+        std::wstring mResourceName;
+        ResourceManager::ResourceStateTrackingType mResourceStateTrackingType{ ResourceManager::ResourceStateTrackingType::NO_TRACKING };
+        MemoryBudget::Category mMemoryCategory{ MemoryBudget::Category::INTERMEDIATE_BUFFERS };
+        std::uint32_t mFirstPassIndex{ 0U };
+        std::uint32_t mLastPassIndex{ 0U };
+    };
+
+    static std::vector<ResourceDeclaration> mResourceDeclarations;
+    static std::vector<ID3D12Resource*> mResources;
+    static std::vector<std::vector<D3D12_RESOURCE_BARRIER>> mAliasingBarriersByPass;
+    static Statistics mStatistics;
+    static ID3D12Heap* mHeap;
+};
+}
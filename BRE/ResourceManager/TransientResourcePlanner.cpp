@@ -0,0 +1,145 @@
+#include "TransientResourcePlanner.h"
+
+#include <algorithm>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+namespace {
+///
+/// @brief Rounds up a value to a multiple of an alignment
+/// @param value Value
+/// @param alignment Alignment. It must be a power of two.
+/// @return The aligned value
+///
+std::uint64_t
+AlignUp(const std::uint64_t value,
+        const std::uint64_t alignment) noexcept
+{
+    return (value + alignment - 1UL) & ~(alignment - 1UL);
+}
+}
+
+std::uint32_t
+TransientResourcePlanner::AddResource(const std::uint64_t size,
+                                      const std::uint64_t alignment,
+                                      const std::uint32_t firstPassIndex,
+                                      const std::uint32_t lastPassIndex) noexcept
+{
+    BRE_ASSERT(mIsSolved == false);
+    BRE_ASSERT(size > 0UL);
+    BRE_ASSERT(alignment > 0UL && (alignment & (alignment - 1UL)) == 0UL);
+    BRE_ASSERT(firstPassIndex <= lastPassIndex);
+
+    Resource resource;
+    resource.mSize = size;
+    resource.mAlignment = alignment;
+    resource.mFirstPassIndex = firstPassIndex;
+    resource.mLastPassIndex = lastPassIndex;
+    mResources.push_back(resource);
+
+    return static_cast<std::uint32_t>(mResources.size() - 1UL);
+}
+
+void
+TransientResourcePlanner::Solve() noexcept
+{
+    BRE_ASSERT(mIsSolved == false);
+
+    // Larger resources are placed first, so smaller ones fill the gaps between them.
+    std::vector<std::uint32_t> resourceIndices(mResources.size());
+    for (std::uint32_t i = 0U; i < resourceIndices.size(); ++i) {
+        resourceIndices[i] = i;
+    }
+
+    std::stable_sort(resourceIndices.begin(),
+                     resourceIndices.end(),
+                     [this](const std::uint32_t a, const std::uint32_t b) {
+        return mResources[a].mSize > mResources[b].mSize;
+    });
+
+    std::vector<std::uint32_t> placedResourceIndices;
+    std::vector<std::uint32_t> overlappingResourceIndices;
+    for (const std::uint32_t resourceIndex : resourceIndices) {
+        Resource& resource = mResources[resourceIndex];
+
+        // Placed resources that are used in the same passes, sorted by offset
+        overlappingResourceIndices.clear();
+        for (const std::uint32_t placedResourceIndex : placedResourceIndices) {
+            const Resource& placedResource = mResources[placedResourceIndex];
+            if (placedResource.mFirstPassIndex <= resource.mLastPassIndex &&
+                resource.mFirstPassIndex <= placedResource.mLastPassIndex) {
+                overlappingResourceIndices.push_back(placedResourceIndex);
+            }
+        }
+
+        std::sort(overlappingResourceIndices.begin(),
+                  overlappingResourceIndices.end(),
+                  [this](const std::uint32_t a, const std::uint32_t b) {
+            return mResources[a].mOffset < mResources[b].mOffset;
+        });
+
+        // First aligned gap that fits
+        std::uint64_t offset = 0UL;
+        for (const std::uint32_t overlappingResourceIndex : overlappingResourceIndices) {
+            const Resource& overlappingResource = mResources[overlappingResourceIndex];
+            if (offset + resource.mSize <= overlappingResource.mOffset) {
+                break;
+            }
+
+            const std::uint64_t overlappingResourceEnd = overlappingResource.mOffset + overlappingResource.mSize;
+            if (overlappingResourceEnd > offset) {
+                offset = AlignUp(overlappingResourceEnd, resource.mAlignment);
+            }
+        }
+
+        resource.mOffset = offset;
+        mHeapSize = std::max(mHeapSize, offset + resource.mSize);
+        placedResourceIndices.push_back(resourceIndex);
+    }
+
+    mIsSolved = true;
+}
+
+std::uint64_t
+TransientResourcePlanner::GetOffset(const std::uint32_t resourceIndex) const noexcept
+{
+    BRE_ASSERT(mIsSolved);
+    BRE_ASSERT(resourceIndex < mResources.size());
+
+    return mResources[resourceIndex].mOffset;
+}
+
+bool
+TransientResourcePlanner::IsAliased(const std::uint32_t resourceIndex) const noexcept
+{
+    BRE_ASSERT(mIsSolved);
+    BRE_ASSERT(resourceIndex < mResources.size());
+
+    const Resource& resource = mResources[resourceIndex];
+    for (std::uint32_t i = 0U; i < mResources.size(); ++i) {
+        if (i == resourceIndex) {
+            continue;
+        }
+
+        const Resource& otherResource = mResources[i];
+        if (otherResource.mOffset < resource.mOffset + resource.mSize &&
+            resource.mOffset < otherResource.mOffset + otherResource.mSize) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::uint64_t
+TransientResourcePlanner::GetResourceSize() const noexcept
+{
+    std::uint64_t resourceSize = 0UL;
+    for (const Resource& resource : mResources) {
+        resourceSize += resource.mSize;
+    }
+
+    return resourceSize;
+}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace BRE {
+///
+/// @brief Assigns heap offsets to transient resources, so resources whose lifetimes
+/// do not overlap share memory.
+///
+/// The lifetime of a resource is the range of passes of a frame where it is used.
+/// Solve() places resources from the largest to the smallest, each one at the first
+/// aligned offset that does not overlap the memory of a placed resource with an
+/// overlapping lifetime.
+/// It works over byte offsets (not over a heap), so it does not depend on the device.
+/// It is not thread safe.
+///
+class TransientResourcePlanner {
+public:
+    TransientResourcePlanner() = default;
+    ~TransientResourcePlanner() = default;
+    TransientResourcePlanner(const TransientResourcePlanner&) = delete;
+    const TransientResourcePlanner& operator=(const TransientResourcePlanner&) = delete;
+    TransientResourcePlanner(TransientResourcePlanner&&) = delete;
+    TransientResourcePlanner& operator=(TransientResourcePlanner&&) = delete;
+
+    ///
+    /// @brief Add a resource
+    /// @param size Size in bytes of the resource. It must be greater than zero.
+    /// @param alignment Alignment of the resource offset. It must be a power of two.
+    /// @param firstPassIndex Index of the first pass that uses the resource
+    /// @param lastPassIndex Index of the last pass that uses the resource.
+    /// It must be greater or equal than @p firstPassIndex
+    /// @return The resource index
+    ///
+    std::uint32_t AddResource(const std::uint64_t size,
+                              const std::uint64_t alignment,
+                              const std::uint32_t firstPassIndex,
+                              const std::uint32_t lastPassIndex) noexcept;
+
+    ///
+    /// @brief Assigns the offsets of all the resources
+    ///
+    /// It must be called after all the resources are added.
+    ///
+    void Solve() noexcept;
+
+    ///
+    /// @brief Get the offset of a resource
+    ///
+    /// Solve() must be called first.
+    ///
+    /// @param resourceIndex Resource index
+    /// @return Offset in bytes of the resource in the heap
+    ///
+    std::uint64_t GetOffset(const std::uint32_t resourceIndex) const noexcept;
+
+    ///
+    /// @brief Checks if a resource shares memory with other resource
+    ///
+    /// Solve() must be called first. The first use of an aliased resource in a frame
+    /// needs an aliasing barrier.
+    ///
+    /// @param resourceIndex Resource index
+    /// @return True if the resource shares memory with other resource
+    ///
+    bool IsAliased(const std::uint32_t resourceIndex) const noexcept;
+
+    ///
+    /// @brief Get the size of the heap
+    ///
+    /// Solve() must be called first.
+    ///
+    /// @return The size in bytes of the heap that holds all the resources
+    ///
+    __forceinline std::uint64_t GetHeapSize() const noexcept
+    {
+        return mHeapSize;
+    }
+
+    ///
+    /// @brief Get the size of all the resources, without aliasing
+    /// @return The sum of the sizes in bytes of the resources
+    ///
+    std::uint64_t GetResourceSize() const noexcept;
+
+    ///
+    /// @brief Get the number of resources
+    /// @return The number of resources
+    ///
+    __forceinline std::uint32_t GetResourceCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(mResources.size());
+    }
+
+private:
+    struct Resource {
+        std::uint64_t mSize{ 0UL };
+        std::uint64_t mAlignment{ 0UL };
+        std::uint64_t mOffset{ 0UL };
+        std::uint32_t mFirstPassIndex{ 0U };
+        std::uint32_t mLastPassIndex{ 0U };
+    };
+
+    std::vector<Resource> mResources;
+    std::uint64_t mHeapSize{ 0UL };
+    bool mIsSolved{ false };
+};
+}
@@ -2,6 +2,7 @@
 
 #include <DXUtils\D3DFactory.h>
 #include <Utils/DebugUtils.h>
+#include <Utils\MemoryUtils.h>
 
 namespace BRE {
 UploadBuffer::UploadBuffer(ID3D12Device& device,
@@ -44,7 +45,24 @@ UploadBuffer::CopyData(const std::uint32_t elementIndex,
                        const std::size_t sourceDataSize) const noexcept
 {
     BRE_ASSERT(sourceData);
-    memcpy(mMappedData + elementIndex * mElementSize, sourceData, sourceDataSize);
+    MemoryUtils::CopyToWriteCombinedMemory(mMappedData + elementIndex * mElementSize, sourceData, sourceDataSize);
+}
+
+void
+UploadBuffer::CopyDataBatch(const std::uint32_t firstElementIndex,
+                            const void* sourceData,
+                            const std::size_t sourceStride,
+                            const std::size_t sourceDataSize,
+                            const std::uint32_t elementCount) const noexcept
+{
+    BRE_ASSERT(sourceData);
+    BRE_ASSERT(sourceDataSize > 0UL && sourceDataSize <= mElementSize);
+    MemoryUtils::CopyToWriteCombinedMemory(mMappedData + firstElementIndex * mElementSize,
+                                           mElementSize,
+                                           sourceData,
+                                           sourceStride,
+                                           sourceDataSize,
+                                           elementCount);
 }
 
 std::size_t
@@ -38,8 +38,24 @@ public:
         return *mBuffer;
     }
 
+    ///
+    /// @brief Get mapped data
+    ///
+    /// The buffer is mapped during its whole lifetime.
+    ///
+    /// @return Pointer to the first byte of the buffer
+    ///
+    __forceinline std::uint8_t* GetMappedData() const noexcept
+    {
+        BRE_ASSERT(mMappedData != nullptr);
+        return mMappedData;
+    }
+
     ///
     /// @brief Copy data
+    ///
+    /// Mapped data is write-combined memory, so it is copied with streaming stores.
+    ///
     /// @param elementIndex Element index to copy
     /// @param sourceData Source data to copy to the element in @p elementIndex. Must not be nullptr
     /// @param sourceDataSize Size of the source data. Must be greater than zero.
@@ -48,6 +64,24 @@ public:
                   const void* sourceData,
                   const std::size_t sourceDataSize) const noexcept;
 
+    ///
+    /// @brief Copy data to consecutive elements
+    ///
+    /// It is faster than calling CopyData() for each element.
+    ///
+    /// @param firstElementIndex Index of the first element to copy
+    /// @param sourceData Source data of the first element. Must not be nullptr
+    /// @param sourceStride Distance in bytes between consecutive elements in @p sourceData
+    /// @param sourceDataSize Size of the source data of each element. Must be greater than zero
+    /// and not greater than the element size.
+    /// @param elementCount Number of elements to copy
+    ///
+    void CopyDataBatch(const std::uint32_t firstElementIndex,
+                       const void* sourceData,
+                       const std::size_t sourceStride,
+                       const std::size_t sourceDataSize,
+                       const std::uint32_t elementCount) const noexcept;
+
     ///
     /// @brief Get rounded constant buffer size in bytes
     ///
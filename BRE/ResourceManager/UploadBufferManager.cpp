@@ -1,26 +1,26 @@
 #include "UploadBufferManager.h"
 
+#include <CommandManager\FenceTimeline.h>
 #include <DirectXManager/DirectXManager.h>
+#include <ResourceManager\MemoryBudget.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
-tbb::concurrent_unordered_set<UploadBuffer*> UploadBufferManager::mUploadBuffers;
+SlotMap<UploadBuffer> UploadBufferManager::mUploadBuffers;
 std::mutex UploadBufferManager::mMutex;
 
 void
 UploadBufferManager::Clear() noexcept
 {
-    for (UploadBuffer* uploadBuffer : mUploadBuffers) {
-        BRE_ASSERT(uploadBuffer != nullptr);
-        delete uploadBuffer;
-    }
-
-    mUploadBuffers.clear();
+    mUploadBuffers.Clear([](UploadBuffer& uploadBuffer) {
+        delete &uploadBuffer;
+    });
 }
 
 UploadBuffer&
 UploadBufferManager::CreateUploadBuffer(const std::size_t elementSize,
-                                        const std::uint32_t elementCount) noexcept
+                                        const std::uint32_t elementCount,
+                                        SlotMapHandle* uploadBufferHandle) noexcept
 {
     BRE_ASSERT(elementSize > 0UL);
     BRE_ASSERT(elementCount > 0U);
@@ -28,8 +28,40 @@ UploadBufferManager::CreateUploadBuffer(const std::size_t elementSize,
     UploadBuffer* uploadBuffer = new UploadBuffer(DirectXManager::GetDevice(),
                                                   elementSize,
                                                   elementCount);
-    mUploadBuffers.insert(uploadBuffer);
+    MemoryBudget::AddResourceAllocation(uploadBuffer->GetResource(),
+                                        MemoryBudget::Category::UPLOAD_BUFFERS,
+                                        MemoryBudget::MemoryPool::SYSTEM_MEMORY);
+
+    const SlotMapHandle handle = mUploadBuffers.Insert(*uploadBuffer);
+    if (uploadBufferHandle != nullptr) {
+        *uploadBufferHandle = handle;
+    }
 
     return *uploadBuffer;
 }
+
+UploadBuffer*
+UploadBufferManager::GetUploadBuffer(const SlotMapHandle uploadBufferHandle) noexcept
+{
+    return mUploadBuffers.Get(uploadBufferHandle);
+}
+
+void
+UploadBufferManager::RemoveUploadBuffer(const SlotMapHandle uploadBufferHandle) noexcept
+{
+    BRE_CHECK_MSG(mUploadBuffers.Remove(uploadBufferHandle) != nullptr, L"Upload buffer handle is not valid");
+}
+
+void
+UploadBufferManager::ReleaseRemovedUploadBuffers(FenceTimeline& fenceTimeline,
+                                                 const std::uint64_t fenceValue) noexcept
+{
+    const auto isComplete = [&fenceTimeline](const std::uint64_t value) {
+        return fenceTimeline.IsComplete(value);
+    };
+    mUploadBuffers.ReleaseRemovedItems(fenceValue, isComplete, [](UploadBuffer& uploadBuffer) {
+        MemoryBudget::RemoveAllocation(&uploadBuffer.GetResource());
+        delete &uploadBuffer;
+    });
+}
 }
\ No newline at end of file
@@ -2,11 +2,13 @@
 
 #include <d3d12.h>
 #include <mutex>
-#include <tbb/concurrent_unordered_set.h>
 
 #include <ResourceManager/UploadBuffer.h>
+#include <Utils\SlotMap.h>
 
 namespace BRE {
+class FenceTimeline;
+
 ///
 /// @brief Responsible to create upload buffers
 ///
@@ -28,13 +30,49 @@ public:
     /// @brief Creates upload buffer
     /// @param elementSize Size of the element in the upload buffer. Must be greater than zero
     /// @param elementCount Number of elements in the upload buffer. Must be greater than zero.
+    /// @param uploadBufferHandle If it is not nullptr, then it is filled with the handle of the upload buffer,
+    /// that can be used to remove it with RemoveUploadBuffer().
     /// @return Upload buffer
     ///
     static UploadBuffer& CreateUploadBuffer(const std::size_t elementSize,
-                                            const std::uint32_t elementCount) noexcept;
+                                            const std::uint32_t elementCount,
+                                            SlotMapHandle* uploadBufferHandle = nullptr) noexcept;
+
+    ///
+    /// @brief Get an upload buffer
+    ///
+    /// This method is thread safe and does not lock.
+    ///
+    /// @param uploadBufferHandle Upload buffer handle returned by CreateUploadBuffer()
+    /// @return The upload buffer, or nullptr if it was removed.
+    ///
+    static UploadBuffer* GetUploadBuffer(const SlotMapHandle uploadBufferHandle) noexcept;
+
+    ///
+    /// @brief Remove an upload buffer
+    ///
+    /// The upload buffer is not released immediately, because command lists in flight can still
+    /// use it. It is released once the GPU finishes the frame where it was removed
+    /// (see ReleaseRemovedUploadBuffers()). This method is thread safe.
+    ///
+    /// @param uploadBufferHandle Upload buffer handle returned by CreateUploadBuffer()
+    ///
+    static void RemoveUploadBuffer(const SlotMapHandle uploadBufferHandle) noexcept;
+
+    ///
+    /// @brief Release removed upload buffers at a frame boundary.
+    ///
+    /// Upload buffers removed since the last call are tagged with @p fenceValue, and
+    /// removed upload buffers whose fence value already completed are released.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void ReleaseRemovedUploadBuffers(FenceTimeline& fenceTimeline,
+                                            const std::uint64_t fenceValue) noexcept;
 
 private:
-    static tbb::concurrent_unordered_set<UploadBuffer*> mUploadBuffers;
+    static SlotMap<UploadBuffer> mUploadBuffers;
 
     static std::mutex mMutex;
 };
@@ -0,0 +1,38 @@
+#include "UploadRingAllocator.h"
+
+namespace BRE {
+UploadRingAllocator::UploadRingAllocator(const std::size_t sizePerFrame,
+                                         const std::uint32_t frameCount)
+    : mRing(0UL, sizePerFrame, frameCount)
+{}
+
+std::size_t
+UploadRingAllocator::Allocate(const std::size_t size,
+                              const std::size_t alignment) noexcept
+{
+    const std::size_t offset = mRing.Allocate(size, alignment);
+    if (offset == sInvalidOffset) {
+        mOverflowCount.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    return offset;
+}
+
+std::uint64_t
+UploadRingAllocator::EndFrame(const std::uint64_t fenceValue) noexcept
+{
+    return mRing.EndFrame(fenceValue);
+}
+
+UploadRingAllocator::Statistics
+UploadRingAllocator::GetStatistics() const noexcept
+{
+    Statistics statistics;
+    statistics.mSizePerFrame = mRing.GetSizePerFrame();
+    statistics.mAllocatedSize = mRing.GetAllocatedSize();
+    statistics.mMaxAllocatedSizePerFrame = mRing.GetMaxAllocatedSizePerFrame();
+    statistics.mOverflowCount = mOverflowCount.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <Utils\FramePartitionedRing.h>
+
+namespace BRE {
+///
+/// @brief Linear allocator of upload memory, partitioned by frame.
+///
+/// It is a FramePartitionedRing of bytes that also counts failed allocations. Each partition
+/// is reclaimed when the GPU finishes the frame that used it (see FramePartitionedRing).
+///
+class UploadRingAllocator {
+public:
+    ///
+    /// @brief Allocator statistics
+    ///
+    struct Statistics {
+        std::size_t mSizePerFrame{ 0UL };
+        std::size_t mAllocatedSize{ 0UL };
+        std::size_t mMaxAllocatedSizePerFrame{ 0UL };
+        std::uint32_t mOverflowCount{ 0U };
+    };
+
+    // Offset returned by Allocate() when the partition of the current frame is full.
+    static const std::size_t sInvalidOffset{ FramePartitionedRing<std::size_t>::sInvalidOffset };
+
+    ///
+    /// @brief UploadRingAllocator constructor
+    /// @param sizePerFrame The size in bytes of each partition
+    /// @param frameCount The number of partitions. It must be greater than zero.
+    ///
+    UploadRingAllocator(const std::size_t sizePerFrame,
+                        const std::uint32_t frameCount);
+
+    ~UploadRingAllocator() = default;
+    UploadRingAllocator(const UploadRingAllocator&) = delete;
+    const UploadRingAllocator& operator=(const UploadRingAllocator&) = delete;
+    UploadRingAllocator(UploadRingAllocator&&) = delete;
+    UploadRingAllocator& operator=(UploadRingAllocator&&) = delete;
+
+    ///
+    /// @brief Allocate bytes in the partition of the current frame.
+    ///
+    /// This method is thread safe and lock free. If the partition is full, the overflow
+    /// is counted in the statistics.
+    ///
+    /// @param size The number of bytes. It must be greater than zero.
+    /// @param alignment Alignment of the allocation relative to the beginning of its partition.
+    /// It must be a power of two.
+    /// @return The offset of the allocation in the ring, or sInvalidOffset if the partition is full.
+    ///
+    std::size_t Allocate(const std::size_t size,
+                         const std::size_t alignment) noexcept;
+
+    ///
+    /// @brief End the current frame and begin the next one.
+    ///
+    /// See FramePartitionedRing::EndFrame()
+    ///
+    /// @param fenceValue Fence value signaled at the end of the current frame
+    /// @return The fence value that must complete before allocating
+    /// in the new current partition. Zero if the partition was not used yet.
+    ///
+    std::uint64_t EndFrame(const std::uint64_t fenceValue) noexcept;
+
+    ///
+    /// @brief Get statistics
+    /// @return Statistics
+    ///
+    Statistics GetStatistics() const noexcept;
+
+private:
+    FramePartitionedRing<std::size_t> mRing;
+    std::atomic<std::uint32_t> mOverflowCount{ 0U };
+};
+}
@@ -26,6 +26,7 @@ VertexAndIndexBufferCreator::VertexBufferData::operator=(const VertexBufferData&
     }
 
     mBuffer = instance.mBuffer;
+    mBufferHandle = instance.mBufferHandle;
     mBufferView = instance.mBufferView;
     mElementCount = instance.mElementCount;
 
@@ -48,8 +49,7 @@ VertexAndIndexBufferCreator::VertexBufferData::IsDataValid() const noexcept
 void
 VertexAndIndexBufferCreator::CreateVertexBuffer(const BufferCreationData& bufferCreationData,
                                                 VertexBufferData& vertexBufferData,
-                                                ID3D12GraphicsCommandList& commandList,
-                                                ID3D12Resource* &uploadBuffer) noexcept
+                                                ID3D12GraphicsCommandList& commandList) noexcept
 {
     BRE_ASSERT(bufferCreationData.IsDataValid());
 
@@ -60,8 +60,9 @@ VertexAndIndexBufferCreator::CreateVertexBuffer(const BufferCreationData& buffer
     vertexBufferData.mBuffer = &ResourceManager::CreateDefaultBuffer(bufferCreationData.mData,
                                                                      bufferSize,
                                                                      commandList,
-                                                                     uploadBuffer,
-                                                                     nullptr);
+                                                                     nullptr,
+                                                                     MemoryBudget::Category::MODEL_BUFFERS,
+                                                                     &vertexBufferData.mBufferHandle);
     vertexBufferData.mElementCount = bufferCreationData.mElementCount;
 
     // Fill view
@@ -80,6 +81,7 @@ VertexAndIndexBufferCreator::IndexBufferData::operator=(const IndexBufferData& i
     }
 
     mBuffer = instance.mBuffer;
+    mBufferHandle = instance.mBufferHandle;
     mBufferView = instance.mBufferView;
     mElementCount = instance.mElementCount;
 
@@ -102,8 +104,7 @@ VertexAndIndexBufferCreator::IndexBufferData::IsDataValid() const noexcept
 void
 VertexAndIndexBufferCreator::CreateIndexBuffer(const BufferCreationData& bufferCreationData,
                                                IndexBufferData& indexBufferData,
-                                               ID3D12GraphicsCommandList& commandList,
-                                               ID3D12Resource* &uploadBuffer) noexcept
+                                               ID3D12GraphicsCommandList& commandList) noexcept
 {
     BRE_ASSERT(bufferCreationData.IsDataValid());
 
@@ -113,8 +114,9 @@ VertexAndIndexBufferCreator::CreateIndexBuffer(const BufferCreationData& bufferC
     indexBufferData.mBuffer = &ResourceManager::CreateDefaultBuffer(bufferCreationData.mData,
                                                                     bufferSize,
                                                                     commandList,
-                                                                    uploadBuffer,
-                                                                    nullptr);
+                                                                    nullptr,
+                                                                    MemoryBudget::Category::MODEL_BUFFERS,
+                                                                    &indexBufferData.mBufferHandle);
     indexBufferData.mElementCount = bufferCreationData.mElementCount;
 
     // Set index format
@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <d3d12.h>
 
+#include <Utils\SlotMap.h>
+
 namespace BRE {
 ///
 /// @brief Responsible to create vertex and index buffer
@@ -69,6 +71,7 @@ public:
         bool IsDataValid() const noexcept;
 
         ID3D12Resource* mBuffer{ nullptr };
+        SlotMapHandle mBufferHandle{ SlotMap<ID3D12Resource>::sInvalidHandle };
         D3D12_VERTEX_BUFFER_VIEW mBufferView{};
         std::uint32_t mElementCount{ 0U };
     };
@@ -93,6 +96,7 @@ public:
         bool IsDataValid() const noexcept;
 
         ID3D12Resource* mBuffer{ nullptr };
+        SlotMapHandle mBufferHandle{ SlotMap<ID3D12Resource>::sInvalidHandle };
         D3D12_INDEX_BUFFER_VIEW mBufferView{};
         std::uint32_t mElementCount{ 0U };
     };
@@ -104,15 +108,10 @@ public:
     /// @param commandList Command list used to upload buffer content to GPU.
     /// It must be executed after this function call to upload buffer content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadBuffer Upload buffer to upload the buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadBuffer after it knows the copy has been executed.
     ///
     static void CreateVertexBuffer(const BufferCreationData& bufferCreationData,
                                    VertexBufferData& vertexBufferData,
-                                   ID3D12GraphicsCommandList& commandList,
-                                   ID3D12Resource* &uploadBuffer) noexcept;
+                                   ID3D12GraphicsCommandList& commandList) noexcept;
 
     ///
     /// @brief Creates index buffer
@@ -121,15 +120,10 @@ public:
     /// @param commandList Command list used to upload buffer content to GPU.
     /// It must be executed after this function call to upload buffer content to GPU.
     /// It must be in recording state before calling this method.
-    /// @param uploadBuffer Upload buffer to upload the buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadBuffer after it knows the copy has been executed.
     ///
     static void CreateIndexBuffer(const BufferCreationData& bufferCreationData,
                                   IndexBufferData& indexBufferData,
-                                  ID3D12GraphicsCommandList& commandList,
-                                  ID3D12Resource* &uploadBuffer) noexcept;
+                                  ID3D12GraphicsCommandList& commandList) noexcept;
 };
 }
 
@@ -1,74 +1,43 @@
 #include "ResourceStateManager.h"
 
-#include <memory>
-
 #include <DXUtils\D3DFactory.h>
 #include <Utils\DebugUtils.h>
 
 namespace BRE {
-tbb::concurrent_hash_map<ID3D12Resource*, D3D12_RESOURCE_STATES> ResourceStateManager::mStateByResource;
-tbb::concurrent_hash_map<ID3D12Resource*, tbb::concurrent_vector<D3D12_RESOURCE_STATES>> ResourceStateManager::mStateByResourceIndexByResource;
+ResourceStateTable ResourceStateManager::mStateTable;
 
 void
 ResourceStateManager::AddFullResourceTracking(ID3D12Resource& resource,
                                               const D3D12_RESOURCE_STATES initialState) noexcept
 {
-    tbb::concurrent_hash_map<ID3D12Resource*, D3D12_RESOURCE_STATES>::accessor accessor;
-#ifdef _DEBUG
-    tbb::concurrent_hash_map<ID3D12Resource*, tbb::concurrent_vector<D3D12_RESOURCE_STATES>>::accessor subresourceAccessor;
-    mStateByResourceIndexByResource.find(subresourceAccessor, &resource);
-    BRE_ASSERT(subresourceAccessor.empty());
-
-    mStateByResource.find(accessor, &resource);
-    BRE_ASSERT(accessor.empty());
-#endif
-    mStateByResource.insert(accessor, &resource);
-    accessor->second = initialState;
-    accessor.release();
+    mStateTable.AddResource(&resource, initialState, 1U);
 }
 
 void 
 ResourceStateManager::AddSubresourceTracking(ID3D12Resource& resource,
                                              const D3D12_RESOURCE_STATES initialState) noexcept
 {
-    tbb::concurrent_hash_map<ID3D12Resource*, tbb::concurrent_vector<D3D12_RESOURCE_STATES>>::accessor accessor;
-#ifdef _DEBUG
-    tbb::concurrent_hash_map<ID3D12Resource*, D3D12_RESOURCE_STATES>::accessor fullResourceAccessor;
-    mStateByResource.find(fullResourceAccessor, &resource);
-    BRE_ASSERT(fullResourceAccessor.empty());
-
-    mStateByResourceIndexByResource.find(accessor, &resource);
-    BRE_ASSERT(accessor.empty());
-#endif
-
     // Get the number of subresources and initialize all the states for the resource to be added
     D3D12_RESOURCE_DESC resourceDesc = resource.GetDesc();
     const std::uint32_t numSubResources = resourceDesc.DepthOrArraySize * resourceDesc.MipLevels;
 
-    mStateByResourceIndexByResource.insert(accessor, &resource);
-    for (std::uint32_t i = 0U; i < numSubResources; ++i) {
-        accessor->second.push_back(initialState);
-    }
-    
-    accessor.release();
+    mStateTable.AddResource(&resource, initialState, numSubResources);
+}
+
+void
+ResourceStateManager::RemoveResourceTracking(ID3D12Resource& resource) noexcept
+{
+    mStateTable.RemoveResource(&resource);
 }
 
 D3D12_RESOURCE_BARRIER
 ResourceStateManager::ChangeResourceStateAndGetBarrier(ID3D12Resource& resource,
                                                        const D3D12_RESOURCE_STATES newState) noexcept
 {
-    tbb::concurrent_hash_map<ID3D12Resource*, D3D12_RESOURCE_STATES>::accessor accessor;
-    mStateByResource.find(accessor, &resource);
-    BRE_ASSERT(accessor.empty() == false);
-
-    const D3D12_RESOURCE_STATES oldState = accessor->second;
-    BRE_ASSERT(oldState != newState);
-    accessor->second = newState;
-    accessor.release();
-    
-    const D3D12_RESOURCE_BARRIER resourceBarrier = D3DFactory::GetTransitionResourceBarrier(resource,
-                                                                                            oldState,
-                                                                                            newState);
+    D3D12_RESOURCE_BARRIER resourceBarrier{};
+    const bool isChanged = TransitionResourceIfNeeded(resource, newState, resourceBarrier);
+    BRE_ASSERT(isChanged);
+    UNREFERENCED_PARAMETER(isChanged);
 
     return resourceBarrier;
 }
@@ -78,45 +47,63 @@ ResourceStateManager::ChangeSubresourceStateAndGetBarrier(ID3D12Resource& resour
                                                           const std::uint32_t subresourceIndex,
                                                           const D3D12_RESOURCE_STATES newState) noexcept
 {
-    tbb::concurrent_hash_map<ID3D12Resource*, tbb::concurrent_vector<D3D12_RESOURCE_STATES>>::accessor accessor;
-    mStateByResourceIndexByResource.find(accessor, &resource);
-    BRE_ASSERT(accessor.empty() == false);
-
-    tbb::concurrent_vector<D3D12_RESOURCE_STATES>& stateBySubresourceIndex = accessor->second;
-    BRE_ASSERT(subresourceIndex < static_cast<std::uint32_t>(stateBySubresourceIndex.size()));
-    const D3D12_RESOURCE_STATES oldState = stateBySubresourceIndex[subresourceIndex];
-    BRE_ASSERT(oldState != newState);
-    stateBySubresourceIndex[subresourceIndex] = newState;
-    accessor.release();
-
-    const D3D12_RESOURCE_BARRIER resourceBarrier = D3DFactory::GetTransitionResourceBarrier(resource,
-                                                                                            oldState,
-                                                                                            newState,
-                                                                                            subresourceIndex);
+    D3D12_RESOURCE_BARRIER resourceBarrier{};
+    const bool isChanged = TransitionSubresourceIfNeeded(resource, subresourceIndex, newState, resourceBarrier);
+    BRE_ASSERT(isChanged);
+    UNREFERENCED_PARAMETER(isChanged);
 
     return resourceBarrier;
 }
 
+bool
+ResourceStateManager::TransitionResourceIfNeeded(ID3D12Resource& resource,
+                                                 const D3D12_RESOURCE_STATES newState,
+                                                 D3D12_RESOURCE_BARRIER& barrier) noexcept
+{
+    BRE_ASSERT(mStateTable.GetStateCount(&resource) == 1U);
+
+    D3D12_RESOURCE_STATES oldState{ D3D12_RESOURCE_STATE_COMMON };
+    if (mStateTable.ChangeStateIfNeeded(&resource, 0U, newState, oldState) == false) {
+        return false;
+    }
+
+    barrier = D3DFactory::GetTransitionResourceBarrier(resource,
+                                                       oldState,
+                                                       newState);
+
+    return true;
+}
+
+bool
+ResourceStateManager::TransitionSubresourceIfNeeded(ID3D12Resource& resource,
+                                                    const std::uint32_t subresourceIndex,
+                                                    const D3D12_RESOURCE_STATES newState,
+                                                    D3D12_RESOURCE_BARRIER& barrier) noexcept
+{
+    D3D12_RESOURCE_STATES oldState{ D3D12_RESOURCE_STATE_COMMON };
+    if (mStateTable.ChangeStateIfNeeded(&resource, subresourceIndex, newState, oldState) == false) {
+        return false;
+    }
+
+    barrier = D3DFactory::GetTransitionResourceBarrier(resource,
+                                                       oldState,
+                                                       newState,
+                                                       subresourceIndex);
+
+    return true;
+}
+
 D3D12_RESOURCE_STATES
 ResourceStateManager::GetResourceState(ID3D12Resource& resource) noexcept
 {
-    tbb::concurrent_hash_map<ID3D12Resource*, D3D12_RESOURCE_STATES>::accessor accessor;
-    mStateByResource.find(accessor, &resource);
-    BRE_ASSERT(accessor.empty() == false);
-    return accessor->second;
+    BRE_ASSERT(mStateTable.GetStateCount(&resource) == 1U);
+    return mStateTable.GetState(&resource, 0U);
 }
 
 D3D12_RESOURCE_STATES
 ResourceStateManager::GetSubresourceState(ID3D12Resource& resource,
                                           const std::uint32_t subresourceIndex) noexcept
 {
-    tbb::concurrent_hash_map<ID3D12Resource*, tbb::concurrent_vector<D3D12_RESOURCE_STATES>>::accessor accessor;
-    mStateByResourceIndexByResource.find(accessor, &resource);
-    BRE_ASSERT(accessor.empty() == false);
-
-    tbb::concurrent_vector<D3D12_RESOURCE_STATES>& stateBySubresourceIndex = accessor->second;
-    BRE_ASSERT(subresourceIndex < static_cast<std::uint32_t>(stateBySubresourceIndex.size()));
-
-    return stateBySubresourceIndex[subresourceIndex];
+    return mStateTable.GetState(&resource, subresourceIndex);
+}
 }
-}
\ No newline at end of file
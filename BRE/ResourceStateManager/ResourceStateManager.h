@@ -1,8 +1,8 @@
 #pragma once
 
 #include <d3d12.h>
-#include <tbb/concurrent_hash_map.h>
-#include <tbb/concurrent_vector.h>
+
+#include <ResourceStateManager\ResourceStateTable.h>
 
 namespace BRE {
 ///
@@ -13,6 +13,9 @@ namespace BRE {
 /// - Resource state change
 /// - Resource unregistration
 ///
+/// States are stored in a ResourceStateTable, so they are read and changed
+/// with atomic operations instead of exclusive locks.
+///
 class ResourceStateManager {
 public:
     ResourceStateManager() = delete;
@@ -46,6 +49,15 @@ public:
     static void AddSubresourceTracking(ID3D12Resource& resource,
                                        const D3D12_RESOURCE_STATES initialState) noexcept;
 
+    ///
+    /// @brief Remove resource tracking
+    ///
+    /// It must be called before the resource is released, so its address can be registered again.
+    ///
+    /// @param resource Resource to remove. If it was not registered, then nothing happens.
+    ///
+    static void RemoveResourceTracking(ID3D12Resource& resource) noexcept;
+
     ///
     /// @brief Change resource state and get barrier
     ///
@@ -72,6 +84,37 @@ public:
                                                                       const std::uint32_t subresourceIndex,
                                                                       const D3D12_RESOURCE_STATES newState) noexcept;
 
+    ///
+    /// @brief Transition a resource to a new state, if it is not already in that state
+    ///
+    /// It is equivalent to compare GetResourceState() with @p newState and then call
+    /// ChangeResourceStateAndGetBarrier(), but with a single lookup. This method is thread safe.
+    ///
+    /// @param resource Resource. It must have been registered with AddFullResourceTracking.
+    /// @param newState New resource state
+    /// @param barrier Output transition resource barrier. It is only written if the state changes.
+    /// @return True if the state changed, so @p barrier must be recorded
+    ///
+    static bool TransitionResourceIfNeeded(ID3D12Resource& resource,
+                                           const D3D12_RESOURCE_STATES newState,
+                                           D3D12_RESOURCE_BARRIER& barrier) noexcept;
+
+    ///
+    /// @brief Transition a subresource to a new state, if it is not already in that state
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param resource Resource. It must have been registered with AddSubresourceTracking.
+    /// @param subresourceIndex Subresource index
+    /// @param newState New subresource state
+    /// @param barrier Output transition resource barrier. It is only written if the state changes.
+    /// @return True if the state changed, so @p barrier must be recorded
+    ///
+    static bool TransitionSubresourceIfNeeded(ID3D12Resource& resource,
+                                              const std::uint32_t subresourceIndex,
+                                              const D3D12_RESOURCE_STATES newState,
+                                              D3D12_RESOURCE_BARRIER& barrier) noexcept;
+
     ///
     /// @brief Get resource state
     /// @param resource Resource to get state. It must have been registered. 
@@ -89,7 +132,7 @@ public:
                                                      const std::uint32_t subresourceIndex) noexcept;
 
 private:
-    static tbb::concurrent_hash_map<ID3D12Resource*, D3D12_RESOURCE_STATES> mStateByResource;
-    static tbb::concurrent_hash_map<ID3D12Resource*, tbb::concurrent_vector<D3D12_RESOURCE_STATES>> mStateByResourceIndexByResource;
+    // Resources with full resource tracking have a single state
+    static ResourceStateTable mStateTable;
 };
 }
\ No newline at end of file
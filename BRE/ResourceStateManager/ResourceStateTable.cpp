@@ -0,0 +1,143 @@
+#include "ResourceStateTable.h"
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+void
+ResourceStateTable::AddResource(const void* resource,
+                                const D3D12_RESOURCE_STATES initialState,
+                                const std::uint32_t stateCount) noexcept
+{
+    BRE_ASSERT(resource != nullptr);
+    BRE_ASSERT(stateCount > 0U);
+    BRE_ASSERT(stateCount <= sChunkSlotCount);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    SlotRange slotRange;
+    slotRange.mFirstSlotIndex = AllocateSlots(stateCount);
+    slotRange.mSlotCount = stateCount;
+    for (std::uint32_t i = 0U; i < stateCount; ++i) {
+        const std::uint32_t slotIndex = slotRange.mFirstSlotIndex + i;
+        mChunks[slotIndex / sChunkSlotCount][slotIndex % sChunkSlotCount].store(initialState, std::memory_order_relaxed);
+    }
+
+    // The range is published after its slots are initialized
+    SlotRangeByResource::accessor accessor;
+    BRE_CHECK_MSG(mSlotRangeByResource.insert(accessor, resource), L"Resource state is already tracked");
+    accessor->second = slotRange;
+}
+
+bool
+ResourceStateTable::RemoveResource(const void* resource) noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    SlotRangeByResource::accessor accessor;
+    if (mSlotRangeByResource.find(accessor, resource) == false) {
+        return false;
+    }
+
+    const SlotRange slotRange = accessor->second;
+    mSlotRangeByResource.erase(accessor);
+    mFreeSlotIndicesBySlotCount[slotRange.mSlotCount].push_back(slotRange.mFirstSlotIndex);
+
+    return true;
+}
+
+void
+ResourceStateTable::Clear() noexcept
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // Chunks are kept, so they are reused by new resources
+    mSlotRangeByResource.clear();
+    mFreeSlotIndicesBySlotCount.clear();
+    mSlotCount = 0U;
+}
+
+std::uint32_t
+ResourceStateTable::GetStateCount(const void* resource) const noexcept
+{
+    SlotRangeByResource::const_accessor accessor;
+    if (mSlotRangeByResource.find(accessor, resource) == false) {
+        return 0U;
+    }
+
+    return accessor->second.mSlotCount;
+}
+
+D3D12_RESOURCE_STATES
+ResourceStateTable::GetState(const void* resource,
+                             const std::uint32_t stateIndex) const noexcept
+{
+    return GetSlot(resource, stateIndex).load(std::memory_order_acquire);
+}
+
+bool
+ResourceStateTable::ChangeStateIfNeeded(const void* resource,
+                                        const std::uint32_t stateIndex,
+                                        const D3D12_RESOURCE_STATES newState,
+                                        D3D12_RESOURCE_STATES& oldState) noexcept
+{
+    Slot& slot = GetSlot(resource, stateIndex);
+    if (slot.load(std::memory_order_acquire) == newState) {
+        return false;
+    }
+
+    // Other thread can change the state between the load and the exchange
+    const D3D12_RESOURCE_STATES previousState = slot.exchange(newState, std::memory_order_acq_rel);
+    if (previousState == newState) {
+        return false;
+    }
+
+    oldState = previousState;
+
+    return true;
+}
+
+ResourceStateTable::Slot&
+ResourceStateTable::GetSlot(const void* resource,
+                            const std::uint32_t stateIndex) const noexcept
+{
+    SlotRangeByResource::const_accessor accessor;
+    mSlotRangeByResource.find(accessor, resource);
+    BRE_ASSERT(accessor.empty() == false);
+    BRE_ASSERT(stateIndex < accessor->second.mSlotCount);
+
+    const std::uint32_t slotIndex = accessor->second.mFirstSlotIndex + stateIndex;
+    accessor.release();
+
+    return mChunks[slotIndex / sChunkSlotCount][slotIndex % sChunkSlotCount];
+}
+
+std::uint32_t
+ResourceStateTable::AllocateSlots(const std::uint32_t slotCount) noexcept
+{
+    const auto freeSlotIndicesIt = mFreeSlotIndicesBySlotCount.find(slotCount);
+    if (freeSlotIndicesIt != mFreeSlotIndicesBySlotCount.end() && freeSlotIndicesIt->second.empty() == false) {
+        const std::uint32_t firstSlotIndex = freeSlotIndicesIt->second.back();
+        freeSlotIndicesIt->second.pop_back();
+        return firstSlotIndex;
+    }
+
+    // Ranges do not cross chunk boundaries, so the rest of the chunk is
+    // kept as a free range.
+    const std::uint32_t chunkFreeSlotCount = sChunkSlotCount - mSlotCount % sChunkSlotCount;
+    if (slotCount > chunkFreeSlotCount) {
+        mFreeSlotIndicesBySlotCount[chunkFreeSlotCount].push_back(mSlotCount);
+        mSlotCount += chunkFreeSlotCount;
+    }
+
+    const std::uint32_t chunkIndex = mSlotCount / sChunkSlotCount;
+    BRE_CHECK_MSG(chunkIndex < sMaxChunkCount, L"Resource state table is full");
+    if (mChunks[chunkIndex] == nullptr) {
+        mChunks[chunkIndex].reset(new Slot[sChunkSlotCount]);
+    }
+
+    const std::uint32_t firstSlotIndex = mSlotCount;
+    mSlotCount += slotCount;
+
+    return firstSlotIndex;
+}
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <d3d12.h>
+#include <memory>
+#include <mutex>
+#include <tbb/concurrent_hash_map.h>
+#include <unordered_map>
+#include <vector>
+
+namespace BRE {
+///
+/// @brief Table of resource states, with lock free reads and transitions
+///
+/// Each resource owns a contiguous range of slots in a slot array, one per tracked
+/// state (one for full resource tracking, or one per subresource). The slot index of
+/// a resource is found with a const_accessor (a shared lock of the bucket), and then
+/// states are read and changed with atomic operations, so threads that record
+/// command lists in parallel do not serialize.
+///
+/// Slots are stored in fixed size chunks that are never moved. A range never crosses
+/// a chunk boundary. Resources are identified by their addresses, that are not dereferenced.
+///
+/// AddResource() and RemoveResource() are thread safe, but a resource must not be removed
+/// while other threads read or change its states.
+///
+class ResourceStateTable {
+public:
+    ResourceStateTable() = default;
+    ~ResourceStateTable() = default;
+    ResourceStateTable(const ResourceStateTable&) = delete;
+    const ResourceStateTable& operator=(const ResourceStateTable&) = delete;
+    ResourceStateTable(ResourceStateTable&&) = delete;
+    ResourceStateTable& operator=(ResourceStateTable&&) = delete;
+
+    ///
+    /// @brief Add a resource
+    /// @param resource Resource. It must not have been added.
+    /// @param initialState Initial state of all the states of the resource
+    /// @param stateCount Number of states. It must be greater than zero, and
+    /// not greater than the number of slots of a chunk.
+    ///
+    void AddResource(const void* resource,
+                     const D3D12_RESOURCE_STATES initialState,
+                     const std::uint32_t stateCount) noexcept;
+
+    ///
+    /// @brief Remove a resource
+    /// @param resource Resource
+    /// @return True if @p resource was added. Otherwise, false, and nothing is done.
+    ///
+    bool RemoveResource(const void* resource) noexcept;
+
+    ///
+    /// @brief Remove all the resources
+    ///
+    /// This method must not be called while other threads use the table.
+    ///
+    void Clear() noexcept;
+
+    ///
+    /// @brief Get the number of states of a resource
+    /// @param resource Resource
+    /// @return The number of states, or zero if @p resource was not added.
+    ///
+    std::uint32_t GetStateCount(const void* resource) const noexcept;
+
+    ///
+    /// @brief Get a state
+    /// @param resource Resource. It must have been added.
+    /// @param stateIndex State index. It must be less than the number of states of @p resource
+    /// @return The state
+    ///
+    D3D12_RESOURCE_STATES GetState(const void* resource,
+                                   const std::uint32_t stateIndex) const noexcept;
+
+    ///
+    /// @brief Change a state, if it is not already the new state
+    ///
+    /// The state is only written if it changes, so resources that are already in the
+    /// new state do not invalidate the cache lines of other threads.
+    ///
+    /// @param resource Resource. It must have been added.
+    /// @param stateIndex State index. It must be less than the number of states of @p resource
+    /// @param newState New state
+    /// @param oldState Output state before the change. It is only written if the state changes.
+    /// @return True if the state changed
+    ///
+    bool ChangeStateIfNeeded(const void* resource,
+                             const std::uint32_t stateIndex,
+                             const D3D12_RESOURCE_STATES newState,
+                             D3D12_RESOURCE_STATES& oldState) noexcept;
+
+private:
+    static const std::uint32_t sChunkSlotCount{ 4096U };
+    static const std::uint32_t sMaxChunkCount{ 256U };
+
+    using Slot = std::atomic<D3D12_RESOURCE_STATES>;
+
+    struct SlotRange {
+        std::uint32_t mFirstSlotIndex{ 0U };
+        std::uint32_t mSlotCount{ 0U };
+    };
+
+    using SlotRangeByResource = tbb::concurrent_hash_map<const void*, SlotRange>;
+
+    ///
+    /// @brief Get a slot of a resource
+    /// @param resource Resource. It must have been added.
+    /// @param stateIndex State index
+    /// @return The slot
+    ///
+    Slot& GetSlot(const void* resource,
+                  const std::uint32_t stateIndex) const noexcept;
+
+    ///
+    /// @brief Allocate a range of slots. The mutex must be locked.
+    /// @param slotCount Number of slots
+    /// @return The index of the first slot
+    ///
+    std::uint32_t AllocateSlots(const std::uint32_t slotCount) noexcept;
+
+    SlotRangeByResource mSlotRangeByResource;
+
+    // Chunks are only created while the mutex is locked, before the ranges that use
+    // them are published in mSlotRangeByResource.
+    std::unique_ptr<Slot[]> mChunks[sMaxChunkCount];
+    std::uint32_t mSlotCount{ 0U };
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> mFreeSlotIndicesBySlotCount;
+
+    std::mutex mMutex;
+};
+}
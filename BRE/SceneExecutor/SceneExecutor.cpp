@@ -1,6 +1,7 @@
 #include "SceneExecutor.h"
 
 #include <CommandListExecutor\CommandListExecutor.h>
+#include <DescriptorManager\CbvSrvUavDescriptorManager.h>
 #include <Input/Keyboard.h>
 #include <Input/Mouse.h>
 #include <RenderManager/RenderManager.h>
@@ -12,7 +13,20 @@ using namespace DirectX;
 
 namespace BRE {
 namespace {
-const std::uint32_t MAX_NUM_CMD_LISTS{ 3U };
+///
+/// @brief Get the batching policy of the CommandListExecutor
+/// @return Batching policy
+///
+CommandListExecutor::BatchingPolicy
+GetCommandListExecutorBatchingPolicy() noexcept
+{
+    CommandListExecutor::BatchingPolicy batchingPolicy;
+    batchingPolicy.mMaxBatchSize = 3U;
+    batchingPolicy.mMaxWaitTimeInMicroseconds = 0U;
+    batchingPolicy.mFlushOnFrameEnd = false;
+
+    return batchingPolicy;
+}
 
 void UpdateKeyboardAndMouse() noexcept
 {
@@ -60,12 +74,16 @@ SceneExecutor::SceneExecutor(const char* sceneFilePath)
 {
     BRE_ASSERT(sceneFilePath != nullptr);
 
-    CommandListExecutor::Create(MAX_NUM_CMD_LISTS);
+    CommandListExecutor::Create(GetCommandListExecutorBatchingPolicy());
 
     SceneLoader sceneLoader;
     mScene = sceneLoader.LoadScene(sceneFilePath);
     BRE_ASSERT(mScene != nullptr);
 
     mRenderManager = &RenderManager::Create(*mScene);
+
+    // Scene loading and passes initialization are done, so the unused descriptors
+    // reserved by the loading threads can be used by other threads.
+    CbvSrvUavDescriptorManager::ReturnUnusedDescriptors();
 }
 }
\ No newline at end of file
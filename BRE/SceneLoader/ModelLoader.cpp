@@ -10,6 +10,7 @@
 #include <CommandListExecutor\CommandListExecutor.h>
 #include <ModelManager\Model.h>
 #include <ModelManager\ModelManager.h>
+#include <ResourceManager\StagingBufferManager.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
@@ -29,19 +30,24 @@ ModelLoader::LoadModels(const YAML::Node& rootNode,
     BRE_CHECK_MSG(modelsNode.IsDefined(), L"'models' node not found");
     BRE_CHECK_MSG(modelsNode.IsMap(), L"'models' node must be a map");
 
-    std::vector<ID3D12Resource*> uploadVertexBuffers;
-    std::vector<ID3D12Resource*> uploadIndexBuffers;
     BRE_CHECK_HR(commandList.Reset(&commandAllocator, nullptr));
 
-    LoadModels(modelsNode,
-               commandAllocator,
-               commandList,
-               uploadVertexBuffers,
-               uploadIndexBuffers);
+    LoadModelsFromNode(modelsNode,
+                       commandAllocator,
+                       commandList);
 
     commandList.Close();
-
-    CommandListExecutor::Get().ExecuteCommandListAndWaitForCompletion(commandList);
+    // Copies run in the COPY queue, and the first frame waits for them in the GPU.
+    ID3D12CommandList* commandLists[1U]{ &commandList };
+    const SubmissionFence submissionFence = CommandListExecutor::Get().ExecuteCommandLists(CommandQueueType::COPY,
+                                                                                           _countof(commandLists),
+                                                                                           commandLists,
+                                                                                           nullptr,
+                                                                                           0U);
+    CommandListExecutor::Get().AddPushedCommandListDependency(submissionFence);
+
+    // Upload buffers are released when the copies complete
+    StagingBufferManager::SetSubmissionFence(commandList, submissionFence);
 }
 
 const Model& ModelLoader::GetModel(const std::string& name) const noexcept
@@ -56,11 +62,9 @@ const Model& ModelLoader::GetModel(const std::string& name) const noexcept
 }
 
 void
-ModelLoader::LoadModels(const YAML::Node& modelsNode,
-                        ID3D12CommandAllocator& commandAllocator,
-                        ID3D12GraphicsCommandList& commandList,
-                        std::vector<ID3D12Resource*>& uploadVertexBuffers,
-                        std::vector<ID3D12Resource*>& uploadIndexBuffers) noexcept
+ModelLoader::LoadModelsFromNode(const YAML::Node& modelsNode,
+                                ID3D12CommandAllocator& commandAllocator,
+                                ID3D12GraphicsCommandList& commandList) noexcept
 {
     BRE_CHECK_MSG(modelsNode.IsMap(), L"'models' node must be a map");
 
@@ -77,23 +81,16 @@ ModelLoader::LoadModels(const YAML::Node& modelsNode,
                 L"Failed to open yaml file: " + StringUtils::AnsiToWideString(path);
             BRE_CHECK_MSG(referenceRootNode.IsDefined(), errorMsg.c_str());
             const YAML::Node referenceModelsNode = referenceRootNode["models"];
-            LoadModels(referenceModelsNode,
-                       commandAllocator,
-                       commandList,
-                       uploadVertexBuffers,
-                       uploadIndexBuffers);
+            LoadModelsFromNode(referenceModelsNode,
+                               commandAllocator,
+                               commandList);
         } else {
             const std::wstring errorMsg =
                 L"Model name must be unique: " + StringUtils::AnsiToWideString(name);
             BRE_CHECK_MSG(mModelByName.find(name) == mModelByName.end(), errorMsg.c_str());
 
-            uploadVertexBuffers.resize(uploadVertexBuffers.size() + 1);
-            uploadIndexBuffers.resize(uploadIndexBuffers.size() + 1);
-
             Model& model = ModelManager::LoadModel(path.c_str(),
-                                                   commandList,
-                                                   uploadVertexBuffers.back(),
-                                                   uploadIndexBuffers.back());
+                                                   commandList);
 
             mModelByName[name] = &model;
         }
@@ -30,7 +30,8 @@ public:
     /// @brief Load models
     /// @param rootNode Scene YAML file root node
     /// @param commandAllocator Command allocator for the command list to load models
-    /// @param commandList Command list to load models
+    /// @param commandList Command list to load models. It must be a COPY command list.
+    /// It is executed in the COPY queue, and the next pushed command lists wait for it.
     ///
     void LoadModels(const YAML::Node& rootNode,
                     ID3D12CommandAllocator& commandAllocator,
@@ -49,20 +50,10 @@ private:
     /// @param modelsNode YAML Node representing the "models" field. It must be a map.
     /// @param commandAllocator Command allocator for the command list to load textures
     /// @param commandList Command list to load the textures
-    /// @param uploadVertexBuffer Upload buffer to upload the buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadVertexBuffer after it knows the copy has been executed.
-    /// @param uploadIndexBuffers Upload buffer to upload the buffer content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadIndexBuffers after it knows the copy has been executed.
     ///
-    void LoadModels(const YAML::Node& modelsNode,
-                    ID3D12CommandAllocator& commandAllocator,
-                    ID3D12GraphicsCommandList& commandList,
-                    std::vector<ID3D12Resource*>& uploadVertexBuffers,
-                    std::vector<ID3D12Resource*>& uploadIndexBuffers) noexcept;
+    void LoadModelsFromNode(const YAML::Node& modelsNode,
+                            ID3D12CommandAllocator& commandAllocator,
+                            ID3D12GraphicsCommandList& commandList) noexcept;
 
     std::unordered_map<std::string, Model*> mModelByName;
 };
@@ -27,8 +27,11 @@ SceneLoader::SceneLoader()
     , mEnvironmentLoader(mTextureLoader)
 {
 
-    mCommandAllocator = &CommandAllocatorManager::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
-    mCommandList = &CommandListManager::CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, *mCommandAllocator);
+    // Models and textures are uploaded in the COPY queue. Each of them has its own
+    // command allocator, because the models are not waited before the textures are recorded.
+    mModelCommandAllocator = &CommandAllocatorManager::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY);
+    mTextureCommandAllocator = &CommandAllocatorManager::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY);
+    mCommandList = &CommandListManager::CreateCommandList(D3D12_COMMAND_LIST_TYPE_COPY, *mModelCommandAllocator);
     mCommandList->Close();
 };
 
@@ -42,8 +45,8 @@ SceneLoader::LoadScene(const char* sceneFilePath) noexcept
         L"Failed to open yaml file: " + StringUtils::AnsiToWideString(sceneFilePath);
     BRE_CHECK_MSG(rootNode.IsDefined(), errorMsg.c_str());
 
-    mModelLoader.LoadModels(rootNode, *mCommandAllocator, *mCommandList);
-    mTextureLoader.LoadTextures(rootNode, *mCommandAllocator, *mCommandList);
+    mModelLoader.LoadModels(rootNode, *mModelCommandAllocator, *mCommandList);
+    mTextureLoader.LoadTextures(rootNode, *mTextureCommandAllocator, *mCommandList);
     mMaterialTechniqueLoader.LoadMaterialTechniques(rootNode);
     mDrawableObjectLoader.LoadDrawableObjects(rootNode);
     mEnvironmentLoader.LoadEnvironment(rootNode);
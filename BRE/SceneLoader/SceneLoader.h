@@ -55,7 +55,8 @@ private:
     ///
     void GenerateGeometryPassRecordersForHeightMapping(GeometryCommandListRecorders& commandListRecorders) noexcept;
 
-    ID3D12CommandAllocator* mCommandAllocator{ nullptr };
+    ID3D12CommandAllocator* mModelCommandAllocator{ nullptr };
+    ID3D12CommandAllocator* mTextureCommandAllocator{ nullptr };
     ID3D12GraphicsCommandList* mCommandList{ nullptr };
     ModelLoader mModelLoader;
     TextureLoader mTextureLoader;
@@ -9,6 +9,7 @@
 
 #include <CommandListExecutor\CommandListExecutor.h>
 #include <ResourceManager\ResourceManager.h>
+#include <ResourceManager\StagingBufferManager.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
@@ -33,16 +34,24 @@ TextureLoader::LoadTextures(const YAML::Node& rootNode,
 
     BRE_CHECK_MSG(texturesNode.IsMap(), L"'textures' node must be a map");
 
-    std::vector<ID3D12Resource*> uploadBuffers;
     BRE_CHECK_HR(commandList.Reset(&commandAllocator, nullptr));
     
-    LoadTextures(texturesNode,
-                 commandAllocator,
-                 commandList,
-                 uploadBuffers);
+    LoadTexturesFromNode(texturesNode,
+                         commandAllocator,
+                         commandList);
 
     commandList.Close();
-    CommandListExecutor::Get().ExecuteCommandListAndWaitForCompletion(commandList);    
+    // Copies run in the COPY queue, and the first frame waits for them in the GPU.
+    ID3D12CommandList* commandLists[1U]{ &commandList };
+    const SubmissionFence submissionFence = CommandListExecutor::Get().ExecuteCommandLists(CommandQueueType::COPY,
+                                                                                           _countof(commandLists),
+                                                                                           commandLists,
+                                                                                           nullptr,
+                                                                                           0U);
+    CommandListExecutor::Get().AddPushedCommandListDependency(submissionFence);
+
+    // Upload buffers are released when the copies complete
+    StagingBufferManager::SetSubmissionFence(commandList, submissionFence);
 }
 
 ID3D12Resource&
@@ -58,10 +67,9 @@ TextureLoader::GetTexture(const std::string& name) noexcept
 }
 
 void
-TextureLoader::LoadTextures(const YAML::Node& texturesNode,
-                            ID3D12CommandAllocator& commandAllocator,
-                            ID3D12GraphicsCommandList& commandList,
-                            std::vector<ID3D12Resource*>& uploadBuffers) noexcept
+TextureLoader::LoadTexturesFromNode(const YAML::Node& texturesNode,
+                                    ID3D12CommandAllocator& commandAllocator,
+                                    ID3D12GraphicsCommandList& commandList) noexcept
 {
     BRE_CHECK_MSG(texturesNode.IsMap(), L"'textures' node must be a map");
 
@@ -80,20 +88,16 @@ TextureLoader::LoadTextures(const YAML::Node& texturesNode,
             BRE_CHECK_MSG(referenceRootNode["textures"].IsDefined(),
                            L"Reference file must have 'textures' field");
             const YAML::Node referenceTexturesNode = referenceRootNode["textures"];
-            LoadTextures(referenceTexturesNode,
-                         commandAllocator,
-                         commandList,
-                         uploadBuffers);
+            LoadTexturesFromNode(referenceTexturesNode,
+                                 commandAllocator,
+                                 commandList);
         } else {
             const std::wstring errorMsg =
                 L"Texture name must be unique: " + StringUtils::AnsiToWideString(name);
             BRE_CHECK_MSG(mTextureByName.find(name) == mTextureByName.end(), errorMsg.c_str());
 
-            uploadBuffers.resize(uploadBuffers.size() + 1);
-
             ID3D12Resource& texture = ResourceManager::LoadTextureFromFile(path.c_str(),
                                                                            commandList,
-                                                                           uploadBuffers.back(),
                                                                            nullptr);
 
             mTextureByName[name] = &texture;
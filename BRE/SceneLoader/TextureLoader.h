@@ -28,7 +28,8 @@ public:
     /// @brief Load textures
     /// @param rootNode Scene YAML file root node
     /// @param commandAllocator Command allocator for the command list to load textures
-    /// @param commandList Command list to load the textures
+    /// @param commandList Command list to load the textures. It must be a COPY command list.
+    /// It is executed in the COPY queue, and the next pushed command lists wait for it.
     ///
     void LoadTextures(const YAML::Node& rootNode,
                       ID3D12CommandAllocator& commandAllocator,
@@ -47,15 +48,10 @@ private:
     /// @param texturesNode YAML Node representing the "textures" field. It must be a map.
     /// @param commandAllocator Command allocator for the command list to load textures
     /// @param commandList Command list to load the textures
-    /// @param uploadBuffer Upload buffer to upload the texture content.
-    /// It has to be kept alive after the function call because
-    /// the command list has not been executed yet that performs the actual copy.
-    /// The caller can Release the uploadBuffer after it knows the copy has been executed.
     ///
-    void LoadTextures(const YAML::Node& texturesNode,
-                      ID3D12CommandAllocator& commandAllocator,
-                      ID3D12GraphicsCommandList& commandList,
-                      std::vector<ID3D12Resource*>& uploadBuffers) noexcept;
+    void LoadTexturesFromNode(const YAML::Node& texturesNode,
+                              ID3D12CommandAllocator& commandAllocator,
+                              ID3D12GraphicsCommandList& commandList) noexcept;
 
 
     std::unordered_map<std::string, ID3D12Resource*> mTextureByName;
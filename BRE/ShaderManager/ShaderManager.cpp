@@ -4,6 +4,8 @@
 #include <D3Dcompiler.h>
 #include <fstream>
 
+#include <CommandManager\FenceTimeline.h>
+#include <ResourceManager\MemoryBudget.h>
 #include <Utils/DebugUtils.h>
 
 namespace BRE {
@@ -29,26 +31,29 @@ LoadBlob(const std::string& filename) noexcept
     fileStream.read(reinterpret_cast<char*>(blob->GetBufferPointer()), size);
     fileStream.close();
 
+    MemoryBudget::AddAllocation(blob,
+                                MemoryBudget::Category::SHADERS,
+                                MemoryBudget::MemoryPool::SYSTEM_MEMORY,
+                                blob->GetBufferSize());
+
     return blob;
 }
 }
 
-tbb::concurrent_unordered_set<ID3DBlob*> ShaderManager::mShaderBlobs;
+SlotMap<ID3DBlob> ShaderManager::mShaderBlobs;
 std::mutex ShaderManager::mMutex;
 
 void
 ShaderManager::Clear() noexcept
 {
-    for (ID3DBlob* blob : mShaderBlobs) {
-        BRE_ASSERT(blob != nullptr);
-        blob->Release();
-    }
-
-    mShaderBlobs.clear();
+    mShaderBlobs.Clear([](ID3DBlob& blob) {
+        blob.Release();
+    });
 }
 
 ID3DBlob&
-ShaderManager::LoadShaderFileAndGetBlob(const char* filename) noexcept
+ShaderManager::LoadShaderFileAndGetBlob(const char* filename,
+                                        SlotMapHandle* shaderHandle) noexcept
 {
     BRE_ASSERT(filename != nullptr);
 
@@ -59,13 +64,17 @@ ShaderManager::LoadShaderFileAndGetBlob(const char* filename) noexcept
     mMutex.unlock();
 
     BRE_ASSERT(blob != nullptr);
-    mShaderBlobs.insert(blob);
+    const SlotMapHandle handle = mShaderBlobs.Insert(*blob);
+    if (shaderHandle != nullptr) {
+        *shaderHandle = handle;
+    }
 
     return *blob;
 }
 
 D3D12_SHADER_BYTECODE
-ShaderManager::LoadShaderFileAndGetBytecode(const char* filename) noexcept
+ShaderManager::LoadShaderFileAndGetBytecode(const char* filename,
+                                            SlotMapHandle* shaderHandle) noexcept
 {
     BRE_ASSERT(filename != nullptr);
 
@@ -76,7 +85,10 @@ ShaderManager::LoadShaderFileAndGetBytecode(const char* filename) noexcept
     mMutex.unlock();
 
     BRE_ASSERT(blob != nullptr);
-    mShaderBlobs.insert(blob);
+    const SlotMapHandle handle = mShaderBlobs.Insert(*blob);
+    if (shaderHandle != nullptr) {
+        *shaderHandle = handle;
+    }
 
     D3D12_SHADER_BYTECODE shaderByteCode
     {
@@ -86,4 +98,29 @@ ShaderManager::LoadShaderFileAndGetBytecode(const char* filename) noexcept
 
     return shaderByteCode;
 }
+
+ID3DBlob*
+ShaderManager::GetShaderBlob(const SlotMapHandle shaderHandle) noexcept
+{
+    return mShaderBlobs.Get(shaderHandle);
+}
+
+void
+ShaderManager::RemoveShaderBlob(const SlotMapHandle shaderHandle) noexcept
+{
+    BRE_CHECK_MSG(mShaderBlobs.Remove(shaderHandle) != nullptr, L"Shader handle is not valid");
+}
+
+void
+ShaderManager::ReleaseRemovedShaderBlobs(FenceTimeline& fenceTimeline,
+                                         const std::uint64_t fenceValue) noexcept
+{
+    const auto isComplete = [&fenceTimeline](const std::uint64_t value) {
+        return fenceTimeline.IsComplete(value);
+    };
+    mShaderBlobs.ReleaseRemovedItems(fenceValue, isComplete, [](ID3DBlob& blob) {
+        MemoryBudget::RemoveAllocation(&blob);
+        blob.Release();
+    });
+}
 }
\ No newline at end of file
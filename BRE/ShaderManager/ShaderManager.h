@@ -3,9 +3,12 @@
 #include <d3d12.h>
 #include <D3Dcommon.h>
 #include <mutex>
-#include <tbb\concurrent_unordered_set.h>
+
+#include <Utils\SlotMap.h>
 
 namespace BRE {
+class FenceTimeline;
+
 ///
 /// @brief Responsible to load and handle shaders
 ///
@@ -26,19 +29,58 @@ public:
     ///
     /// @brief Load shader file and get blob
     /// @param filename Filename. Must not be nullptr
+    /// @param shaderHandle If it is not nullptr, then it is filled with the handle of the shader blob,
+    /// that can be used to remove it with RemoveShaderBlob().
     /// @return Loaded blob
     ///
-    static ID3DBlob& LoadShaderFileAndGetBlob(const char* filename) noexcept;
+    static ID3DBlob& LoadShaderFileAndGetBlob(const char* filename,
+                                              SlotMapHandle* shaderHandle = nullptr) noexcept;
 
     ///
     /// @brief Load shader file and get byte code
     /// @param filename Filename. Must not be nullptr
+    /// @param shaderHandle If it is not nullptr, then it is filled with the handle of the shader blob,
+    /// that can be used to remove it with RemoveShaderBlob().
     /// @return Loaded byte code
     ///
-    static D3D12_SHADER_BYTECODE LoadShaderFileAndGetBytecode(const char* filename) noexcept;
+    static D3D12_SHADER_BYTECODE LoadShaderFileAndGetBytecode(const char* filename,
+                                                              SlotMapHandle* shaderHandle = nullptr) noexcept;
+
+    ///
+    /// @brief Get a shader blob
+    ///
+    /// This method is thread safe and does not lock.
+    ///
+    /// @param shaderHandle Shader handle returned by a load method
+    /// @return The shader blob, or nullptr if it was removed.
+    ///
+    static ID3DBlob* GetShaderBlob(const SlotMapHandle shaderHandle) noexcept;
+
+    ///
+    /// @brief Remove a shader blob
+    ///
+    /// The blob is not released immediately, because its byte code can still be in use.
+    /// It is released once the GPU finishes the frame where it was removed
+    /// (see ReleaseRemovedShaderBlobs()). This method is thread safe.
+    ///
+    /// @param shaderHandle Shader handle returned by a load method
+    ///
+    static void RemoveShaderBlob(const SlotMapHandle shaderHandle) noexcept;
+
+    ///
+    /// @brief Release removed shader blobs at a frame boundary.
+    ///
+    /// Shader blobs removed since the last call are tagged with @p fenceValue, and
+    /// removed shader blobs whose fence value already completed are released.
+    ///
+    /// @param fenceTimeline Fence timeline of the queue that executes the frames
+    /// @param fenceValue Fence value signaled at the end of the frame
+    ///
+    static void ReleaseRemovedShaderBlobs(FenceTimeline& fenceTimeline,
+                                          const std::uint64_t fenceValue) noexcept;
 
 private:
-    static tbb::concurrent_unordered_set<ID3DBlob*> mShaderBlobs;
+    static SlotMap<ID3DBlob> mShaderBlobs;
 
     static std::mutex mMutex;
 };
@@ -16,7 +16,7 @@ using namespace DirectX;
 
 namespace BRE {
 // Root Signature:
-// "DescriptorTable(CBV(b0), visibility = SHADER_VISIBILITY_VERTEX), " \ 0 -> Object CBuffers
+// "CBV(b0, visibility = SHADER_VISIBILITY_VERTEX), " \ 0 -> Object CBuffer
 // "CBV(b1, visibility = SHADER_VISIBILITY_VERTEX), " \ 1 > Frame CBuffer
 // "DescriptorTable(SRV(t0), visibility = SHADER_VISIBILITY_PIXEL), " \ 2 -> Cube Map texture
 
@@ -84,16 +84,13 @@ SkyBoxCommandListRecorder::Init(const VertexAndIndexBufferCreator::VertexBufferD
 }
 
 std::uint32_t
-SkyBoxCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept
+SkyBoxCommandListRecorder::RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                                     const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
     BRE_ASSERT(sRootSignature != nullptr);
 
-    // Update frame constants
-    UploadBuffer& uploadFrameCBuffer(mFrameUploadCBufferPerFrame.GetNextFrameCBuffer());
-    uploadFrameCBuffer.CopyData(0U, &frameCBuffer, sizeof(frameCBuffer));
-
     ID3D12GraphicsCommandList& commandList = mCommandListPerFrame.ResetCommandListWithNextCommandAllocator(sPSO);
 
     commandList.RSSetViewports(1U, &ApplicationSettings::sScreenViewport);
@@ -107,9 +104,8 @@ SkyBoxCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCB
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
 
     commandList.SetGraphicsRootSignature(sRootSignature);
-    D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuVAddress(uploadFrameCBuffer.GetResource().GetGPUVirtualAddress());
-    commandList.SetGraphicsRootDescriptorTable(0U, mObjectCBufferView);
-    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuVAddress);
+    commandList.SetGraphicsRootConstantBufferView(0U, mObjectUploadCBuffer->GetResource().GetGPUVirtualAddress());
+    commandList.SetGraphicsRootConstantBufferView(1U, frameCBufferGpuAddress);
     commandList.SetGraphicsRootDescriptorTable(2U, mPixelShaderResourceViewsBegin);
 
     commandList.IASetVertexBuffers(0U, 1U, &mVertexBufferData.mBufferView);
@@ -118,7 +114,7 @@ SkyBoxCommandListRecorder::RecordAndPushCommandLists(const FrameCBuffer& frameCB
     commandList.DrawIndexedInstanced(mIndexBufferData.mElementCount, 1U, 0U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
@@ -128,7 +124,6 @@ SkyBoxCommandListRecorder::IsDataValid() const noexcept
 {
     const bool result =
         mObjectUploadCBuffer != nullptr &&
-        mObjectCBufferView.ptr != 0UL &&
         mPixelShaderResourceViewsBegin.ptr != 0UL &&
         mOutputColorBufferRenderTargetView.ptr != 0UL &&
         mDepthBufferView.ptr != 0UL;
@@ -147,13 +142,6 @@ SkyBoxCommandListRecorder::InitConstantBuffers(const XMFLOAT4X4& worldMatrix) no
     ObjectCBuffer objCBuffer;
     MathUtils::StoreTransposeMatrix(worldMatrix, objCBuffer.mWorldMatrix);
     mObjectUploadCBuffer->CopyData(0U, &objCBuffer, sizeof(objCBuffer));
-
-    // Create object cbufferview
-    D3D12_CONSTANT_BUFFER_VIEW_DESC cBufferDesc{};
-    const D3D12_GPU_VIRTUAL_ADDRESS objCBufferGpuAddress{ mObjectUploadCBuffer->GetResource().GetGPUVirtualAddress() };
-    cBufferDesc.BufferLocation = objCBufferGpuAddress;
-    cBufferDesc.SizeInBytes = static_cast<std::uint32_t>(objCBufferElemSize);
-    mObjectCBufferView = CbvSrvUavDescriptorManager::CreateConstantBufferView(cBufferDesc);
 }
 
 void
@@ -2,14 +2,13 @@
 
 #include <DirectXMath.h>
 
+#include <ApplicationSettings\ApplicationSettings.h>
 #include <CommandManager\CommandListPerFrame.h>
 #include <MathUtils\MathUtils.h>
-#include <ResourceManager\FrameUploadCBufferPerFrame.h>
+#include <ResourceManager\UploadBuffer.h>
 #include <ResourceManager/VertexAndIndexBufferCreator.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible to generate command list recorders for the sky box pass
 ///
@@ -53,10 +52,12 @@ public:
     ///
     /// Init() must be called first.
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t RecordAndPushCommandLists(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                                            const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
@@ -82,10 +83,8 @@ private:
     VertexAndIndexBufferCreator::VertexBufferData mVertexBufferData;
     VertexAndIndexBufferCreator::IndexBufferData mIndexBufferData;
 
-    FrameUploadCBufferPerFrame mFrameUploadCBufferPerFrame;
-
+    // Bound as a root constant buffer view, so it does not need a descriptor
     UploadBuffer* mObjectUploadCBuffer{ nullptr };
-    D3D12_GPU_DESCRIPTOR_HANDLE mObjectCBufferView;
 
     // First descriptor in the list. All the others are contiguous
     D3D12_GPU_DESCRIPTOR_HANDLE mPixelShaderResourceViewsBegin;
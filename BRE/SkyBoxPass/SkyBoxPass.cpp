@@ -9,9 +9,9 @@
 #include <ModelManager\Mesh.h>
 #include <ModelManager\Model.h>
 #include <ModelManager\ModelManager.h>
+#include <ResourceManager\StagingBufferManager.h>
 #include <ResourceStateManager\ResourceStateManager.h>
 #include <SkyBoxPass\SkyBoxCommandListRecorder.h>
-#include <ShaderUtils\CBuffers.h>
 #include <Utils\DebugUtils.h>
 
 using namespace DirectX;
@@ -28,8 +28,8 @@ CreateCommandObjects(ID3D12CommandAllocator* &commandAllocator,
                      ID3D12GraphicsCommandList* &commandList) noexcept
 {
     // Create command allocators and command list
-    commandAllocator = &CommandAllocatorManager::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT);
-    commandList = &CommandListManager::CreateCommandList(D3D12_COMMAND_LIST_TYPE_DIRECT, *commandAllocator);
+    commandAllocator = &CommandAllocatorManager::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_COPY);
+    commandList = &CommandListManager::CreateCommandList(D3D12_COMMAND_LIST_TYPE_COPY, *commandAllocator);
     commandList->Close();
 }
 
@@ -45,17 +45,23 @@ CreateAndGetSkyBoxSphereModel(ID3D12CommandAllocator& commandAllocator,
 {
     BRE_CHECK_HR(commandList.Reset(&commandAllocator, nullptr));
 
-    ID3D12Resource* uploadVertexBuffer;
-    ID3D12Resource* uploadIndexBuffer;
     Model* model = &ModelManager::CreateSphere(3000U, 
                                                50U, 
                                                50U, 
-                                               commandList, 
-                                               uploadVertexBuffer, 
-                                               uploadIndexBuffer);
+                                               commandList);
 
     commandList.Close();
-    CommandListExecutor::Get().ExecuteCommandListAndWaitForCompletion(commandList);
+    // Copies run in the COPY queue, and the first frame waits for them in the GPU.
+    ID3D12CommandList* commandLists[1U]{ &commandList };
+    const SubmissionFence submissionFence = CommandListExecutor::Get().ExecuteCommandLists(CommandQueueType::COPY,
+                                                                                           _countof(commandLists),
+                                                                                           commandLists,
+                                                                                           nullptr,
+                                                                                           0U);
+    CommandListExecutor::Get().AddPushedCommandListDependency(submissionFence);
+
+    // Upload buffers are released when the copies complete
+    StagingBufferManager::SetSubmissionFence(commandList, submissionFence);
 
     return *model;
 }
@@ -107,14 +113,20 @@ SkyBoxPass::Init(ID3D12Resource& skyBoxCubeMap,
 }
 
 std::uint32_t
-SkyBoxPass::Execute(const FrameCBuffer& frameCBuffer) noexcept
+SkyBoxPass::Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                    tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
 
     std::uint32_t commandListCount = 0U;
 
     commandListCount += RecordAndPushPrePassCommandLists();
-    commandListCount += mCommandListRecorder.RecordAndPushCommandLists(frameCBuffer);
+
+    const std::uint32_t commandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(1U);
+    recordingTaskGroup.run([this, frameCBufferGpuAddress, commandListSlot]() {
+        mCommandListRecorder.RecordAndPushCommandLists(frameCBufferGpuAddress, commandListSlot);
+    });
+    ++commandListCount;
 
     return commandListCount;
 }
@@ -135,9 +147,9 @@ SkyBoxPass::RecordAndPushPrePassCommandLists() noexcept
 
     D3D12_RESOURCE_BARRIER barriers[1U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*mDepthBuffer) != D3D12_RESOURCE_STATE_DEPTH_WRITE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mDepthBuffer,
-                                                                                        D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mDepthBuffer,
+                                                         D3D12_RESOURCE_STATE_DEPTH_WRITE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
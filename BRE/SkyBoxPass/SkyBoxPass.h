@@ -1,11 +1,11 @@
 #pragma once
 
+#include <tbb/task_group.h>
+
 #include <CommandManager\CommandListPerFrame.h>
 #include <SkyBoxPass\SkyBoxCommandListRecorder.h>
 
 namespace BRE {
-struct FrameCBuffer;
-
 ///
 /// @brief Responsible of execute command lists to generate a sky box
 ///
@@ -34,12 +34,17 @@ public:
     /// @brief Executes the pass
     ///
     /// Init() must be called first. This method can record and
-    /// push command lists to the CommandListExecutor.
+    /// push command lists to the CommandListExecutor. Barrier command lists are
+    /// recorded by the calling thread, in pass order, and the other command lists
+    /// are recorded by tasks run in @p recordingTaskGroup.
     ///
-    /// @param frameCBuffer Constant buffer per frame, for current frame
+    /// @param frameCBufferGpuAddress GPU address of the constant buffer per frame, for current frame
+    /// @param recordingTaskGroup Task group where recording tasks are run. The caller must wait for it
+    /// before waiting for the execution of the recorded command lists.
     /// @return The number of recorded command lists.
     ///
-    std::uint32_t Execute(const FrameCBuffer& frameCBuffer) noexcept;
+    std::uint32_t Execute(const D3D12_GPU_VIRTUAL_ADDRESS frameCBufferGpuAddress,
+                          tbb::task_group& recordingTaskGroup) noexcept;
 
 private:
     ///
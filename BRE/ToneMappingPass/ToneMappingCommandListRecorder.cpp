@@ -48,19 +48,19 @@ ToneMappingCommandListRecorder::InitSharedPSOAndRootSignature() noexcept
 }
 
 void
-ToneMappingCommandListRecorder::Init(const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView,
+ToneMappingCommandListRecorder::Init(const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView,
                                      const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView) noexcept
 {
     BRE_ASSERT(IsDataValid() == false);
 
-    mInputColorBufferShaderResourceView = inputColorBufferShaderResourceView;
+    mInputColorBufferStagingShaderResourceView = inputColorBufferStagingShaderResourceView;
     mOutputColorBufferRenderTargetView = outputColorBufferRenderTargetView;
 
     BRE_ASSERT(IsDataValid());
 }
 
 std::uint32_t
-ToneMappingCommandListRecorder::RecordAndPushCommandLists() noexcept
+ToneMappingCommandListRecorder::RecordAndPushCommandLists(const std::uint32_t commandListSlot) noexcept
 {
     BRE_ASSERT(IsDataValid());
     BRE_ASSERT(sPSO != nullptr);
@@ -75,14 +75,18 @@ ToneMappingCommandListRecorder::RecordAndPushCommandLists() noexcept
     ID3D12DescriptorHeap* heaps[] = { &CbvSrvUavDescriptorManager::GetDescriptorHeap() };
     commandList.SetDescriptorHeaps(_countof(heaps), heaps);
 
+    // The input table is built in the transient descriptor ring of the current frame
+    const D3D12_GPU_DESCRIPTOR_HANDLE inputColorBufferDescriptorTable =
+        CbvSrvUavDescriptorManager::CreateTransientDescriptorTable(&mInputColorBufferStagingShaderResourceView, 1U);
+
     commandList.SetGraphicsRootSignature(sRootSignature);
-    commandList.SetGraphicsRootDescriptorTable(0U, mInputColorBufferShaderResourceView);
+    commandList.SetGraphicsRootDescriptorTable(0U, inputColorBufferDescriptorTable);
 
     commandList.IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     commandList.DrawInstanced(6U, 1U, 0U, 0U);
 
     commandList.Close();
-    CommandListExecutor::Get().PushCommandList(commandList);
+    CommandListExecutor::Get().PushCommandList(commandList, commandListSlot);
 
     return 1U;
 }
@@ -91,7 +95,7 @@ bool
 ToneMappingCommandListRecorder::IsDataValid() const noexcept
 {
     const bool result =
-        mInputColorBufferShaderResourceView.ptr != 0UL &&
+        mInputColorBufferStagingShaderResourceView.ptr != 0UL &&
         mOutputColorBufferRenderTargetView.ptr != 0UL;
 
     return result;
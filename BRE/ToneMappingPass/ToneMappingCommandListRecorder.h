@@ -27,10 +27,11 @@ public:
     ///
     /// InitSharedPSOAndRootSignature() must be called before
     ///
-    /// @param inputColorBufferShaderResourceView Shader resource view to the input color buffer
+    /// @param inputColorBufferStagingShaderResourceView Staging shader resource view to the input color buffer.
+    /// It is copied into a transient descriptor table each frame.
     /// @param outputColorBufferRenderTargetView Render target view to the output color buffer
     ///
-    void Init(const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView,
+    void Init(const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView,
               const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView) noexcept;
 
     ///
@@ -38,9 +39,10 @@ public:
     ///
     /// Init() must be called first
     ///
+    /// @param commandListSlot CommandListExecutor slot reserved for the pushed command list
     /// @return The number of pushed command lists
     ///
-    std::uint32_t RecordAndPushCommandLists() noexcept;
+    std::uint32_t RecordAndPushCommandLists(const std::uint32_t commandListSlot) noexcept;
 
     ///
     /// @brief Checks if internal data is valid. Typically, used for assertions
@@ -51,7 +53,7 @@ public:
 private:
     CommandListPerFrame mCommandListPerFrame;
 
-    D3D12_GPU_DESCRIPTOR_HANDLE mInputColorBufferShaderResourceView{ 0UL };
+    D3D12_CPU_DESCRIPTOR_HANDLE mInputColorBufferStagingShaderResourceView{ 0UL };
     D3D12_CPU_DESCRIPTOR_HANDLE mOutputColorBufferRenderTargetView{ 0UL };    
 };
 }
\ No newline at end of file
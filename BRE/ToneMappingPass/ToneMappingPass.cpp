@@ -13,7 +13,7 @@
 namespace BRE {
 void
 ToneMappingPass::Init(ID3D12Resource& inputColorBuffer,
-                      const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView,
+                      const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView,
                       ID3D12Resource& outputColorBuffer,
                       const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView) noexcept
 {
@@ -24,21 +24,26 @@ ToneMappingPass::Init(ID3D12Resource& inputColorBuffer,
     mInputColorBuffer = &inputColorBuffer;
     mOutputColorBuffer = &outputColorBuffer;    
 
-    mCommandListRecorder.Init(inputColorBufferShaderResourceView,
+    mCommandListRecorder.Init(inputColorBufferStagingShaderResourceView,
                               outputColorBufferRenderTargetView);
 
     BRE_ASSERT(IsDataValid());
 }
 
 std::uint32_t
-ToneMappingPass::Execute() noexcept
+ToneMappingPass::Execute(tbb::task_group& recordingTaskGroup) noexcept
 {
     BRE_ASSERT(IsDataValid());
 
     std::uint32_t commandListCount = 0U;
 
     commandListCount += RecordAndPushPrePassCommandLists();
-    commandListCount += mCommandListRecorder.RecordAndPushCommandLists();
+
+    const std::uint32_t commandListSlot = CommandListExecutor::Get().ReserveCommandListSlots(1U);
+    recordingTaskGroup.run([this, commandListSlot]() {
+        mCommandListRecorder.RecordAndPushCommandLists(commandListSlot);
+    });
+    ++commandListCount;
 
     return commandListCount;
 }
@@ -60,15 +65,15 @@ ToneMappingPass::RecordAndPushPrePassCommandLists() noexcept
 
     D3D12_RESOURCE_BARRIER barriers[2U];
     std::uint32_t barrierCount = 0UL;
-    if (ResourceStateManager::GetResourceState(*mInputColorBuffer) != D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mInputColorBuffer,
-                                                                                        D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mInputColorBuffer,
+                                                         D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
-    if (ResourceStateManager::GetResourceState(*mOutputColorBuffer) != D3D12_RESOURCE_STATE_RENDER_TARGET) {
-        barriers[barrierCount] = ResourceStateManager::ChangeResourceStateAndGetBarrier(*mOutputColorBuffer,
-                                                                                        D3D12_RESOURCE_STATE_RENDER_TARGET);
+    if (ResourceStateManager::TransitionResourceIfNeeded(*mOutputColorBuffer,
+                                                         D3D12_RESOURCE_STATE_RENDER_TARGET,
+                                                         barriers[barrierCount])) {
         ++barrierCount;
     }
 
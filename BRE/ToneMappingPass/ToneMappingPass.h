@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tbb/task_group.h>
+
 #include <CommandManager\CommandListPerFrame.h>
 #include <ToneMappingPass\ToneMappingCommandListRecorder.h>
 
@@ -19,12 +21,12 @@ public:
     ///
     /// @brief Initializes the tone mapping pass
     /// @param inputColorBuffer Input buffer to apply tone mapping
-    /// @param inputColorBufferShaderResourceView Shader resource view to the input buffer
+    /// @param inputColorBufferStagingShaderResourceView Staging shader resource view to the input buffer
     /// @param outputColorBuffer Output buffer with the tone mapping applied
     /// @param outputColorBufferRenderTargetView Render target view to the output color buffer
     ///
     void Init(ID3D12Resource& inputColorBuffer,
-              const D3D12_GPU_DESCRIPTOR_HANDLE& inputColorBufferShaderResourceView,
+              const D3D12_CPU_DESCRIPTOR_HANDLE& inputColorBufferStagingShaderResourceView,
               ID3D12Resource& outputColorBuffer,
               const D3D12_CPU_DESCRIPTOR_HANDLE& outputColorBufferRenderTargetView) noexcept;
 
@@ -32,11 +34,15 @@ public:
     /// @brief Executes the pass
     ///
     /// Init() must be called first. This method can record and
-    /// push command lists to the CommandListExecutor.
+    /// push command lists to the CommandListExecutor. Barrier command lists are
+    /// recorded by the calling thread, in pass order, and the other command lists
+    /// are recorded by tasks run in @p recordingTaskGroup.
     ///
+    /// @param recordingTaskGroup Task group where recording tasks are run. The caller must wait for it
+    /// before waiting for the execution of the recorded command lists.
     /// @return The number of recorded command lists.
     ///
-    std::uint32_t Execute() noexcept;
+    std::uint32_t Execute(tbb::task_group& recordingTaskGroup) noexcept;
 
 private:
     ///
@@ -0,0 +1,86 @@
+#include <UnitTests\Catch.h>
+
+#include <MathUtils\MathUtils.h>
+#include <ResourceManager\BuddyAllocator.h>
+
+TEST_CASE("BuddyAllocator")
+{
+    const std::uint64_t kb64 = 64UL * 1024UL;
+    const std::uint64_t mb4 = 4UL * 1024UL * 1024UL;
+    BRE::BuddyAllocator allocator(2UL * mb4, kb64);
+    const std::uint64_t invalidOffset = BRE::BuddyAllocator::sInvalidOffset;
+
+    SECTION("At construction, the whole heap is a single free block")
+    {
+        const BRE::BuddyAllocator::Statistics statistics = allocator.GetStatistics();
+        REQUIRE(statistics.mSize == 2UL * mb4);
+        REQUIRE(statistics.mAllocatedSize == 0UL);
+        REQUIRE(statistics.mAllocationCount == 0U);
+        REQUIRE(statistics.mFreeBlockCount == 1U);
+        REQUIRE(statistics.mLargestFreeBlockSize == 2UL * mb4);
+        REQUIRE(BRE::MathUtils::AreEqual(0.0f, allocator.GetUtilization()));
+        REQUIRE(BRE::MathUtils::AreEqual(0.0f, allocator.GetFragmentation()));
+    }
+
+    SECTION("Sizes are rounded up to a power of two block, and blocks are split")
+    {
+        REQUIRE(allocator.Allocate(1000UL, kb64) == 0UL);
+        REQUIRE(allocator.Allocate(kb64 + 1UL, kb64) == 2UL * kb64);
+        REQUIRE(allocator.Allocate(kb64, kb64) == kb64);
+
+        const BRE::BuddyAllocator::Statistics statistics = allocator.GetStatistics();
+        REQUIRE(statistics.mAllocatedSize == 1000UL + kb64 + 1UL + kb64);
+        REQUIRE(statistics.mAllocatedBlockSize == 4UL * kb64);
+        REQUIRE(statistics.mAllocationCount == 3U);
+    }
+
+    SECTION("Allocations are aligned to the requested alignment")
+    {
+        REQUIRE(allocator.Allocate(kb64, kb64) == 0UL);
+        REQUIRE(allocator.Allocate(kb64, mb4) == mb4);
+        REQUIRE(allocator.Allocate(kb64, mb4) == invalidOffset);
+        REQUIRE(allocator.Allocate(kb64, kb64) == kb64);
+    }
+
+    SECTION("Allocations fail when there is not a free block that fits")
+    {
+        REQUIRE(allocator.Allocate(2UL * mb4 + 1UL, kb64) == invalidOffset);
+        REQUIRE(allocator.Allocate(mb4, kb64) == 0UL);
+        REQUIRE(allocator.Allocate(mb4 + 1UL, kb64) == invalidOffset);
+        REQUIRE(allocator.Allocate(mb4, kb64) == mb4);
+        REQUIRE(allocator.Allocate(1UL, 1UL) == invalidOffset);
+        REQUIRE(BRE::MathUtils::AreEqual(1.0f, allocator.GetUtilization()));
+    }
+
+    SECTION("Free merges buddies back into larger blocks")
+    {
+        const std::uint64_t first = allocator.Allocate(kb64, kb64);
+        const std::uint64_t second = allocator.Allocate(kb64, kb64);
+        const std::uint64_t third = allocator.Allocate(2UL * kb64, kb64);
+
+        allocator.Free(first);
+        REQUIRE(allocator.GetStatistics().mLargestFreeBlockSize == mb4);
+        REQUIRE(allocator.GetFragmentation() > 0.0f);
+
+        allocator.Free(third);
+        allocator.Free(second);
+
+        const BRE::BuddyAllocator::Statistics statistics = allocator.GetStatistics();
+        REQUIRE(statistics.mAllocatedSize == 0UL);
+        REQUIRE(statistics.mAllocatedBlockSize == 0UL);
+        REQUIRE(statistics.mMaxAllocatedBlockSize == 4UL * kb64);
+        REQUIRE(statistics.mFreeBlockCount == 1U);
+        REQUIRE(statistics.mLargestFreeBlockSize == 2UL * mb4);
+        REQUIRE(BRE::MathUtils::AreEqual(0.0f, allocator.GetFragmentation()));
+    }
+
+    SECTION("A freed block is reused before splitting a larger one")
+    {
+        allocator.Allocate(kb64, kb64);
+        const std::uint64_t second = allocator.Allocate(kb64, kb64);
+        allocator.Allocate(kb64, kb64);
+
+        allocator.Free(second);
+        REQUIRE(allocator.Allocate(kb64, kb64) == second);
+    }
+}
@@ -0,0 +1,163 @@
+#include <UnitTests\Catch.h>
+
+#include <string>
+#include <vector>
+
+#include <CommandListExecutor\CommandQueueSubmitter.h>
+
+namespace {
+///
+/// @brief Stand-in queue that logs its operations instead of using the device.
+///
+/// Work completes as soon as it is signaled.
+///
+class StandInQueue : public BRE::SubmissionQueue {
+public:
+    StandInQueue(const std::string& name,
+                 std::vector<std::string>& log)
+        : mName(name)
+        , mLog(log)
+    {}
+
+    void ExecuteCommandLists(const std::uint32_t commandListCount,
+                             ID3D12CommandList* const*) noexcept final override
+    {
+        mLog.push_back(mName + " execute " + std::to_string(commandListCount));
+    }
+
+    void Signal(const std::uint64_t fenceValue) noexcept final override
+    {
+        mLog.push_back(mName + " signal " + std::to_string(fenceValue));
+        mCompletedFenceValue = fenceValue;
+    }
+
+    void Wait(BRE::SubmissionQueue& queue,
+              const std::uint64_t fenceValue) noexcept final override
+    {
+        mLog.push_back(mName + " wait " + static_cast<StandInQueue&>(queue).mName + " " + std::to_string(fenceValue));
+    }
+
+    std::uint64_t GetCompletedFenceValue() noexcept final override
+    {
+        return mCompletedFenceValue;
+    }
+
+    void WaitForFenceValue(const std::uint64_t fenceValue) noexcept final override
+    {
+        mLog.push_back(mName + " cpu wait " + std::to_string(fenceValue));
+    }
+
+    std::uint64_t mCompletedFenceValue{ 0UL };
+
+private:
+    std::string mName;
+    std::vector<std::string>& mLog;
+};
+}
+
+TEST_CASE("CommandQueueSubmitter")
+{
+    using BRE::CommandQueueType;
+    using BRE::SubmissionFence;
+
+    std::vector<std::string> log;
+    StandInQueue directQueue("direct", log);
+    StandInQueue computeQueue("compute", log);
+    StandInQueue copyQueue("copy", log);
+
+    ID3D12CommandList* commandLists[2U]{ nullptr, nullptr };
+
+    BRE::CommandQueueSubmitter submitter;
+    submitter.SetQueue(CommandQueueType::DIRECT, directQueue);
+
+    SECTION("Queue types without a queue fall back to DIRECT")
+    {
+        REQUIRE(submitter.SelectQueueType(CommandQueueType::DIRECT) == CommandQueueType::DIRECT);
+        REQUIRE(submitter.SelectQueueType(CommandQueueType::COMPUTE) == CommandQueueType::DIRECT);
+        REQUIRE(submitter.SelectQueueType(CommandQueueType::COPY) == CommandQueueType::DIRECT);
+
+        const SubmissionFence fence = submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U);
+        REQUIRE(fence.mQueueType == CommandQueueType::DIRECT);
+        REQUIRE(fence.mFenceValue == 1UL);
+        REQUIRE(log == std::vector<std::string>({ "direct execute 1", "direct signal 1" }));
+    }
+
+    SECTION("Queue types with a queue are selected")
+    {
+        submitter.SetQueue(CommandQueueType::COMPUTE, computeQueue);
+        submitter.SetQueue(CommandQueueType::COPY, copyQueue);
+
+        REQUIRE(submitter.SelectQueueType(CommandQueueType::COMPUTE) == CommandQueueType::COMPUTE);
+        REQUIRE(submitter.SelectQueueType(CommandQueueType::COPY) == CommandQueueType::COPY);
+    }
+
+    SECTION("Each queue signals its own increasing fence values")
+    {
+        submitter.SetQueue(CommandQueueType::COPY, copyQueue);
+
+        REQUIRE(submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U).mFenceValue == 1UL);
+        REQUIRE(submitter.Submit(CommandQueueType::DIRECT, 2U, commandLists, nullptr, 0U).mFenceValue == 1UL);
+        REQUIRE(submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U).mFenceValue == 2UL);
+
+        const SubmissionFence lastCopyFence = submitter.GetLastSubmissionFence(CommandQueueType::COPY);
+        REQUIRE(lastCopyFence.mQueueType == CommandQueueType::COPY);
+        REQUIRE(lastCopyFence.mFenceValue == 2UL);
+    }
+
+    SECTION("Cross queue dependencies are waited before execution")
+    {
+        submitter.SetQueue(CommandQueueType::COMPUTE, computeQueue);
+        submitter.SetQueue(CommandQueueType::COPY, copyQueue);
+
+        const SubmissionFence copyFence = submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U);
+        const SubmissionFence computeFence = submitter.Submit(CommandQueueType::COMPUTE, 1U, commandLists, &copyFence, 1U);
+        log.clear();
+
+        const SubmissionFence dependencies[]{ copyFence, computeFence };
+        submitter.Submit(CommandQueueType::DIRECT, 2U, commandLists, dependencies, _countof(dependencies));
+        REQUIRE(log == std::vector<std::string>({ "direct wait copy 1",
+                                                  "direct wait compute 1",
+                                                  "direct execute 2",
+                                                  "direct signal 1" }));
+    }
+
+    SECTION("Same queue and already waited dependencies are skipped")
+    {
+        submitter.SetQueue(CommandQueueType::COPY, copyQueue);
+
+        const SubmissionFence firstCopyFence = submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U);
+        const SubmissionFence secondCopyFence = submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U);
+        const SubmissionFence directFence = submitter.Submit(CommandQueueType::DIRECT, 1U, commandLists, &secondCopyFence, 1U);
+        log.clear();
+
+        const SubmissionFence dependencies[]{ firstCopyFence, secondCopyFence, directFence };
+        submitter.Submit(CommandQueueType::DIRECT, 1U, commandLists, dependencies, _countof(dependencies));
+        REQUIRE(log == std::vector<std::string>({ "direct execute 1", "direct signal 2" }));
+    }
+
+    SECTION("Submissions without command lists only wait and signal")
+    {
+        submitter.SetQueue(CommandQueueType::COPY, copyQueue);
+
+        const SubmissionFence copyFence = submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U);
+        log.clear();
+
+        submitter.Submit(CommandQueueType::DIRECT, 0U, nullptr, &copyFence, 1U);
+        REQUIRE(log == std::vector<std::string>({ "direct wait copy 1", "direct signal 1" }));
+    }
+
+    SECTION("Completion is checked against the fence of the submission queue")
+    {
+        submitter.SetQueue(CommandQueueType::COPY, copyQueue);
+
+        const SubmissionFence copyFence = submitter.Submit(CommandQueueType::COPY, 1U, commandLists, nullptr, 0U);
+        REQUIRE(submitter.IsComplete(copyFence));
+
+        copyQueue.mCompletedFenceValue = 0UL;
+        REQUIRE(submitter.IsComplete(copyFence) == false);
+
+        log.clear();
+        submitter.WaitForCompletion(copyFence);
+        REQUIRE(log == std::vector<std::string>({ "copy cpu wait 1" }));
+    }
+}
@@ -0,0 +1,144 @@
+#include <UnitTests\Catch.h>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <DescriptorManager\DescriptorBlockAllocator.h>
+
+namespace {
+const std::uint32_t sAllocationCountPerThread{ 4096U };
+
+///
+/// @brief Run allocationFunction sAllocationCountPerThread times in each of threadCount threads
+/// @return Elapsed time in microseconds
+///
+template<typename AllocationFunction>
+std::int64_t
+MeasureAllocations(const std::uint32_t threadCount,
+                   AllocationFunction allocationFunction)
+{
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t i = 0U; i < threadCount; ++i) {
+        threads.emplace_back([&allocationFunction]() {
+            for (std::uint32_t j = 0U; j < sAllocationCountPerThread; ++j) {
+                allocationFunction();
+            }
+        });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+}
+
+TEST_CASE("DescriptorBlockAllocator")
+{
+    BRE::DescriptorBlockAllocator allocator(100U, 8U);
+    const std::uint32_t invalidOffset = BRE::DescriptorRangeAllocator::sInvalidOffset;
+
+    SECTION("Allocations of a thread are taken from its block")
+    {
+        REQUIRE(allocator.Allocate(3U) == 0U);
+        REQUIRE(allocator.Allocate(5U) == 3U);
+        REQUIRE(allocator.GetStatistics().mAllocatedDescriptorCount == 8U);
+
+        // The block is full, so a new block is reserved
+        REQUIRE(allocator.Allocate(1U) == 8U);
+        REQUIRE(allocator.GetStatistics().mAllocatedDescriptorCount == 16U);
+    }
+
+    SECTION("Allocations greater than the block size do not use the block")
+    {
+        REQUIRE(allocator.Allocate(1U) == 0U);
+        REQUIRE(allocator.Allocate(20U) == 8U);
+        REQUIRE(allocator.Allocate(1U) == 1U);
+        REQUIRE(allocator.Allocate(93U) == invalidOffset);
+    }
+
+    SECTION("ReturnUnusedDescriptors frees the tails of the blocks")
+    {
+        const std::uint32_t offset = allocator.Allocate(3U);
+        allocator.ReturnUnusedDescriptors();
+        REQUIRE(allocator.GetStatistics().mAllocatedDescriptorCount == 3U);
+        REQUIRE(allocator.GetStatistics().mLargestFreeRangeSize == 97U);
+
+        allocator.Free(offset, 3U);
+        REQUIRE(allocator.GetStatistics().mAllocatedDescriptorCount == 0U);
+        REQUIRE(allocator.GetStatistics().mFreeRangeCount == 1U);
+    }
+
+    SECTION("When a whole block does not fit, only the requested descriptors are allocated")
+    {
+        REQUIRE(allocator.Allocate(95U) == 0U);
+        REQUIRE(allocator.Allocate(4U) == 95U);
+        REQUIRE(allocator.Allocate(1U) == 99U);
+        REQUIRE(allocator.Allocate(1U) == invalidOffset);
+    }
+
+    SECTION("Allocations of different threads do not overlap")
+    {
+        BRE::DescriptorBlockAllocator sharedAllocator(4U * 64U, 16U);
+        std::vector<std::uint32_t> offsetsByThread[4U];
+        std::vector<std::thread> threads;
+        for (std::uint32_t i = 0U; i < 4U; ++i) {
+            std::vector<std::uint32_t>& offsets = offsetsByThread[i];
+            threads.emplace_back([&sharedAllocator, &offsets]() {
+                for (std::uint32_t j = 0U; j < 64U; ++j) {
+                    offsets.push_back(sharedAllocator.Allocate(1U));
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        std::vector<std::uint32_t> offsets;
+        for (const std::vector<std::uint32_t>& threadOffsets : offsetsByThread) {
+            offsets.insert(offsets.end(), threadOffsets.begin(), threadOffsets.end());
+        }
+        std::sort(offsets.begin(), offsets.end());
+        REQUIRE(std::adjacent_find(offsets.begin(), offsets.end()) == offsets.end());
+        REQUIRE(std::find(offsets.begin(), offsets.end(), invalidOffset) == offsets.end());
+    }
+}
+
+TEST_CASE("DescriptorBlockAllocator contention", "[.benchmark]")
+{
+    const std::uint32_t threadCounts[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+    for (const std::uint32_t threadCount : threadCounts) {
+        const std::uint32_t capacity = threadCount * sAllocationCountPerThread;
+
+        // Baseline: a single allocator guarded by a mutex, as before per-thread blocks
+        std::mutex mutex;
+        BRE::DescriptorRangeAllocator rangeAllocator(capacity);
+        const std::int64_t rangeAllocatorTime = MeasureAllocations(threadCount, [&mutex, &rangeAllocator]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            rangeAllocator.Allocate(1U);
+        });
+
+        BRE::DescriptorBlockAllocator blockAllocator(capacity, 64U);
+        const std::int64_t blockAllocatorTime = MeasureAllocations(threadCount, [&blockAllocator]() {
+            blockAllocator.Allocate(1U);
+        });
+
+        REQUIRE(rangeAllocator.GetStatistics().mAllocatedDescriptorCount == capacity);
+        REQUIRE(blockAllocator.GetStatistics().mAllocatedDescriptorCount == capacity);
+
+        std::ostringstream stream;
+        stream << threadCount << " threads: "
+            << "mutex + DescriptorRangeAllocator " << rangeAllocatorTime << " us, "
+            << "DescriptorBlockAllocator " << blockAllocatorTime << " us";
+        WARN(stream.str());
+    }
+}
@@ -0,0 +1,79 @@
+#include <UnitTests\Catch.h>
+
+#include <DescriptorManager\DescriptorRangeAllocator.h>
+#include <MathUtils\MathUtils.h>
+
+TEST_CASE("DescriptorRangeAllocator")
+{
+    BRE::DescriptorRangeAllocator allocator(100U);
+    const std::uint32_t invalidOffset = BRE::DescriptorRangeAllocator::sInvalidOffset;
+
+    SECTION("At construction, all the descriptors are in a single free range")
+    {
+        const BRE::DescriptorRangeAllocator::Statistics statistics = allocator.GetStatistics();
+        REQUIRE(statistics.mCapacity == 100U);
+        REQUIRE(statistics.mAllocatedDescriptorCount == 0U);
+        REQUIRE(statistics.mFreeRangeCount == 1U);
+        REQUIRE(statistics.mLargestFreeRangeSize == 100U);
+        REQUIRE(BRE::MathUtils::AreEqual(0.0f, allocator.GetFragmentation()));
+    }
+
+    SECTION("Allocations are contiguous and they fail when there is not a free range that fits")
+    {
+        REQUIRE(allocator.Allocate(10U) == 0U);
+        REQUIRE(allocator.Allocate(20U) == 10U);
+        REQUIRE(allocator.Allocate(71U) == invalidOffset);
+        REQUIRE(allocator.Allocate(70U) == 30U);
+        REQUIRE(allocator.Allocate(1U) == invalidOffset);
+        REQUIRE(allocator.GetStatistics().mAllocatedDescriptorCount == 100U);
+        REQUIRE(allocator.GetStatistics().mFreeRangeCount == 0U);
+    }
+
+    SECTION("Freed ranges are reused and the smallest free range that fits is chosen")
+    {
+        const std::uint32_t first = allocator.Allocate(10U);
+        allocator.Allocate(10U);
+        const std::uint32_t third = allocator.Allocate(5U);
+        allocator.Allocate(10U);
+
+        allocator.Free(first, 10U);
+        allocator.Free(third, 5U);
+        REQUIRE(allocator.GetStatistics().mFreeRangeCount == 3U);
+
+        REQUIRE(allocator.Allocate(4U) == third);
+        REQUIRE(allocator.Allocate(8U) == first);
+    }
+
+    SECTION("Free coalesces with previous and next free ranges")
+    {
+        const std::uint32_t first = allocator.Allocate(10U);
+        const std::uint32_t second = allocator.Allocate(10U);
+        const std::uint32_t third = allocator.Allocate(10U);
+        allocator.Allocate(70U);
+
+        allocator.Free(first, 10U);
+        allocator.Free(third, 10U);
+        REQUIRE(allocator.GetStatistics().mFreeRangeCount == 2U);
+        REQUIRE(BRE::MathUtils::AreEqual(0.5f, allocator.GetFragmentation()));
+
+        allocator.Free(second, 10U);
+        REQUIRE(allocator.GetStatistics().mFreeRangeCount == 1U);
+        REQUIRE(allocator.GetStatistics().mLargestFreeRangeSize == 30U);
+        REQUIRE(BRE::MathUtils::AreEqual(0.0f, allocator.GetFragmentation()));
+        REQUIRE(allocator.Allocate(30U) == first);
+    }
+
+    SECTION("Freeing everything restores a single free range and keeps the high-water mark")
+    {
+        const std::uint32_t first = allocator.Allocate(40U);
+        const std::uint32_t second = allocator.Allocate(60U);
+        allocator.Free(second, 60U);
+        allocator.Free(first, 40U);
+
+        const BRE::DescriptorRangeAllocator::Statistics statistics = allocator.GetStatistics();
+        REQUIRE(statistics.mAllocatedDescriptorCount == 0U);
+        REQUIRE(statistics.mMaxAllocatedDescriptorCount == 100U);
+        REQUIRE(statistics.mFreeRangeCount == 1U);
+        REQUIRE(statistics.mLargestFreeRangeSize == 100U);
+    }
+}
@@ -0,0 +1,38 @@
+#include <UnitTests\Catch.h>
+
+#include <Utils\FramePartitionedRing.h>
+
+TEST_CASE("FramePartitionedRing")
+{
+    BRE::FramePartitionedRing<std::uint32_t> ring(100U, 16U, 2U);
+    const std::uint32_t invalidOffset = BRE::FramePartitionedRing<std::uint32_t>::sInvalidOffset;
+
+    SECTION("Offsets start at the first offset of the ring and they are aligned in the partition")
+    {
+        REQUIRE(ring.Allocate(3U, 1U) == 100U);
+        REQUIRE(ring.Allocate(3U, 4U) == 104U);
+        REQUIRE(ring.Allocate(8U, 8U) == 108U);
+        REQUIRE(ring.Allocate(1U, 1U) == invalidOffset);
+        REQUIRE(ring.GetAllocatedSize() == 16U);
+    }
+
+    SECTION("An alignment past the end of the partition fails")
+    {
+        REQUIRE(ring.Allocate(9U, 1U) == 100U);
+        REQUIRE(ring.Allocate(1U, 32U) == invalidOffset);
+        REQUIRE(ring.GetAllocatedSize() == 9U);
+    }
+
+    SECTION("Partitions alternate and they return the fence value of their previous frame")
+    {
+        ring.Allocate(5U, 1U);
+        REQUIRE(ring.EndFrame(10UL) == 0UL);
+        REQUIRE(ring.GetAllocatedSize() == 0U);
+        REQUIRE(ring.Allocate(1U, 1U) == 116U);
+        REQUIRE(ring.EndFrame(11UL) == 10UL);
+        REQUIRE(ring.Allocate(16U, 1U) == 100U);
+        REQUIRE(ring.EndFrame(12UL) == 11UL);
+        REQUIRE(ring.GetSizePerFrame() == 16U);
+        REQUIRE(ring.GetMaxAllocatedSizePerFrame() == 16U);
+    }
+}
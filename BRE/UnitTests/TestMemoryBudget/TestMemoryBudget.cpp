@@ -0,0 +1,112 @@
+#include <UnitTests\Catch.h>
+
+#include <sstream>
+#include <string>
+
+#include <ResourceManager\MemoryBudget.h>
+
+using BRE::MemoryBudget;
+
+TEST_CASE("MemoryBudget")
+{
+    MemoryBudget::Clear();
+
+    // Only their addresses are used
+    int allocations[4];
+
+    SECTION("Allocations are accounted by category and memory pool")
+    {
+        MemoryBudget::AddAllocation(&allocations[0], MemoryBudget::Category::TEXTURES, MemoryBudget::MemoryPool::VIDEO_MEMORY, 1000UL);
+        MemoryBudget::AddAllocation(&allocations[1], MemoryBudget::Category::TEXTURES, MemoryBudget::MemoryPool::SYSTEM_MEMORY, 200UL);
+        MemoryBudget::AddAllocation(&allocations[2], MemoryBudget::Category::SHADERS, MemoryBudget::MemoryPool::SYSTEM_MEMORY, 30UL);
+
+        const MemoryBudget::Usage textureUsage = MemoryBudget::GetUsage(MemoryBudget::Category::TEXTURES);
+        REQUIRE(textureUsage.mVideoMemorySize == 1000UL);
+        REQUIRE(textureUsage.mSystemMemorySize == 200UL);
+        REQUIRE(textureUsage.mPeakSize == 1200UL);
+        REQUIRE(textureUsage.mAllocationCount == 2U);
+
+        const MemoryBudget::Usage totalUsage = MemoryBudget::GetTotalUsage();
+        REQUIRE(totalUsage.mVideoMemorySize == 1000UL);
+        REQUIRE(totalUsage.mSystemMemorySize == 230UL);
+        REQUIRE(totalUsage.mPeakSize == 1230UL);
+        REQUIRE(totalUsage.mAllocationCount == 3U);
+    }
+
+    SECTION("Removed allocations are not accounted, but peaks are kept")
+    {
+        MemoryBudget::AddAllocation(&allocations[0], MemoryBudget::Category::MODEL_BUFFERS, MemoryBudget::MemoryPool::VIDEO_MEMORY, 500UL);
+        MemoryBudget::AddAllocation(&allocations[1], MemoryBudget::Category::MODEL_BUFFERS, MemoryBudget::MemoryPool::VIDEO_MEMORY, 300UL);
+        MemoryBudget::RemoveAllocation(&allocations[0]);
+        MemoryBudget::AddAllocation(&allocations[2], MemoryBudget::Category::MODEL_BUFFERS, MemoryBudget::MemoryPool::VIDEO_MEMORY, 100UL);
+
+        // Not registered allocations are ignored
+        MemoryBudget::RemoveAllocation(&allocations[3]);
+
+        const MemoryBudget::Usage usage = MemoryBudget::GetUsage(MemoryBudget::Category::MODEL_BUFFERS);
+        REQUIRE(usage.mVideoMemorySize == 400UL);
+        REQUIRE(usage.mPeakSize == 800UL);
+        REQUIRE(usage.mAllocationCount == 2U);
+        REQUIRE(MemoryBudget::GetTotalUsage().mPeakSize == 800UL);
+    }
+
+    SECTION("Placed allocations are not included in totals")
+    {
+        MemoryBudget::AddAllocation(&allocations[0], MemoryBudget::Category::TRANSIENT_HEAPS, MemoryBudget::MemoryPool::VIDEO_MEMORY, 4096UL);
+        MemoryBudget::AddAllocation(&allocations[1], MemoryBudget::Category::G_BUFFERS, MemoryBudget::MemoryPool::PLACED, 4096UL);
+        MemoryBudget::AddAllocation(&allocations[2], MemoryBudget::Category::INTERMEDIATE_BUFFERS, MemoryBudget::MemoryPool::PLACED, 2048UL);
+
+        const MemoryBudget::Usage geometryBufferUsage = MemoryBudget::GetUsage(MemoryBudget::Category::G_BUFFERS);
+        REQUIRE(geometryBufferUsage.mPlacedSize == 4096UL);
+        REQUIRE(geometryBufferUsage.mVideoMemorySize == 0UL);
+        REQUIRE(geometryBufferUsage.mPeakSize == 0UL);
+
+        const MemoryBudget::Usage totalUsage = MemoryBudget::GetTotalUsage();
+        REQUIRE(totalUsage.mVideoMemorySize == 4096UL);
+        REQUIRE(totalUsage.mPlacedSize == 6144UL);
+        REQUIRE(totalUsage.mPeakSize == 4096UL);
+    }
+
+    SECTION("Categories over their budgets are reported")
+    {
+        MemoryBudget::SetBudget(MemoryBudget::Category::UPLOAD_BUFFERS, 1024UL);
+        MemoryBudget::AddAllocation(&allocations[0], MemoryBudget::Category::UPLOAD_BUFFERS, MemoryBudget::MemoryPool::SYSTEM_MEMORY, 1024UL);
+        REQUIRE(MemoryBudget::IsOverBudget(MemoryBudget::Category::UPLOAD_BUFFERS) == false);
+
+        MemoryBudget::AddAllocation(&allocations[1], MemoryBudget::Category::UPLOAD_BUFFERS, MemoryBudget::MemoryPool::SYSTEM_MEMORY, 1UL);
+        REQUIRE(MemoryBudget::IsOverBudget(MemoryBudget::Category::UPLOAD_BUFFERS));
+
+        // Categories without budget are never over budget
+        MemoryBudget::AddAllocation(&allocations[2], MemoryBudget::Category::TEXTURES, MemoryBudget::MemoryPool::VIDEO_MEMORY, 1UL << 30U);
+        REQUIRE(MemoryBudget::IsOverBudget(MemoryBudget::Category::TEXTURES) == false);
+    }
+
+    SECTION("The CSV has a header, a row per category and a total row")
+    {
+        MemoryBudget::SetBudget(MemoryBudget::Category::SHADERS, 64UL);
+        MemoryBudget::AddAllocation(&allocations[0], MemoryBudget::Category::SHADERS, MemoryBudget::MemoryPool::SYSTEM_MEMORY, 48UL);
+
+        std::ostringstream stream;
+        MemoryBudget::WriteCsv(stream);
+
+        std::istringstream lines(stream.str());
+        std::string line;
+        std::uint32_t lineCount = 0U;
+        bool hasShaderRow = false;
+        std::string lastLine;
+        while (std::getline(lines, line)) {
+            if (lineCount == 0U) {
+                REQUIRE(line == "Category,VideoMemoryBytes,SystemMemoryBytes,PlacedBytes,PeakBytes,BudgetBytes,AllocationCount");
+            }
+            hasShaderRow = hasShaderRow || line == "Shaders,0,48,0,48,64,1";
+            lastLine = line;
+            ++lineCount;
+        }
+
+        REQUIRE(lineCount == static_cast<std::uint32_t>(MemoryBudget::Category::COUNT) + 2U);
+        REQUIRE(hasShaderRow);
+        REQUIRE(lastLine == "Total,0,48,0,48,64,1");
+    }
+
+    MemoryBudget::Clear();
+}
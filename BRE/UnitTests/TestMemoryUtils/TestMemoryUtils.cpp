@@ -0,0 +1,149 @@
+#include <UnitTests\Catch.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include <Utils\MemoryUtils.h>
+
+namespace {
+///
+/// @brief Get a vector where each byte depends on its index
+/// @param size Vector size
+/// @return Vector
+///
+std::vector<std::uint8_t>
+GetPattern(const std::size_t size)
+{
+    std::vector<std::uint8_t> pattern(size);
+    for (std::size_t i = 0UL; i < size; ++i) {
+        pattern[i] = static_cast<std::uint8_t>(i * 7UL + 1UL);
+    }
+
+    return pattern;
+}
+
+///
+/// @brief Run copyFunction iterationCount times
+/// @return Elapsed time in nanoseconds per iteration
+///
+template<typename CopyFunction>
+std::int64_t
+MeasureCopies(const std::uint32_t iterationCount,
+              CopyFunction copyFunction)
+{
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (std::uint32_t i = 0U; i < iterationCount; ++i) {
+        copyFunction();
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / iterationCount;
+}
+}
+
+TEST_CASE("MemoryUtils")
+{
+    SECTION("CopyToWriteCombinedMemory copies every size and alignment")
+    {
+        const std::size_t maxSize = 300UL;
+        const std::vector<std::uint8_t> source = GetPattern(maxSize + 64UL);
+        std::vector<std::uint8_t> destination(maxSize + 64UL);
+
+        for (std::size_t destinationOffset = 0UL; destinationOffset < 33UL; ++destinationOffset) {
+            for (std::size_t sourceOffset = 0UL; sourceOffset < 3UL; ++sourceOffset) {
+                for (std::size_t size = 0UL; size <= maxSize; ++size) {
+                    std::fill(destination.begin(), destination.end(), std::uint8_t(0U));
+                    BRE::MemoryUtils::CopyToWriteCombinedMemory(destination.data() + destinationOffset,
+                                                                source.data() + sourceOffset,
+                                                                size);
+
+                    REQUIRE(memcmp(destination.data() + destinationOffset, source.data() + sourceOffset, size) == 0);
+
+                    // Bytes out of the range are not written
+                    for (std::size_t i = 0UL; i < destinationOffset; ++i) {
+                        REQUIRE(destination[i] == 0U);
+                    }
+                    for (std::size_t i = destinationOffset + size; i < destination.size(); ++i) {
+                        REQUIRE(destination[i] == 0U);
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("CopyToWriteCombinedMemory copies strided elements")
+    {
+        const std::size_t elementSize = 80UL;
+        const std::size_t sourceStride = 96UL;
+        const std::size_t destinationStride = 256UL;
+        const std::uint32_t elementCount = 10U;
+        const std::vector<std::uint8_t> source = GetPattern(sourceStride * elementCount);
+        std::vector<std::uint8_t> destination(destinationStride * elementCount);
+
+        BRE::MemoryUtils::CopyToWriteCombinedMemory(destination.data(),
+                                                    destinationStride,
+                                                    source.data(),
+                                                    sourceStride,
+                                                    elementSize,
+                                                    elementCount);
+
+        for (std::uint32_t i = 0U; i < elementCount; ++i) {
+            const std::uint8_t* destinationElement = destination.data() + destinationStride * i;
+            REQUIRE(memcmp(destinationElement, source.data() + sourceStride * i, elementSize) == 0);
+
+            // Padding between elements is not written
+            for (std::size_t j = elementSize; j < destinationStride; ++j) {
+                REQUIRE(destinationElement[j] == 0U);
+            }
+        }
+    }
+
+    SECTION("CopyToWriteCombinedMemory copies packed elements")
+    {
+        const std::size_t elementSize = 48UL;
+        const std::uint32_t elementCount = 7U;
+        const std::vector<std::uint8_t> source = GetPattern(elementSize * elementCount);
+        std::vector<std::uint8_t> destination(elementSize * elementCount);
+
+        BRE::MemoryUtils::CopyToWriteCombinedMemory(destination.data(),
+                                                    elementSize,
+                                                    source.data(),
+                                                    elementSize,
+                                                    elementSize,
+                                                    elementCount);
+
+        REQUIRE(destination == source);
+    }
+}
+
+TEST_CASE("MemoryUtils copy throughput", "[.benchmark]")
+{
+    // It uses regular cached memory. Mapped upload heaps are write-combined,
+    // where memcpy is slower, so this is the worst case for streaming stores.
+    const std::size_t maxSize = 16UL * 1024UL * 1024UL;
+    const std::vector<std::uint8_t> source = GetPattern(maxSize);
+    std::vector<std::uint8_t> destination(maxSize);
+
+    for (std::size_t size = 64UL; size <= maxSize; size *= 4UL) {
+        const std::uint32_t iterationCount = static_cast<std::uint32_t>(std::max(maxSize * 4UL / size, std::size_t(16UL)));
+
+        const std::int64_t memcpyTime = MeasureCopies(iterationCount, [&source, &destination, size]() {
+            memcpy(destination.data(), source.data(), size);
+        });
+
+        const std::int64_t streamingTime = MeasureCopies(iterationCount, [&source, &destination, size]() {
+            BRE::MemoryUtils::CopyToWriteCombinedMemory(destination.data(), source.data(), size);
+        });
+
+        REQUIRE(memcmp(destination.data(), source.data(), size) == 0);
+
+        std::ostringstream stream;
+        stream << size << " bytes: "
+            << "memcpy " << memcpyTime << " ns, "
+            << "CopyToWriteCombinedMemory " << streamingTime << " ns";
+        WARN(stream.str());
+    }
+}
@@ -0,0 +1,160 @@
+#include <UnitTests\Catch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_group.h>
+#include <tbb/task_scheduler_init.h>
+
+namespace {
+// RenderManager and CommandListExecutor run a loop each, for the whole run.
+const std::uint32_t sFrameLoopCount{ 2U };
+
+///
+/// @brief Loop that polls for work until it is stopped, like the frame loops of
+/// RenderManager and CommandListExecutor
+/// @param startedLoopCount Incremented when the loop starts
+/// @param stop Flag to stop the loop
+///
+void
+RunFrameLoop(std::atomic<std::uint32_t>& startedLoopCount,
+             const std::atomic<bool>& stop)
+{
+    ++startedLoopCount;
+    while (stop == false) {
+        std::this_thread::yield();
+    }
+}
+
+///
+/// @brief Records draw calls with tbb::parallel_for, like GeometryPass does
+///
+/// Each draw call is simulated with a fixed amount of CPU work.
+///
+/// @param drawCount Number of draw calls
+/// @return Elapsed time in microseconds
+///
+std::int64_t
+RecordDrawCalls(const std::uint32_t drawCount)
+{
+    std::vector<float> results(drawCount);
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    tbb::parallel_for(tbb::blocked_range<std::uint32_t>(0U, drawCount, 16U),
+                      [&results](const tbb::blocked_range<std::uint32_t>& range) {
+        for (std::uint32_t i = range.begin(); i != range.end(); ++i) {
+            float value = static_cast<float>(i);
+            for (std::uint32_t j = 0U; j < 2000U; ++j) {
+                value = std::sqrt(value * 1.0001f + 1.0f);
+            }
+            results[i] = value;
+        }
+    });
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    REQUIRE(results.back() > 0.0f);
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+///
+/// @brief Records draw calls while the frame loops run as TBB tasks, so
+/// they hold TBB workers (RenderManager and CommandListExecutor before they
+/// moved to dedicated threads).
+/// @param drawCount Number of draw calls
+/// @return Elapsed time of the recording in microseconds
+///
+std::int64_t
+RecordDrawCallsWithLoopsInTbbWorkers(const std::uint32_t drawCount)
+{
+    std::atomic<std::uint32_t> startedLoopCount{ 0U };
+    std::atomic<bool> stop{ false };
+
+    tbb::task_group loopTaskGroup;
+    for (std::uint32_t i = 0U; i < sFrameLoopCount; ++i) {
+        loopTaskGroup.run([&startedLoopCount, &stop]() {
+            RunFrameLoop(startedLoopCount, stop);
+        });
+    }
+
+    // The loops must hold their workers before recording begins
+    while (startedLoopCount < sFrameLoopCount) {
+        std::this_thread::yield();
+    }
+
+    const std::int64_t elapsedTime = RecordDrawCalls(drawCount);
+
+    stop = true;
+    loopTaskGroup.wait();
+
+    return elapsedTime;
+}
+
+///
+/// @brief Records draw calls while the frame loops run on dedicated threads
+/// @param drawCount Number of draw calls
+/// @return Elapsed time of the recording in microseconds
+///
+std::int64_t
+RecordDrawCallsWithLoopsInDedicatedThreads(const std::uint32_t drawCount)
+{
+    std::atomic<std::uint32_t> startedLoopCount{ 0U };
+    std::atomic<bool> stop{ false };
+
+    std::vector<std::thread> loopThreads;
+    for (std::uint32_t i = 0U; i < sFrameLoopCount; ++i) {
+        loopThreads.emplace_back([&startedLoopCount, &stop]() {
+            RunFrameLoop(startedLoopCount, stop);
+        });
+    }
+
+    while (startedLoopCount < sFrameLoopCount) {
+        std::this_thread::yield();
+    }
+
+    const std::int64_t elapsedTime = RecordDrawCalls(drawCount);
+
+    stop = true;
+    for (std::thread& loopThread : loopThreads) {
+        loopThread.join();
+    }
+
+    return elapsedTime;
+}
+}
+
+// Run it alone ("UnitTests.exe [.benchmark]"), because the TBB scheduler
+// must be initialized with its thread count.
+TEST_CASE("Recording throughput with frame loops in TBB workers or in dedicated threads", "[.benchmark]")
+{
+    // The frame loops as TBB tasks need a worker each, and recording needs at least
+    // another thread. Machines with fewer cores are oversubscribed.
+    const std::uint32_t threadCount = std::max(std::thread::hardware_concurrency(), sFrameLoopCount + 1U);
+    tbb::task_scheduler_init taskSchedulerInit(static_cast<int>(threadCount));
+
+    const std::uint32_t drawCount = 4096U;
+    const std::uint32_t iterationCount = 10U;
+
+    std::int64_t tbbWorkersTime = 0;
+    std::int64_t dedicatedThreadsTime = 0;
+    for (std::uint32_t i = 0U; i < iterationCount; ++i) {
+        tbbWorkersTime += RecordDrawCallsWithLoopsInTbbWorkers(drawCount);
+        dedicatedThreadsTime += RecordDrawCallsWithLoopsInDedicatedThreads(drawCount);
+    }
+
+    const double tbbWorkersThroughput = (drawCount * iterationCount * 1000.0) / static_cast<double>(tbbWorkersTime);
+    const double dedicatedThreadsThroughput = (drawCount * iterationCount * 1000.0) / static_cast<double>(dedicatedThreadsTime);
+
+    std::ostringstream stream;
+    stream << threadCount << " TBB threads, " << std::thread::hardware_concurrency() << " hardware threads: "
+        << "frame loops in TBB workers " << tbbWorkersThroughput << " draw calls per ms, "
+        << "frame loops in dedicated threads " << dedicatedThreadsThroughput << " draw calls per ms";
+    WARN(stream.str());
+}
@@ -0,0 +1,289 @@
+#include <UnitTests\Catch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <ResourceStateManager\ResourceStateTable.h>
+
+namespace {
+///
+/// @brief Resource states tracked like ResourceStateManager did before
+/// ResourceStateTable: a hash map whose states are read and changed with
+/// exclusive accessors, with a lookup to get the state and another one to change it.
+///
+class ExclusiveAccessorStates {
+public:
+    void AddResource(const void* resource,
+                     const D3D12_RESOURCE_STATES initialState)
+    {
+        tbb::concurrent_hash_map<const void*, D3D12_RESOURCE_STATES>::accessor accessor;
+        mStateByResource.insert(accessor, resource);
+        accessor->second = initialState;
+    }
+
+    bool ChangeStateIfNeeded(const void* resource,
+                             const D3D12_RESOURCE_STATES newState,
+                             D3D12_RESOURCE_STATES& oldState)
+    {
+        {
+            tbb::concurrent_hash_map<const void*, D3D12_RESOURCE_STATES>::accessor accessor;
+            mStateByResource.find(accessor, resource);
+            if (accessor->second == newState) {
+                return false;
+            }
+        }
+
+        tbb::concurrent_hash_map<const void*, D3D12_RESOURCE_STATES>::accessor accessor;
+        mStateByResource.find(accessor, resource);
+        oldState = accessor->second;
+        accessor->second = newState;
+
+        return true;
+    }
+
+private:
+    tbb::concurrent_hash_map<const void*, D3D12_RESOURCE_STATES> mStateByResource;
+};
+
+///
+/// @brief Run recorder threads that transition resources, like passes do every frame
+///
+/// Each recorder transitions its own resources to render target and back to
+/// pixel shader resource, and it also transitions resources shared by all the
+/// recorders, that are already in the requested state.
+///
+/// @return Elapsed time in nanoseconds divided by the number of transition calls of all the recorders.
+/// It halves when the number of recorders doubles, if they scale perfectly.
+///
+template<typename States>
+std::int64_t
+MeasureTransitions(States& states,
+                   const std::vector<std::uint8_t>& ownResources,
+                   const std::size_t ownResourceCountPerRecorder,
+                   const std::vector<std::uint8_t>& sharedResources,
+                   const std::uint32_t recorderCount,
+                   const std::uint32_t frameCount)
+{
+    REQUIRE(ownResourceCountPerRecorder * recorderCount <= ownResources.size());
+
+    std::atomic<std::uint32_t> changeCount{ 0U };
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> recorders;
+    for (std::uint32_t i = 0U; i < recorderCount; ++i) {
+        recorders.emplace_back([&, i]() {
+            const std::uint8_t* firstOwnResource = ownResources.data() + ownResourceCountPerRecorder * i;
+            std::uint32_t recorderChangeCount = 0U;
+            D3D12_RESOURCE_STATES oldState{ D3D12_RESOURCE_STATE_COMMON };
+            for (std::uint32_t frame = 0U; frame < frameCount; ++frame) {
+                for (const std::uint8_t& sharedResource : sharedResources) {
+                    recorderChangeCount += states.ChangeStateIfNeeded(&sharedResource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, oldState) ? 1U : 0U;
+                }
+                for (std::size_t j = 0UL; j < ownResourceCountPerRecorder; ++j) {
+                    recorderChangeCount += states.ChangeStateIfNeeded(firstOwnResource + j, D3D12_RESOURCE_STATE_RENDER_TARGET, oldState) ? 1U : 0U;
+                }
+                for (std::size_t j = 0UL; j < ownResourceCountPerRecorder; ++j) {
+                    recorderChangeCount += states.ChangeStateIfNeeded(firstOwnResource + j, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, oldState) ? 1U : 0U;
+                }
+            }
+            changeCount += recorderChangeCount;
+        });
+    }
+    for (std::thread& recorder : recorders) {
+        recorder.join();
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    REQUIRE(changeCount == recorderCount * frameCount * ownResourceCountPerRecorder * 2U);
+
+    const std::uint64_t callCount = recorderCount * frameCount * (sharedResources.size() + ownResourceCountPerRecorder * 2UL);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count() / callCount;
+}
+
+///
+/// @brief Adapter of ResourceStateTable for resources with a single state
+///
+class ResourceStateTableStates {
+public:
+    explicit ResourceStateTableStates(BRE::ResourceStateTable& stateTable)
+        : mStateTable(stateTable)
+    {}
+
+    bool ChangeStateIfNeeded(const void* resource,
+                             const D3D12_RESOURCE_STATES newState,
+                             D3D12_RESOURCE_STATES& oldState)
+    {
+        return mStateTable.ChangeStateIfNeeded(resource, 0U, newState, oldState);
+    }
+
+private:
+    BRE::ResourceStateTable& mStateTable;
+};
+}
+
+TEST_CASE("ResourceStateTable")
+{
+    BRE::ResourceStateTable stateTable;
+
+    // Only their addresses are used
+    std::uint8_t resources[4];
+
+    SECTION("Added resources have their initial states")
+    {
+        stateTable.AddResource(&resources[0], D3D12_RESOURCE_STATE_RENDER_TARGET, 1U);
+        stateTable.AddResource(&resources[1], D3D12_RESOURCE_STATE_COMMON, 3U);
+
+        REQUIRE(stateTable.GetStateCount(&resources[0]) == 1U);
+        REQUIRE(stateTable.GetStateCount(&resources[1]) == 3U);
+        REQUIRE(stateTable.GetStateCount(&resources[2]) == 0U);
+        REQUIRE(stateTable.GetState(&resources[0], 0U) == D3D12_RESOURCE_STATE_RENDER_TARGET);
+        for (std::uint32_t i = 0U; i < 3U; ++i) {
+            REQUIRE(stateTable.GetState(&resources[1], i) == D3D12_RESOURCE_STATE_COMMON);
+        }
+    }
+
+    SECTION("States only change if they are different")
+    {
+        stateTable.AddResource(&resources[0], D3D12_RESOURCE_STATE_COMMON, 2U);
+
+        D3D12_RESOURCE_STATES oldState{ D3D12_RESOURCE_STATE_DEPTH_WRITE };
+        REQUIRE(stateTable.ChangeStateIfNeeded(&resources[0], 0U, D3D12_RESOURCE_STATE_COMMON, oldState) == false);
+        REQUIRE(oldState == D3D12_RESOURCE_STATE_DEPTH_WRITE);
+
+        REQUIRE(stateTable.ChangeStateIfNeeded(&resources[0], 1U, D3D12_RESOURCE_STATE_RENDER_TARGET, oldState));
+        REQUIRE(oldState == D3D12_RESOURCE_STATE_COMMON);
+        REQUIRE(stateTable.GetState(&resources[0], 0U) == D3D12_RESOURCE_STATE_COMMON);
+        REQUIRE(stateTable.GetState(&resources[0], 1U) == D3D12_RESOURCE_STATE_RENDER_TARGET);
+    }
+
+    SECTION("Removed resources free their slots, that are reused by new resources")
+    {
+        stateTable.AddResource(&resources[0], D3D12_RESOURCE_STATE_COMMON, 2U);
+        stateTable.AddResource(&resources[1], D3D12_RESOURCE_STATE_COMMON, 1U);
+
+        REQUIRE(stateTable.RemoveResource(&resources[0]));
+        REQUIRE(stateTable.RemoveResource(&resources[0]) == false);
+        REQUIRE(stateTable.GetStateCount(&resources[0]) == 0U);
+
+        // The address can be added again, for example, by a new resource
+        stateTable.AddResource(&resources[0], D3D12_RESOURCE_STATE_RENDER_TARGET, 1U);
+        stateTable.AddResource(&resources[2], D3D12_RESOURCE_STATE_DEPTH_WRITE, 2U);
+        REQUIRE(stateTable.GetState(&resources[0], 0U) == D3D12_RESOURCE_STATE_RENDER_TARGET);
+        REQUIRE(stateTable.GetState(&resources[1], 0U) == D3D12_RESOURCE_STATE_COMMON);
+        REQUIRE(stateTable.GetState(&resources[2], 0U) == D3D12_RESOURCE_STATE_DEPTH_WRITE);
+        REQUIRE(stateTable.GetState(&resources[2], 1U) == D3D12_RESOURCE_STATE_DEPTH_WRITE);
+    }
+
+    SECTION("Resources with many states are added to new chunks")
+    {
+        std::vector<std::uint8_t> manyResources(64U);
+        for (std::uint32_t i = 0U; i < manyResources.size(); ++i) {
+            stateTable.AddResource(&manyResources[i], D3D12_RESOURCE_STATE_COMMON, 1000U);
+        }
+
+        D3D12_RESOURCE_STATES oldState{ D3D12_RESOURCE_STATE_COMMON };
+        for (std::uint32_t i = 0U; i < manyResources.size(); ++i) {
+            REQUIRE(stateTable.ChangeStateIfNeeded(&manyResources[i], 999U, D3D12_RESOURCE_STATE_RENDER_TARGET, oldState));
+        }
+        for (std::uint32_t i = 0U; i < manyResources.size(); ++i) {
+            REQUIRE(stateTable.GetState(&manyResources[i], 998U) == D3D12_RESOURCE_STATE_COMMON);
+            REQUIRE(stateTable.GetState(&manyResources[i], 999U) == D3D12_RESOURCE_STATE_RENDER_TARGET);
+        }
+    }
+
+    SECTION("Only a thread changes a state when several threads request the same transition")
+    {
+        stateTable.AddResource(&resources[0], D3D12_RESOURCE_STATE_COMMON, 1U);
+
+        const std::uint32_t threadCount = 4U;
+        const std::uint32_t iterationCount = 10000U;
+        std::atomic<std::uint32_t> changeCount{ 0U };
+        std::atomic<bool> hasWrongOldState{ false };
+        std::vector<std::thread> threads;
+        for (std::uint32_t i = 0U; i < threadCount; ++i) {
+            threads.emplace_back([&stateTable, &resources, &changeCount, &hasWrongOldState]() {
+                D3D12_RESOURCE_STATES oldState{ D3D12_RESOURCE_STATE_COMMON };
+                for (std::uint32_t j = 0U; j < iterationCount; ++j) {
+                    const D3D12_RESOURCE_STATES newState = (j % 2U) == 0U
+                        ? D3D12_RESOURCE_STATE_RENDER_TARGET
+                        : D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+                    if (stateTable.ChangeStateIfNeeded(&resources[0], 0U, newState, oldState)) {
+                        hasWrongOldState = hasWrongOldState || oldState == newState;
+                        ++changeCount;
+                    }
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        // Each change alternates the state, so the number of changes determines the final state.
+        const D3D12_RESOURCE_STATES finalState = stateTable.GetState(&resources[0], 0U);
+        REQUIRE(hasWrongOldState == false);
+        REQUIRE(changeCount > 0U);
+        REQUIRE(finalState == ((changeCount % 2U) == 1U ? D3D12_RESOURCE_STATE_RENDER_TARGET : D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE));
+    }
+
+    SECTION("Clear removes all the resources")
+    {
+        stateTable.AddResource(&resources[0], D3D12_RESOURCE_STATE_COMMON, 1U);
+        stateTable.AddResource(&resources[1], D3D12_RESOURCE_STATE_COMMON, 4U);
+        stateTable.Clear();
+
+        REQUIRE(stateTable.GetStateCount(&resources[0]) == 0U);
+        REQUIRE(stateTable.GetStateCount(&resources[1]) == 0U);
+
+        stateTable.AddResource(&resources[1], D3D12_RESOURCE_STATE_RENDER_TARGET, 1U);
+        REQUIRE(stateTable.GetState(&resources[1], 0U) == D3D12_RESOURCE_STATE_RENDER_TARGET);
+    }
+}
+
+// Time per call with 1, 2, 4... recorder threads. Recorder counts above the number
+// of hardware threads time-slice the same cores, so they measure contention, not scaling.
+TEST_CASE("ResourceStateTable transitions per recorder count", "[.benchmark]")
+{
+    const std::uint32_t maxRecorderCount = std::max(std::thread::hardware_concurrency(), 4U);
+    const std::uint32_t ownResourceCountPerRecorder = 32U;
+    const std::uint32_t frameCount = 20000U;
+
+    std::vector<std::uint8_t> sharedResources(8U);
+    std::vector<std::uint8_t> ownResources(maxRecorderCount * ownResourceCountPerRecorder);
+
+    for (std::uint32_t recorderCount = 1U; recorderCount <= maxRecorderCount; recorderCount *= 2U) {
+        BRE::ResourceStateTable stateTable;
+        ExclusiveAccessorStates exclusiveAccessorStates;
+        for (const std::uint8_t& resource : sharedResources) {
+            stateTable.AddResource(&resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, 1U);
+            exclusiveAccessorStates.AddResource(&resource, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        }
+        for (std::uint32_t i = 0U; i < recorderCount * ownResourceCountPerRecorder; ++i) {
+            stateTable.AddResource(&ownResources[i], D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, 1U);
+            exclusiveAccessorStates.AddResource(&ownResources[i], D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        }
+
+        ResourceStateTableStates stateTableStates(stateTable);
+        const std::int64_t exclusiveAccessorTime = MeasureTransitions(exclusiveAccessorStates,
+                                                                      ownResources,
+                                                                      ownResourceCountPerRecorder,
+                                                                      sharedResources,
+                                                                      recorderCount,
+                                                                      frameCount);
+        const std::int64_t stateTableTime = MeasureTransitions(stateTableStates,
+                                                               ownResources,
+                                                               ownResourceCountPerRecorder,
+                                                               sharedResources,
+                                                               recorderCount,
+                                                               frameCount);
+
+        std::ostringstream stream;
+        stream << recorderCount << " recorders, " << std::thread::hardware_concurrency() << " hardware threads: "
+            << "exclusive accessors " << exclusiveAccessorTime << " ns per call, "
+            << "ResourceStateTable " << stateTableTime << " ns per call";
+        WARN(stream.str());
+    }
+}
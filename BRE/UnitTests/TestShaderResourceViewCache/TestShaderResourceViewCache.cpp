@@ -0,0 +1,82 @@
+#include <UnitTests\Catch.h>
+
+#include <DescriptorManager\ShaderResourceViewCache.h>
+
+namespace {
+D3D12_SHADER_RESOURCE_VIEW_DESC
+CreateDescriptor(const std::uint32_t mipLevels)
+{
+    D3D12_SHADER_RESOURCE_VIEW_DESC descriptor{};
+    descriptor.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    descriptor.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
+    descriptor.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    descriptor.Texture2D.MipLevels = mipLevels;
+
+    return descriptor;
+}
+}
+
+TEST_CASE("ShaderResourceViewCache")
+{
+    BRE::ShaderResourceViewCache cache(3U);
+    const std::uint32_t invalidIndex = BRE::ShaderResourceViewCache::sInvalidIndex;
+    const int resources[3U]{};
+    const D3D12_SHADER_RESOURCE_VIEW_DESC descriptor = CreateDescriptor(1U);
+    bool isNewView;
+
+    SECTION("The same resource and descriptor share a view")
+    {
+        const std::uint32_t index = cache.AcquireView(&resources[0U], descriptor, isNewView);
+        REQUIRE(isNewView);
+        REQUIRE(cache.AcquireView(&resources[0U], descriptor, isNewView) == index);
+        REQUIRE(isNewView == false);
+        REQUIRE(cache.GetReferenceCount(index) == 2U);
+        REQUIRE(cache.GetViewCount() == 1U);
+    }
+
+    SECTION("Different resources or descriptors get different views")
+    {
+        const std::uint32_t first = cache.AcquireView(&resources[0U], descriptor, isNewView);
+        const std::uint32_t second = cache.AcquireView(&resources[1U], descriptor, isNewView);
+        REQUIRE(isNewView);
+        const std::uint32_t third = cache.AcquireView(&resources[0U], CreateDescriptor(2U), isNewView);
+        REQUIRE(isNewView);
+        REQUIRE(first != second);
+        REQUIRE(first != third);
+        REQUIRE(second != third);
+        REQUIRE(cache.GetViewCount() == 3U);
+        REQUIRE(cache.AcquireView(&resources[2U], descriptor, isNewView) == invalidIndex);
+        REQUIRE(isNewView == false);
+    }
+
+    SECTION("A view is freed when its last reference is released")
+    {
+        const std::uint32_t index = cache.AcquireView(&resources[0U], descriptor, isNewView);
+        cache.AcquireView(&resources[0U], descriptor, isNewView);
+        REQUIRE(cache.ReleaseView(index) == false);
+        REQUIRE(cache.GetViewCount() == 1U);
+        REQUIRE(cache.ReleaseView(index));
+        REQUIRE(cache.GetViewCount() == 0U);
+        REQUIRE(cache.GetReferenceCount(index) == 0U);
+
+        REQUIRE(cache.AcquireView(&resources[1U], descriptor, isNewView) == index);
+        REQUIRE(isNewView);
+    }
+
+    SECTION("Removing a resource frees all its views")
+    {
+        const std::uint32_t first = cache.AcquireView(&resources[0U], descriptor, isNewView);
+        cache.AcquireView(&resources[0U], descriptor, isNewView);
+        const std::uint32_t second = cache.AcquireView(&resources[0U], CreateDescriptor(2U), isNewView);
+        const std::uint32_t other = cache.AcquireView(&resources[1U], descriptor, isNewView);
+
+        REQUIRE(cache.RemoveResourceViews(&resources[0U]) == 2U);
+        REQUIRE(cache.RemoveResourceViews(&resources[0U]) == 0U);
+        REQUIRE(cache.GetViewCount() == 1U);
+        REQUIRE(cache.GetReferenceCount(other) == 1U);
+
+        const std::uint32_t index = cache.AcquireView(&resources[0U], descriptor, isNewView);
+        REQUIRE(isNewView);
+        REQUIRE((index == first || index == second));
+    }
+}
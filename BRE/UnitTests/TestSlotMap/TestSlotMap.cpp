@@ -0,0 +1,128 @@
+#include <UnitTests\Catch.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <Utils\SlotMap.h>
+
+namespace {
+///
+/// @brief Item that counts its releases
+///
+struct Item {
+    std::uint32_t mValue{ 0U };
+    std::uint32_t mReleaseCount{ 0U };
+};
+}
+
+TEST_CASE("SlotMap")
+{
+    BRE::SlotMap<Item> slotMap;
+    Item items[4];
+    const auto releaseItem = [](Item& item) {
+        ++item.mReleaseCount;
+    };
+
+    SECTION("Inserted items can be found by their handles")
+    {
+        const BRE::SlotMapHandle firstHandle = slotMap.Insert(items[0]);
+        const BRE::SlotMapHandle secondHandle = slotMap.Insert(items[1]);
+
+        REQUIRE(firstHandle != secondHandle);
+        REQUIRE(slotMap.Get(firstHandle) == &items[0]);
+        REQUIRE(slotMap.Get(secondHandle) == &items[1]);
+        REQUIRE(slotMap.Get(BRE::SlotMap<Item>::sInvalidHandle) == nullptr);
+        REQUIRE(slotMap.GetItemCount() == 2U);
+    }
+
+    SECTION("Removed handles are not valid, even if their slots are reused")
+    {
+        const BRE::SlotMapHandle firstHandle = slotMap.Insert(items[0]);
+        REQUIRE(slotMap.Remove(firstHandle) == &items[0]);
+        REQUIRE(slotMap.Get(firstHandle) == nullptr);
+        REQUIRE(slotMap.Remove(firstHandle) == nullptr);
+
+        const BRE::SlotMapHandle secondHandle = slotMap.Insert(items[1]);
+        REQUIRE(secondHandle != firstHandle);
+        REQUIRE(slotMap.Get(firstHandle) == nullptr);
+        REQUIRE(slotMap.Get(secondHandle) == &items[1]);
+        REQUIRE(slotMap.GetItemCount() == 1U);
+    }
+
+    SECTION("Removed items are released when their release value completes")
+    {
+        const BRE::SlotMapHandle firstHandle = slotMap.Insert(items[0]);
+        const BRE::SlotMapHandle secondHandle = slotMap.Insert(items[1]);
+        std::uint64_t completedValue = 0UL;
+        const auto isComplete = [&completedValue](const std::uint64_t value) {
+            return value <= completedValue;
+        };
+
+        slotMap.Remove(firstHandle);
+        REQUIRE(slotMap.ReleaseRemovedItems(1UL, isComplete, releaseItem) == 0U);
+        REQUIRE(items[0].mReleaseCount == 0U);
+
+        slotMap.Remove(secondHandle);
+        REQUIRE(slotMap.ReleaseRemovedItems(2UL, isComplete, releaseItem) == 0U);
+
+        completedValue = 1UL;
+        REQUIRE(slotMap.ReleaseRemovedItems(3UL, isComplete, releaseItem) == 1U);
+        REQUIRE(items[0].mReleaseCount == 1U);
+        REQUIRE(items[1].mReleaseCount == 0U);
+
+        completedValue = 2UL;
+        REQUIRE(slotMap.ReleaseRemovedItems(4UL, isComplete, releaseItem) == 1U);
+        REQUIRE(items[1].mReleaseCount == 1U);
+    }
+
+    SECTION("Clear releases all the items once")
+    {
+        const BRE::SlotMapHandle firstHandle = slotMap.Insert(items[0]);
+        slotMap.Insert(items[1]);
+        const BRE::SlotMapHandle thirdHandle = slotMap.Insert(items[2]);
+        slotMap.Remove(firstHandle);
+        slotMap.Remove(thirdHandle);
+        slotMap.ReleaseRemovedItems(1UL, [](const std::uint64_t) { return false; }, releaseItem);
+        slotMap.Insert(items[3]);
+
+        slotMap.Clear(releaseItem);
+
+        for (const Item& item : items) {
+            REQUIRE(item.mReleaseCount == 1U);
+        }
+        REQUIRE(slotMap.GetItemCount() == 0U);
+    }
+
+    SECTION("Items can be found while other threads insert and remove items")
+    {
+        const std::uint32_t itemCount = 4096U;
+        std::vector<Item> stableItems(itemCount);
+        std::vector<BRE::SlotMapHandle> stableHandles;
+        for (std::uint32_t i = 0U; i < itemCount; ++i) {
+            stableItems[i].mValue = i;
+            stableHandles.push_back(slotMap.Insert(stableItems[i]));
+        }
+
+        std::atomic<bool> isDone{ false };
+        std::vector<Item> temporaryItems(itemCount);
+        std::thread writerThread([&slotMap, &temporaryItems, &isDone]() {
+            for (Item& temporaryItem : temporaryItems) {
+                slotMap.Remove(slotMap.Insert(temporaryItem));
+            }
+            isDone = true;
+        });
+
+        bool allFound = true;
+        while (isDone == false) {
+            for (std::uint32_t i = 0U; i < itemCount; ++i) {
+                const Item* item = slotMap.Get(stableHandles[i]);
+                allFound = allFound && item != nullptr && item->mValue == i;
+            }
+        }
+        writerThread.join();
+
+        REQUIRE(allFound);
+        REQUIRE(slotMap.GetItemCount() == itemCount);
+    }
+}
@@ -0,0 +1,46 @@
+#include <UnitTests\Catch.h>
+
+#include <DescriptorManager\TransientDescriptorRing.h>
+
+TEST_CASE("TransientDescriptorRing")
+{
+    BRE::TransientDescriptorRing ring(100U, 10U, 3U);
+    const std::uint32_t invalidOffset = BRE::TransientDescriptorRing::sInvalidOffset;
+
+    SECTION("Allocations are linear in the partition of the current frame")
+    {
+        REQUIRE(ring.Allocate(4U) == 100U);
+        REQUIRE(ring.Allocate(6U) == 104U);
+        REQUIRE(ring.Allocate(1U) == invalidOffset);
+    }
+
+    SECTION("A failed allocation does not consume descriptors")
+    {
+        REQUIRE(ring.Allocate(8U) == 100U);
+        REQUIRE(ring.Allocate(3U) == invalidOffset);
+        REQUIRE(ring.Allocate(2U) == 108U);
+    }
+
+    SECTION("Each frame uses the next partition and partitions are reused after frameCount frames")
+    {
+        ring.Allocate(5U);
+        REQUIRE(ring.EndFrame(1UL) == 0UL);
+        REQUIRE(ring.Allocate(1U) == 110U);
+        REQUIRE(ring.EndFrame(2UL) == 0UL);
+        REQUIRE(ring.Allocate(1U) == 120U);
+
+        // The first partition is reused, once the fence value of its frame completes.
+        REQUIRE(ring.EndFrame(3UL) == 1UL);
+        REQUIRE(ring.Allocate(10U) == 100U);
+        REQUIRE(ring.EndFrame(4UL) == 2UL);
+    }
+
+    SECTION("The maximum number of descriptors allocated in a frame is tracked")
+    {
+        ring.Allocate(7U);
+        ring.EndFrame(1UL);
+        ring.Allocate(3U);
+        ring.EndFrame(2UL);
+        REQUIRE(ring.GetMaxAllocatedDescriptorCountPerFrame() == 7U);
+    }
+}
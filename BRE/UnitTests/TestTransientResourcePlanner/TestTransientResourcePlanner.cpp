@@ -0,0 +1,67 @@
+#include <UnitTests\Catch.h>
+
+#include <ResourceManager\TransientResourcePlanner.h>
+
+TEST_CASE("TransientResourcePlanner")
+{
+    BRE::TransientResourcePlanner planner;
+
+    SECTION("Resources with disjoint lifetimes share memory")
+    {
+        const std::uint32_t first = planner.AddResource(100UL, 1UL, 0U, 1U);
+        const std::uint32_t second = planner.AddResource(100UL, 1UL, 2U, 3U);
+        planner.Solve();
+
+        REQUIRE(planner.GetOffset(first) == 0UL);
+        REQUIRE(planner.GetOffset(second) == 0UL);
+        REQUIRE(planner.GetHeapSize() == 100UL);
+        REQUIRE(planner.GetResourceSize() == 200UL);
+        REQUIRE(planner.IsAliased(first));
+        REQUIRE(planner.IsAliased(second));
+    }
+
+    SECTION("Resources with overlapping lifetimes do not share memory")
+    {
+        const std::uint32_t first = planner.AddResource(100UL, 1UL, 0U, 2U);
+        const std::uint32_t second = planner.AddResource(100UL, 1UL, 2U, 3U);
+        planner.Solve();
+
+        REQUIRE(planner.GetOffset(first) == 0UL);
+        REQUIRE(planner.GetOffset(second) == 100UL);
+        REQUIRE(planner.GetHeapSize() == 200UL);
+        REQUIRE(planner.IsAliased(first) == false);
+        REQUIRE(planner.IsAliased(second) == false);
+    }
+
+    SECTION("Offsets are aligned")
+    {
+        const std::uint32_t first = planner.AddResource(100UL, 64UL, 0U, 0U);
+        const std::uint32_t second = planner.AddResource(10UL, 64UL, 0U, 0U);
+        planner.Solve();
+
+        REQUIRE(planner.GetOffset(first) == 0UL);
+        REQUIRE(planner.GetOffset(second) == 128UL);
+        REQUIRE(planner.GetHeapSize() == 138UL);
+    }
+
+    SECTION("Small resources fill the gaps of larger resources")
+    {
+        // A frame with the passes 0 to 3
+        const std::uint32_t large = planner.AddResource(400UL, 1UL, 0U, 1U);
+        const std::uint32_t medium = planner.AddResource(300UL, 1UL, 1U, 3U);
+        const std::uint32_t smallA = planner.AddResource(150UL, 1UL, 2U, 2U);
+        const std::uint32_t smallB = planner.AddResource(150UL, 1UL, 3U, 3U);
+        const std::uint32_t smallC = planner.AddResource(200UL, 1UL, 2U, 3U);
+        planner.Solve();
+
+        REQUIRE(planner.GetOffset(large) == 0UL);
+        REQUIRE(planner.GetOffset(medium) == 400UL);
+        REQUIRE(planner.GetOffset(smallC) == 0UL);
+        REQUIRE(planner.GetOffset(smallA) == 200UL);
+        REQUIRE(planner.GetOffset(smallB) == 200UL);
+        REQUIRE(planner.GetHeapSize() == 700UL);
+        REQUIRE(planner.GetResourceSize() == 1200UL);
+        REQUIRE(planner.IsAliased(medium) == false);
+        REQUIRE(planner.IsAliased(smallA));
+    }
+}
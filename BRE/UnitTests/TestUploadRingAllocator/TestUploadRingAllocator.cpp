@@ -0,0 +1,54 @@
+#include <UnitTests\Catch.h>
+
+#include <ResourceManager\UploadRingAllocator.h>
+
+TEST_CASE("UploadRingAllocator")
+{
+    BRE::UploadRingAllocator ring(1024UL, 3U);
+    const std::size_t invalidOffset = BRE::UploadRingAllocator::sInvalidOffset;
+
+    SECTION("Allocations are linear and aligned in the partition of the current frame")
+    {
+        REQUIRE(ring.Allocate(100UL, 256UL) == 0UL);
+        REQUIRE(ring.Allocate(100UL, 256UL) == 256UL);
+        REQUIRE(ring.Allocate(8UL, 4UL) == 356UL);
+        REQUIRE(ring.Allocate(512UL, 256UL) == 512UL);
+        REQUIRE(ring.Allocate(1UL, 1UL) == invalidOffset);
+    }
+
+    SECTION("A failed allocation does not consume memory and it is counted as an overflow")
+    {
+        REQUIRE(ring.Allocate(900UL, 256UL) == 0UL);
+        REQUIRE(ring.Allocate(200UL, 256UL) == invalidOffset);
+        REQUIRE(ring.Allocate(100UL, 4UL) == 900UL);
+
+        const BRE::UploadRingAllocator::Statistics statistics = ring.GetStatistics();
+        REQUIRE(statistics.mSizePerFrame == 1024UL);
+        REQUIRE(statistics.mAllocatedSize == 1000UL);
+        REQUIRE(statistics.mOverflowCount == 1U);
+    }
+
+    SECTION("Each frame uses the next partition and partitions are reused after frameCount frames")
+    {
+        ring.Allocate(256UL, 256UL);
+        REQUIRE(ring.EndFrame(1UL) == 0UL);
+        REQUIRE(ring.Allocate(1UL, 256UL) == 1024UL);
+        REQUIRE(ring.EndFrame(2UL) == 0UL);
+        REQUIRE(ring.Allocate(1UL, 256UL) == 2048UL);
+
+        // The first partition is reused, once the fence value of its frame completes.
+        REQUIRE(ring.EndFrame(3UL) == 1UL);
+        REQUIRE(ring.Allocate(1024UL, 256UL) == 0UL);
+        REQUIRE(ring.EndFrame(4UL) == 2UL);
+    }
+
+    SECTION("The maximum size allocated in a frame is tracked")
+    {
+        ring.Allocate(700UL, 256UL);
+        ring.EndFrame(1UL);
+        ring.Allocate(300UL, 256UL);
+        ring.EndFrame(2UL);
+        REQUIRE(ring.GetStatistics().mMaxAllocatedSizePerFrame == 700UL);
+        REQUIRE(ring.GetStatistics().mAllocatedSize == 0UL);
+    }
+}
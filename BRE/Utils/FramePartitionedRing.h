@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+///
+/// @brief Linear allocator of a ring partitioned by frame.
+///
+/// The ring has a partition per queued frame. Allocations of the current frame are
+/// sub-allocated linearly from its partition, and the whole partition is reclaimed when
+/// the GPU finishes the frame that used it (there is not a per-allocation free).
+/// It works over offsets in abstract units (bytes, descriptors, etc), so it does not
+/// depend on the device. It is the bookkeeping of the upload and transient descriptor rings.
+///
+template<typename T>
+class FramePartitionedRing {
+public:
+    // Offset returned by Allocate() when the partition of the current frame is full.
+    static const T sInvalidOffset{ std::numeric_limits<T>::max() };
+
+    ///
+    /// @brief FramePartitionedRing constructor
+    /// @param firstOffset The offset of the first unit of the ring
+    /// @param sizePerFrame The number of units of each partition
+    /// @param frameCount The number of partitions. It must be greater than zero.
+    ///
+    FramePartitionedRing(const T firstOffset,
+                         const T sizePerFrame,
+                         const std::uint32_t frameCount)
+        : mFirstOffset(firstOffset)
+        , mSizePerFrame(sizePerFrame)
+        , mFenceValueByFrame(frameCount, 0UL)
+    {
+        BRE_ASSERT(frameCount > 0U);
+    }
+
+    ~FramePartitionedRing() = default;
+    FramePartitionedRing(const FramePartitionedRing&) = delete;
+    const FramePartitionedRing& operator=(const FramePartitionedRing&) = delete;
+    FramePartitionedRing(FramePartitionedRing&&) = delete;
+    FramePartitionedRing& operator=(FramePartitionedRing&&) = delete;
+
+    ///
+    /// @brief Allocate units in the partition of the current frame.
+    ///
+    /// This method is thread safe and lock free.
+    ///
+    /// @param size The number of units. It must be greater than zero.
+    /// @param alignment Alignment of the allocation relative to the beginning of its partition.
+    /// It must be a power of two.
+    /// @return The offset of the allocation, or sInvalidOffset if the partition is full.
+    ///
+    T Allocate(const T size,
+               const T alignment) noexcept
+    {
+        BRE_ASSERT(size > 0U);
+        BRE_ASSERT(alignment > 0U && (alignment & (alignment - 1U)) == 0U);
+
+        T allocatedSize = mAllocatedSize.load(std::memory_order_relaxed);
+        T alignedOffset;
+        do {
+            alignedOffset = (allocatedSize + alignment - 1U) & ~(alignment - 1U);
+            if (alignedOffset > mSizePerFrame || mSizePerFrame - alignedOffset < size) {
+                return sInvalidOffset;
+            }
+        } while (mAllocatedSize.compare_exchange_weak(allocatedSize,
+                                                      alignedOffset + size,
+                                                      std::memory_order_relaxed) == false);
+
+        return mFirstOffset + static_cast<T>(mCurrentFrameIndex) * mSizePerFrame + alignedOffset;
+    }
+
+    ///
+    /// @brief End the current frame and begin the next one.
+    ///
+    /// The partition of the current frame is tagged with @p fenceValue, and the
+    /// next partition becomes the current one. It must not be called while other
+    /// threads allocate.
+    ///
+    /// @param fenceValue Fence value signaled at the end of the current frame
+    /// @return The fence value that must complete before allocating
+    /// in the new current partition. Zero if the partition was not used yet.
+    ///
+    std::uint64_t EndFrame(const std::uint64_t fenceValue) noexcept
+    {
+        const T allocatedSize = mAllocatedSize.load(std::memory_order_relaxed);
+        if (allocatedSize > mMaxAllocatedSize) {
+            mMaxAllocatedSize = allocatedSize;
+        }
+
+        mFenceValueByFrame[mCurrentFrameIndex] = fenceValue;
+        mCurrentFrameIndex = (mCurrentFrameIndex + 1U) % static_cast<std::uint32_t>(mFenceValueByFrame.size());
+        mAllocatedSize.store(0U, std::memory_order_relaxed);
+
+        return mFenceValueByFrame[mCurrentFrameIndex];
+    }
+
+    ///
+    /// @brief Get the number of units of each partition
+    /// @return Number of units
+    ///
+    T GetSizePerFrame() const noexcept
+    {
+        return mSizePerFrame;
+    }
+
+    ///
+    /// @brief Get the number of units allocated in the current frame
+    /// @return Number of units
+    ///
+    T GetAllocatedSize() const noexcept
+    {
+        return mAllocatedSize.load(std::memory_order_relaxed);
+    }
+
+    ///
+    /// @brief Get the maximum number of units allocated in a frame
+    ///
+    /// It can be used to size the partitions.
+    ///
+    /// @return The maximum number of units
+    ///
+    T GetMaxAllocatedSizePerFrame() const noexcept
+    {
+        return mMaxAllocatedSize;
+    }
+
+private:
+    T mFirstOffset{ 0U };
+    T mSizePerFrame{ 0U };
+
+    std::uint32_t mCurrentFrameIndex{ 0U };
+    std::atomic<T> mAllocatedSize{ 0U };
+    T mMaxAllocatedSize{ 0U };
+
+    std::vector<std::uint64_t> mFenceValueByFrame;
+};
+
+template<typename T>
+const T FramePartitionedRing<T>::sInvalidOffset;
+}
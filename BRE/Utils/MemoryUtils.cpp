@@ -0,0 +1,139 @@
+#include "MemoryUtils.h"
+
+#include <cstring>
+#include <immintrin.h>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+namespace MemoryUtils {
+namespace {
+const std::size_t sCacheLineSize{ 64UL };
+
+///
+/// @brief Copy data with a 16 bytes non-temporal store
+/// @param destination Destination. It must be 16 bytes aligned.
+/// @param source Source
+///
+void
+StreamData16(std::uint8_t* destination,
+             const std::uint8_t* source) noexcept
+{
+    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(destination), data);
+}
+
+///
+/// @brief Copy data with non-temporal stores, without fencing them
+/// @param destination Destination
+/// @param source Source
+/// @param size Size in bytes
+///
+void
+StreamData(std::uint8_t* destination,
+           const std::uint8_t* source,
+           std::size_t size) noexcept
+{
+    // Bytes before the first 16 bytes aligned store
+    const std::size_t misalignment = reinterpret_cast<std::uintptr_t>(destination) & (sizeof(__m128i) - 1UL);
+    if (misalignment != 0UL) {
+        const std::size_t headSize = sizeof(__m128i) - misalignment < size ? sizeof(__m128i) - misalignment : size;
+        memcpy(destination, source, headSize);
+        destination += headSize;
+        source += headSize;
+        size -= headSize;
+    }
+
+    // 16 bytes stores up to the first cache line boundary
+    while (size >= sizeof(__m128i) && (reinterpret_cast<std::uintptr_t>(destination) & (sCacheLineSize - 1UL)) != 0UL) {
+        StreamData16(destination, source);
+        destination += sizeof(__m128i);
+        source += sizeof(__m128i);
+        size -= sizeof(__m128i);
+    }
+
+    // A full, aligned cache line per iteration, so write-combining buffers are flushed complete.
+    // Source can be unaligned.
+    while (size >= sCacheLineSize) {
+#ifdef __AVX__
+        const __m256i data0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+        const __m256i data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + 32UL));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination), data0);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(destination + 32UL), data1);
+#else
+        const __m128i data0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        const __m128i data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 16UL));
+        const __m128i data2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 32UL));
+        const __m128i data3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + 48UL));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination), data0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination + 16UL), data1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination + 32UL), data2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(destination + 48UL), data3);
+#endif
+        destination += sCacheLineSize;
+        source += sCacheLineSize;
+        size -= sCacheLineSize;
+    }
+
+    while (size >= sizeof(__m128i)) {
+        StreamData16(destination, source);
+        destination += sizeof(__m128i);
+        source += sizeof(__m128i);
+        size -= sizeof(__m128i);
+    }
+
+    // Bytes after the last aligned store
+    if (size > 0UL) {
+        memcpy(destination, source, size);
+    }
+}
+}
+
+void
+CopyToWriteCombinedMemory(void* destination,
+                          const void* source,
+                          const std::size_t size) noexcept
+{
+    BRE_ASSERT(destination != nullptr);
+    BRE_ASSERT(source != nullptr);
+
+    StreamData(reinterpret_cast<std::uint8_t*>(destination),
+               reinterpret_cast<const std::uint8_t*>(source),
+               size);
+
+    // Non-temporal stores are weakly ordered
+    _mm_sfence();
+}
+
+void
+CopyToWriteCombinedMemory(void* destination,
+                          const std::size_t destinationStride,
+                          const void* source,
+                          const std::size_t sourceStride,
+                          const std::size_t elementSize,
+                          const std::uint32_t elementCount) noexcept
+{
+    BRE_ASSERT(destination != nullptr);
+    BRE_ASSERT(source != nullptr);
+    BRE_ASSERT(destinationStride >= elementSize);
+
+    std::uint8_t* destinationElement = reinterpret_cast<std::uint8_t*>(destination);
+    const std::uint8_t* sourceElement = reinterpret_cast<const std::uint8_t*>(source);
+
+    // Packed elements are copied as a single block
+    if (destinationStride == elementSize && sourceStride == elementSize) {
+        StreamData(destinationElement, sourceElement, elementSize * elementCount);
+    } else {
+        for (std::uint32_t i = 0U; i < elementCount; ++i) {
+            StreamData(destinationElement, sourceElement, elementSize);
+            destinationElement += destinationStride;
+            sourceElement += sourceStride;
+        }
+    }
+
+    // Non-temporal stores are weakly ordered
+    _mm_sfence();
+}
+}
+}
+
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace BRE {
+namespace MemoryUtils {
+///
+/// @brief Copy data to write-combined memory (like mapped upload heaps)
+///
+/// The destination is written with aligned non-temporal (streaming) stores,
+/// that do not read the destination cache lines nor pollute the cache.
+/// The destination must not be read by the CPU, because write-combined memory is uncached.
+///
+/// @param destination Destination. It must not be nullptr.
+/// @param source Source. It must not be nullptr, and it must not overlap @p destination.
+/// @param size Size in bytes of the data to copy
+///
+void CopyToWriteCombinedMemory(void* destination,
+                               const void* source,
+                               const std::size_t size) noexcept;
+
+///
+/// @brief Copy strided elements to write-combined memory
+///
+/// It is equivalent to call CopyToWriteCombinedMemory() for each element,
+/// but the stores are only fenced once.
+///
+/// @param destination Destination of the first element. It must not be nullptr.
+/// @param destinationStride Distance in bytes between consecutive elements in @p destination.
+/// It must be greater or equal than @p elementSize
+/// @param source Source of the first element. It must not be nullptr.
+/// @param sourceStride Distance in bytes between consecutive elements in @p source
+/// @param elementSize Size in bytes of the data to copy per element
+/// @param elementCount Number of elements to copy
+///
+void CopyToWriteCombinedMemory(void* destination,
+                               const std::size_t destinationStride,
+                               const void* source,
+                               const std::size_t sourceStride,
+                               const std::size_t elementSize,
+                               const std::uint32_t elementCount) noexcept;
+}
+}
+
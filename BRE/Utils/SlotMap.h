@@ -0,0 +1,287 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <Utils\DebugUtils.h>
+
+namespace BRE {
+///
+/// @brief Handle of an item in a SlotMap.
+///
+/// The lower bits are the slot index, and the upper bits are the generation
+/// of the slot when the item was inserted.
+///
+using SlotMapHandle = std::uint32_t;
+
+///
+/// @brief Container of pointers that are identified by generational handles
+///
+/// Handles are stable while the item is in the map. When an item is removed, the generation
+/// of its slot is incremented, so its handle is not valid anymore, even if the slot is reused.
+/// Slots are stored in fixed size chunks that are never moved, so Get() does not lock.
+/// Insert() and Remove() are serialized by a mutex.
+///
+/// Removed items are not released immediately, because the GPU can still use them.
+/// They are released by ReleaseRemovedItems(), once their release value completes.
+///
+template<typename T>
+class SlotMap {
+public:
+    static const SlotMapHandle sInvalidHandle{ 0xFFFFFFFFU };
+
+    SlotMap() = default;
+    ~SlotMap()
+    {
+        for (std::atomic<Slot*>& chunk : mChunks) {
+            delete[] chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    SlotMap(const SlotMap&) = delete;
+    const SlotMap& operator=(const SlotMap&) = delete;
+    SlotMap(SlotMap&&) = delete;
+    SlotMap& operator=(SlotMap&&) = delete;
+
+    ///
+    /// @brief Insert an item
+    ///
+    /// This method is thread safe.
+    ///
+    /// @param item Item. It must not be in the map.
+    /// @return Handle of the item
+    ///
+    SlotMapHandle Insert(T& item) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        std::uint32_t slotIndex = 0U;
+        if (mFreeSlotIndices.empty() == false) {
+            slotIndex = mFreeSlotIndices.back();
+            mFreeSlotIndices.pop_back();
+        } else {
+            BRE_CHECK_MSG(mSlotCount < sMaxSlotCount, L"Slot map is full");
+            slotIndex = mSlotCount;
+            Slot* chunk = mChunks[slotIndex / sChunkSlotCount].load(std::memory_order_relaxed);
+            if (chunk == nullptr) {
+                chunk = new Slot[sChunkSlotCount];
+                mChunks[slotIndex / sChunkSlotCount].store(chunk, std::memory_order_release);
+            }
+            ++mSlotCount;
+        }
+
+        Slot& slot = GetSlot(slotIndex);
+        slot.mItem.store(&item, std::memory_order_release);
+        ++mItemCount;
+
+        return (slot.mGeneration.load(std::memory_order_relaxed) << sIndexBitCount) | slotIndex;
+    }
+
+    ///
+    /// @brief Get an item
+    ///
+    /// This method is thread safe and does not lock.
+    ///
+    /// @param handle Handle returned by Insert()
+    /// @return The item, or nullptr if @p handle is not valid or its item was removed.
+    ///
+    T* Get(const SlotMapHandle handle) const noexcept
+    {
+        const std::uint32_t slotIndex = handle & sIndexMask;
+        const std::uint32_t generation = handle >> sIndexBitCount;
+        if (slotIndex >= sMaxSlotCount) {
+            return nullptr;
+        }
+
+        const Slot* chunk = mChunks[slotIndex / sChunkSlotCount].load(std::memory_order_acquire);
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+
+        // The generation is checked again after reading the item, because the slot
+        // can be removed and reused in between.
+        const Slot& slot = chunk[slotIndex % sChunkSlotCount];
+        if (slot.mGeneration.load(std::memory_order_acquire) != generation) {
+            return nullptr;
+        }
+        T* item = slot.mItem.load(std::memory_order_acquire);
+        if (slot.mGeneration.load(std::memory_order_acquire) != generation) {
+            return nullptr;
+        }
+
+        return item;
+    }
+
+    ///
+    /// @brief Remove an item
+    ///
+    /// The handle is not valid after this call, but the item is only released
+    /// by ReleaseRemovedItems(). This method is thread safe.
+    ///
+    /// @param handle Handle returned by Insert()
+    /// @return The removed item, or nullptr if @p handle is not valid.
+    ///
+    T* Remove(const SlotMapHandle handle) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        T* item = Get(handle);
+        if (item == nullptr) {
+            return nullptr;
+        }
+
+        const std::uint32_t slotIndex = handle & sIndexMask;
+        FreeSlot(slotIndex);
+        mRemovedItems.push_back(item);
+
+        return item;
+    }
+
+    ///
+    /// @brief Release the removed items whose release value completed
+    ///
+    /// Items removed since the last call are tagged with @p releaseValue.
+    /// This method is thread safe.
+    ///
+    /// @param releaseValue Value that must complete before the items removed since
+    /// the last call can be released (for example, the fence value of the current frame).
+    /// Values must be passed in increasing order.
+    /// @param isComplete Function that returns true if a release value completed.
+    /// @param release Function that releases an item
+    /// @return The number of released items
+    ///
+    template<typename IsCompleteFunction, typename ReleaseFunction>
+    std::uint32_t ReleaseRemovedItems(const std::uint64_t releaseValue,
+                                      IsCompleteFunction isComplete,
+                                      ReleaseFunction release) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        BRE_ASSERT(mPendingItems.empty() || mPendingItems.back().mReleaseValue <= releaseValue);
+
+        for (T* item : mRemovedItems) {
+            mPendingItems.push_back(PendingItem{ item, releaseValue });
+        }
+        mRemovedItems.clear();
+
+        std::uint32_t releasedItemCount = 0U;
+        while (mPendingItems.empty() == false) {
+            const PendingItem& pendingItem = mPendingItems.front();
+            if (isComplete(pendingItem.mReleaseValue) == false) {
+                break;
+            }
+
+            release(*pendingItem.mItem);
+            mPendingItems.pop_front();
+            ++releasedItemCount;
+        }
+
+        return releasedItemCount;
+    }
+
+    ///
+    /// @brief Release all the items, including the removed ones
+    ///
+    /// All the handles are not valid after this call. The GPU must not be using the items.
+    /// This method must not be called while other threads use the map.
+    ///
+    /// @param release Function that releases an item
+    ///
+    template<typename ReleaseFunction>
+    void Clear(ReleaseFunction release) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (std::uint32_t i = 0U; i < mSlotCount; ++i) {
+            T* item = GetSlot(i).mItem.load(std::memory_order_relaxed);
+            if (item != nullptr) {
+                release(*item);
+                FreeSlot(i);
+            }
+        }
+
+        for (T* item : mRemovedItems) {
+            release(*item);
+        }
+        mRemovedItems.clear();
+
+        for (const PendingItem& pendingItem : mPendingItems) {
+            release(*pendingItem.mItem);
+        }
+        mPendingItems.clear();
+
+        BRE_ASSERT(mItemCount == 0U);
+    }
+
+    ///
+    /// @brief Get the number of items in the map
+    ///
+    /// Removed items are not included. This method is thread safe.
+    ///
+    /// @return The number of items
+    ///
+    std::uint32_t GetItemCount() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mItemCount;
+    }
+
+private:
+    static const std::uint32_t sIndexBitCount{ 20U };
+    static const std::uint32_t sIndexMask{ (1U << sIndexBitCount) - 1U };
+    static const std::uint32_t sGenerationMask{ 0xFFFFFFFFU >> sIndexBitCount };
+
+    // The last index is not used, so no valid handle is equal to sInvalidHandle.
+    static const std::uint32_t sMaxSlotCount{ sIndexMask };
+    static const std::uint32_t sChunkSlotCount{ 1024U };
+    static const std::uint32_t sMaxChunkCount{ (sMaxSlotCount + sChunkSlotCount - 1U) / sChunkSlotCount };
+
+    struct Slot {
+        std::atomic<T*> mItem{ nullptr };
+        std::atomic<std::uint32_t> mGeneration{ 0U };
+    };
+
+    struct PendingItem {
+        T* mItem;
+        std::uint64_t mReleaseValue;
+    };
+
+    __forceinline Slot& GetSlot(const std::uint32_t slotIndex) const noexcept
+    {
+        BRE_ASSERT(slotIndex < mSlotCount);
+        return mChunks[slotIndex / sChunkSlotCount].load(std::memory_order_relaxed)[slotIndex % sChunkSlotCount];
+    }
+
+    ///
+    /// @brief Free a slot. The mutex must be locked.
+    /// @param slotIndex Slot index
+    ///
+    void FreeSlot(const std::uint32_t slotIndex) noexcept
+    {
+        Slot& slot = GetSlot(slotIndex);
+        const std::uint32_t nextGeneration = (slot.mGeneration.load(std::memory_order_relaxed) + 1U) & sGenerationMask;
+        slot.mGeneration.store(nextGeneration, std::memory_order_release);
+        slot.mItem.store(nullptr, std::memory_order_release);
+        mFreeSlotIndices.push_back(slotIndex);
+
+        BRE_ASSERT(mItemCount > 0U);
+        --mItemCount;
+    }
+
+    std::atomic<Slot*> mChunks[sMaxChunkCount]{};
+    std::uint32_t mSlotCount{ 0U };
+    std::uint32_t mItemCount{ 0U };
+    std::vector<std::uint32_t> mFreeSlotIndices;
+
+    // Removed items are tagged with a release value in the next ReleaseRemovedItems() call.
+    std::vector<T*> mRemovedItems;
+    std::deque<PendingItem> mPendingItems;
+
+    mutable std::mutex mMutex;
+};
+
+template<typename T>
+const SlotMapHandle SlotMap<T>::sInvalidHandle;
+}